@@ -12,21 +12,27 @@ void DefinitionCardSection::setEntry(const Entry &entry)
     emit addingCards();
     cleanup();
     for (auto &definitionsSet : entry.getDefinitionsSets()) {
-        _definitionCards.push_back(new DefinitionCardWidget{this});
-        _definitionCards.back()->setEntry(definitionsSet);
+        // Re-bind cards left over from the previous entry before creating
+        // new ones
+        if (_cardsInUse == _definitionCards.size()) {
+            _definitionCards.push_back(new DefinitionCardWidget{this});
+        }
+        DefinitionCardWidget *card = _definitionCards[_cardsInUse++];
+        card->setEntry(definitionsSet);
+        card->show();
 
-        _definitionCardsLayout->addWidget(_definitionCards.back());
+        _definitionCardsLayout->addWidget(card);
     }
     emit finishedAddingCards();
 }
 
 void DefinitionCardSection::cleanup(void)
 {
-    for (auto card : _definitionCards) {
-        _definitionCardsLayout->removeWidget(card);
-        delete card;
+    for (size_t i = 0; i < _cardsInUse; i++) {
+        _definitionCardsLayout->removeWidget(_definitionCards[i]);
+        _definitionCards[i]->hide();
     }
-    _definitionCards.clear();
+    _cardsInUse = 0;
 }
 
 void DefinitionCardSection::updateStyleRequested(void)
@@ -9,6 +9,8 @@
 
 // The DefinitionCardSection contains DefinitionCardWidgets, one for
 // each DefinitionSet in the Entry that is set.
+// Cards are reused between entries; only the first _cardsInUse cards are
+// shown.
 
 class DefinitionCardSection : public QWidget
 {
@@ -23,6 +25,7 @@ private:
 
     QVBoxLayout *_definitionCardsLayout;
     std::vector<DefinitionCardWidget *> _definitionCards;
+    size_t _cardsInUse = 0;
 
 signals:
     void addingCards(void);
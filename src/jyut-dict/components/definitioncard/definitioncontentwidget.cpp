@@ -20,11 +20,10 @@ DefinitionContentWidget::DefinitionContentWidget(QWidget *parent) : QWidget(pare
     _definitionLayout->setVerticalSpacing(1);
     _definitionLayout->setContentsMargins(10, 0, 10, 0);
     _definitionLayout->setSizeConstraint(QLayout::SetMinAndMaxSize);
-}
 
-DefinitionContentWidget::~DefinitionContentWidget()
-{
-    cleanupLabels();
+    _definitionNumberWidth = fontMetrics().boundingRect("999").width();
+
+    setStyle(Utils::isDarkMode());
 }
 
 void DefinitionContentWidget::changeEvent(QEvent *event)
@@ -47,51 +46,64 @@ void DefinitionContentWidget::changeEvent(QEvent *event)
 void DefinitionContentWidget::setEntry(
     std::span<const Definition::Definition> definitions)
 {
-    cleanupLabels();
+    releaseLabels();
+
+    EntryCharactersOptions characterOptions
+        = _settings
+              ->value("characterOptions",
+                      QVariant::fromValue(
+                          EntryCharactersOptions::PREFER_TRADITIONAL))
+              .value<EntryCharactersOptions>();
+    CantoneseOptions cantoneseOptions
+        = _settings
+              ->value("Preview/cantonesePronunciationOptions",
+                      QVariant::fromValue(CantoneseOptions::RAW_JYUTPING))
+              .value<CantoneseOptions>();
+    MandarinOptions mandarinOptions
+        = _settings
+              ->value("Preview/mandarinPronunciationOptions",
+                      QVariant::fromValue(MandarinOptions::PRETTY_PINYIN))
+              .value<MandarinOptions>();
+    EntryPhoneticOptions phoneticOptions
+        = _settings
+              ->value("Preview/phoneticOptions",
+                      QVariant::fromValue(
+                          EntryPhoneticOptions::PREFER_CANTONESE))
+              .value<EntryPhoneticOptions>();
 
     int rowNumber = 0;
     for (size_t i = 0; i < definitions.size(); i++) {
-        std::string number = std::to_string(i + 1);
-
-        _definitionNumberLabels.push_back(new QLabel{number.c_str(), this});
-        int definitionNumberWidth = _definitionNumberLabels.back()
-                                        ->fontMetrics()
-                                        .boundingRect("999")
-                                        .width();
-        _definitionNumberLabels.back()->setFixedWidth(definitionNumberWidth);
-        _definitionLayout->addWidget(_definitionNumberLabels.back(),
+        QLabel *numberLabel = takeLabel(_definitionNumberLabels,
+                                        QString::number(i + 1));
+        numberLabel->setFixedWidth(_definitionNumberWidth);
+        _definitionLayout->addWidget(numberLabel,
                                      static_cast<int>(rowNumber),
                                      0,
                                      Qt::AlignTop);
 
-        QString label = QString::fromStdString(definitions[i].label);
+        QString label = QString::fromStdString(definitions[i].label.str());
         if (!label.isEmpty()) {
-            _definitionLabelLabels.push_back(
-                new QLabel{definitions[i].label.c_str(), this});
-            _definitionLabelLabels.back()->setWordWrap(true);
-            _definitionLayout->addWidget(_definitionLabelLabels.back(),
+            QLabel *labelLabel = takeLabel(_definitionLabelLabels, label);
+            labelLabel->setWordWrap(true);
+            _definitionLayout->addWidget(labelLabel,
                                          static_cast<int>(rowNumber++),
                                          1,
                                          Qt::AlignTop);
         }
 
-        _definitionLabels.push_back(
-            new QLabel{definitions[i].definitionContent.c_str(), this});
-        _definitionLabels.back()->setWordWrap(true);
-        _definitionLabels.back()->setTextInteractionFlags(
-            Qt::TextSelectableByMouse);
-        _definitionLayout->addWidget(_definitionLabels.back(),
+        QLabel *definitionLabel = takeLabel(
+            _definitionLabels,
+            QString::fromStdString(definitions[i].definitionContent));
+        definitionLabel->setWordWrap(true);
+        definitionLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+        _definitionLayout->addWidget(definitionLabel,
                                      static_cast<int>(rowNumber++),
                                      1,
                                      Qt::AlignTop);
 
         for (size_t j = 0; j < definitions[i].sentences.size(); j++) {
             QString exampleText;
-            switch (Settings::getSettings()
-                        ->value("characterOptions",
-                                QVariant::fromValue(
-                                    EntryCharactersOptions::PREFER_TRADITIONAL))
-                        .value<EntryCharactersOptions>()) {
+            switch (characterOptions) {
             case EntryCharactersOptions::ONLY_SIMPLIFIED:
                 exampleText = definitions[i].sentences[j].getSimplified().c_str();
                 break;
@@ -115,35 +127,20 @@ void DefinitionContentWidget::setEntry(
                 break;
             }
 
-            _exampleLabels.push_back(
-                new QLabel{"<ul style=\"list-style-type:circle;\"><li>"
-                               + exampleText + "</li></ul>",
-                           this});
-            _exampleLabels.back()->setContentsMargins(0, 0, 0, 0);
-            _exampleLabels.back()->setWordWrap(true);
-            _exampleLabels.back()->setTextInteractionFlags(
-                Qt::TextSelectableByMouse);
-            _definitionLayout->addWidget(_exampleLabels.back(),
+            QLabel *exampleLabel
+                = takeLabel(_exampleLabels,
+                            "<ul style=\"list-style-type:circle;\"><li>"
+                                + exampleText + "</li></ul>");
+            exampleLabel->setContentsMargins(0, 0, 0, 0);
+            exampleLabel->setWordWrap(true);
+            exampleLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+            _definitionLayout->addWidget(exampleLabel,
                                          static_cast<int>(rowNumber++),
                                          1,
                                          Qt::AlignTop);
 
             QString pronunciationText;
 
-            CantoneseOptions cantoneseOptions
-                = Settings::getSettings()
-                      ->value("Preview/cantonesePronunciationOptions",
-                              QVariant::fromValue(
-                                  CantoneseOptions::RAW_JYUTPING))
-                      .value<CantoneseOptions>();
-
-            MandarinOptions mandarinOptions
-                = Settings::getSettings()
-                      ->value("Preview/mandarinPronunciationOptions",
-                              QVariant::fromValue(
-                                  MandarinOptions::PRETTY_PINYIN))
-                      .value<MandarinOptions>();
-
             SourceSentence sentence = definitions[i].sentences[j];
             sentence.generatePhonetic(cantoneseOptions, mandarinOptions);
 
@@ -155,11 +152,7 @@ void DefinitionContentWidget::setEntry(
                                    sentence.getMandarinPhonetic(mandarinOptions))
                                    .trimmed();
 
-            switch (Settings::getSettings()
-                        ->value("Preview/phoneticOptions",
-                                QVariant::fromValue(
-                                    EntryPhoneticOptions::PREFER_CANTONESE))
-                        .value<EntryPhoneticOptions>()) {
+            switch (phoneticOptions) {
             case EntryPhoneticOptions::ONLY_CANTONESE:
                 pronunciationText = cantonese;
                 break;
@@ -185,13 +178,13 @@ void DefinitionContentWidget::setEntry(
             if (!pronunciationText.isEmpty()) {
                 // Don't use the "list-style-type:none;" stylesheet here; for some
                 // reason it changes all double-spaces (e.g. "  ") to single spaces
-                _examplePronunciationLabels.push_back(
-                    new QLabel{pronunciationText, this});
-                _examplePronunciationLabels.back()->setContentsMargins(0, 0, 0, 0);
-                _examplePronunciationLabels.back()->setWordWrap(true);
-                _examplePronunciationLabels.back()->setTextInteractionFlags(
+                QLabel *pronunciationLabel
+                    = takeLabel(_examplePronunciationLabels, pronunciationText);
+                pronunciationLabel->setContentsMargins(0, 0, 0, 0);
+                pronunciationLabel->setWordWrap(true);
+                pronunciationLabel->setTextInteractionFlags(
                     Qt::TextSelectableByMouse);
-                _definitionLayout->addWidget(_examplePronunciationLabels.back(),
+                _definitionLayout->addWidget(pronunciationLabel,
                                              static_cast<int>(rowNumber++),
                                              1,
                                              Qt::AlignTop);
@@ -203,14 +196,14 @@ void DefinitionContentWidget::setEntry(
                 if (!set.empty()) {
                     QString translation = QString::fromStdString(
                         set[0].sentence);
-                    _exampleTranslationLabels.push_back(
-                        new QLabel{"<ul style=\"list-style-type:none;\"><li>"
-                                       + translation + "</li></ul>",
-                                   this});
-                    _exampleTranslationLabels.back()->setWordWrap(true);
-                    _exampleTranslationLabels.back()->setTextInteractionFlags(
+                    QLabel *translationLabel
+                        = takeLabel(_exampleTranslationLabels,
+                                    "<ul style=\"list-style-type:none;\"><li>"
+                                        + translation + "</li></ul>");
+                    translationLabel->setWordWrap(true);
+                    translationLabel->setTextInteractionFlags(
                         Qt::TextSelectableByMouse);
-                    _definitionLayout->addWidget(_exampleTranslationLabels.back(),
+                    _definitionLayout->addWidget(translationLabel,
                                                  static_cast<int>(rowNumber++),
                                                  1,
                                                  Qt::AlignTop);
@@ -219,23 +212,21 @@ void DefinitionContentWidget::setEntry(
         }
 
         // This label adds space between definitions in the definition card.
-        _spaceLabels.push_back(new QLabel{" "});
-        _spaceLabels.back()->setMaximumHeight(4);
-        _definitionLayout->addWidget(_spaceLabels.back(),
+        QLabel *spaceLabel = takeLabel(_spaceLabels, " ");
+        spaceLabel->setMaximumHeight(4);
+        _definitionLayout->addWidget(spaceLabel,
                                      static_cast<int>(rowNumber++),
                                      1,
                                      Qt::AlignTop);
     }
 
     // This label adds a bit of space at the end of the definition card.
-    _spaceLabels.push_back(new QLabel{" "});
-    _spaceLabels.back()->setMaximumHeight(6);
-    _definitionLayout->addWidget(_spaceLabels.back(),
+    QLabel *spaceLabel = takeLabel(_spaceLabels, " ");
+    spaceLabel->setMaximumHeight(6);
+    _definitionLayout->addWidget(spaceLabel,
                                  static_cast<int>(rowNumber++),
                                  1,
                                  Qt::AlignTop);
-
-    setStyle(Utils::isDarkMode());
 }
 
 void DefinitionContentWidget::setStyle(bool use_dark)
@@ -256,106 +247,114 @@ void DefinitionContentWidget::setStyle(bool use_dark)
     int bodyFontSizeHan = Settings::bodyFontSizeHan.at(
         static_cast<unsigned long>(interfaceSize - 1));
 
+    std::optional<QFont> font;
+#ifdef Q_OS_WIN
+    font = QFont{"Microsoft YaHei"};
+    font->setStyleHint(QFont::System, QFont::PreferAntialias);
+#endif
+
     QString definitionNumberStyleSheet = "QLabel { "
                                          "   color: %1; "
                                          "   font-size: %2px; "
                                          "}";
-    for (const auto &label : _definitionNumberLabels) {
-        label->setStyleSheet(
-            definitionNumberStyleSheet.arg(textColour.name()).arg(bodyFontSize));
-    }
+    setPoolStyle(_definitionNumberLabels,
+                 definitionNumberStyleSheet.arg(textColour.name())
+                     .arg(bodyFontSize),
+                 std::nullopt);
     QString definitionLabelLabelStyleSheet = "QLabel { "
                                              "   color: %1; "
                                              "   font-size: %2px; "
                                              "   font-style: italic; "
                                              "   text-transform: lowercase; "
                                              "}";
-    for (const auto &label : _definitionLabelLabels) {
-        label->setStyleSheet(
-            definitionLabelLabelStyleSheet.arg(textColour.name())
-                .arg(bodyFontSize));
-    }
+    setPoolStyle(_definitionLabelLabels,
+                 definitionLabelLabelStyleSheet.arg(textColour.name())
+                     .arg(bodyFontSize),
+                 font);
     QString definitionLabelStyleSheet = "QLabel { "
                                         "   font-size: %2px; "
                                         "}";
-    for (const auto &label : _definitionLabels) {
-        label->setStyleSheet(definitionLabelStyleSheet.arg(bodyFontSize));
-    }
+    setPoolStyle(_definitionLabels,
+                 definitionLabelStyleSheet.arg(bodyFontSize),
+                 font);
 
     QString exampleStyleSheet = "QLabel { "
                                 "   font-size: %2px; "
                                 "}";
-    for (const auto &label : _exampleLabels) {
-        label->setStyleSheet(exampleStyleSheet.arg(bodyFontSizeHan));
-    }
+    setPoolStyle(_exampleLabels, exampleStyleSheet.arg(bodyFontSizeHan), font);
     QString examplePronunciationStyleSheet = "QLabel { "
                                              "   color: %1; "
                                              "   font-size: %2px; "
                                              "   padding-left: 38px; "
                                              "   margin-left: 0px; "
                                              "} ";
-    for (const auto &label : _examplePronunciationLabels) {
-        label->setStyleSheet(
-            examplePronunciationStyleSheet.arg(textColour.name())
-                .arg(bodyFontSize));
-    }
+    setPoolStyle(_examplePronunciationLabels,
+                 examplePronunciationStyleSheet.arg(textColour.name())
+                     .arg(bodyFontSize),
+                 std::nullopt);
     QString translationStyleSheet = "QLabel { "
                                     "   color: %1; "
                                     "   font-size: %2px; "
                                     "   font-style: italic; "
                                     "} ";
-    for (const auto &label : _exampleTranslationLabels) {
-        label->setStyleSheet(
-            translationStyleSheet.arg(textColour.name()).arg(bodyFontSize));
-    }
-
-#ifdef Q_OS_WIN
-    QFont font = QFont{"Microsoft YaHei"};
-    font.setStyleHint(QFont::System, QFont::PreferAntialias);
-    for (const auto &label : _definitionLabelLabels) {
-        label->setFont(font);
-    }
-    for (const auto &label : _definitionLabels) {
-        label->setFont(font);
-    }
-    for (const auto &label : _exampleLabels) {
-        label->setFont(font);
-    }
-    for (const auto &label : _exampleTranslationLabels) {
-        label->setFont(font);
-    }
-#endif
+    setPoolStyle(_exampleTranslationLabels,
+                 translationStyleSheet.arg(textColour.name()).arg(bodyFontSize),
+                 font);
 }
 
-void DefinitionContentWidget::cleanupLabels()
+void DefinitionContentWidget::setPoolStyle(LabelPool &pool,
+                                           const QString &styleSheet,
+                                           const std::optional<QFont> &font)
 {
-    for (const auto &label : _definitionNumberLabels) {
-        _definitionLayout->removeWidget(label);
-        delete label;
+    // Setting a stylesheet repolishes the label, so skip labels whose style
+    // has not changed since the last time.
+    if (pool.styleSheet == styleSheet && pool.font == font) {
+        return;
     }
-    _definitionNumberLabels.clear();
+    pool.styleSheet = styleSheet;
+    pool.font = font;
 
-    for (const auto &label : _definitionLabelLabels) {
-        _definitionLayout->removeWidget(label);
-        delete label;
+    for (const auto &label : pool.labels) {
+        label->setStyleSheet(pool.styleSheet);
+        if (pool.font) {
+            label->setFont(*pool.font);
+        }
     }
-    _definitionLabelLabels.clear();
+}
 
-    for (const auto &label : _definitionLabels) {
-        _definitionLayout->removeWidget(label);
-        delete label;
+QLabel *DefinitionContentWidget::takeLabel(LabelPool &pool, const QString &text)
+{
+    if (pool.used == pool.labels.size()) {
+        QLabel *label = new QLabel{this};
+        label->setStyleSheet(pool.styleSheet);
+        if (pool.font) {
+            label->setFont(*pool.font);
+        }
+        pool.labels.push_back(label);
     }
-    _definitionLabels.clear();
 
-    for (const auto &label : _exampleLabels) {
-        _definitionLayout->removeWidget(label);
-        delete label;
-    }
-    _exampleLabels.clear();
+    QLabel *label = pool.labels[pool.used++];
+    label->setText(text);
+    label->show();
+    return label;
+}
 
-    for (const auto &label : _spaceLabels) {
-        _definitionLayout->removeWidget(label);
-        delete label;
+void DefinitionContentWidget::releaseLabels(LabelPool &pool)
+{
+    for (size_t i = 0; i < pool.used; i++) {
+        _definitionLayout->removeWidget(pool.labels[i]);
+        pool.labels[i]->hide();
     }
-    _spaceLabels.clear();
+    pool.used = 0;
+}
+
+void DefinitionContentWidget::releaseLabels(void)
+{
+    releaseLabels(_definitionNumberLabels);
+    releaseLabels(_definitionLabelLabels);
+    releaseLabels(_definitionLabels);
+    releaseLabels(_exampleLabels);
+    releaseLabels(_examplePronunciationLabels);
+    releaseLabels(_exampleTranslationLabels);
+    releaseLabels(_spaceLabels);
 }
@@ -9,40 +9,59 @@
 #include <QSettings>
 #include <QWidget>
 
+#include <optional>
 #include <span>
 
 // The DefinitionContentWidget shows all the definitions
 // It contains a collection of QLabels, one for each definition
 // and its associated "number" (i.e. first definition, second definition, etc.)
 // It also displays sentences and examples associated with each definition.
+//
+// Labels are kept in pools and re-bound when a new entry is set, instead of
+// being destroyed and recreated every time the selected entry changes.
 
 class DefinitionContentWidget : public QWidget
 {
 public:
     explicit DefinitionContentWidget(QWidget *parent = nullptr);
-    ~DefinitionContentWidget() override;
 
     void changeEvent(QEvent *event) override;
 
     void setEntry(std::span<const Definition::Definition> definitions);
 
 private:
+    // Only the first `used` labels are shown in the layout; the rest are
+    // hidden until a later entry needs them.
+    struct LabelPool
+    {
+        std::vector<QLabel *> labels;
+        size_t used = 0;
+        QString styleSheet;
+        std::optional<QFont> font;
+    };
+
     void setStyle(bool use_dark);
+    void setPoolStyle(LabelPool &pool,
+                      const QString &styleSheet,
+                      const std::optional<QFont> &font);
 
-    void cleanupLabels();
+    QLabel *takeLabel(LabelPool &pool, const QString &text);
+    void releaseLabels(LabelPool &pool);
+    void releaseLabels(void);
 
     bool _paletteRecentlyChanged = false;
 
     std::unique_ptr<QSettings> _settings;
 
     QGridLayout *_definitionLayout;
-    std::vector<QLabel *> _definitionNumberLabels;
-    std::vector<QLabel *> _definitionLabelLabels;
-    std::vector<QLabel *> _definitionLabels;
-    std::vector<QLabel *> _exampleLabels;
-    std::vector<QLabel *> _examplePronunciationLabels;
-    std::vector<QLabel *> _exampleTranslationLabels;
-    std::vector<QLabel *> _spaceLabels;
+    int _definitionNumberWidth;
+    LabelPool _definitionNumberLabels;
+    LabelPool _definitionLabelLabels;
+    LabelPool _definitionLabels;
+    LabelPool _exampleLabels;
+    LabelPool _examplePronunciationLabels;
+    LabelPool _exampleTranslationLabels;
+    LabelPool _spaceLabels;
 };
 
 #endif // DEFINITIONCONTENTWIDGET_H
@@ -1,19 +1,32 @@
 #include "resultlistdelegate.h"
 
-#include "logic/entry/entry.h"
+#include "logic/entry/entrypreview.h"
 #include "logic/entry/entrycharactersoptions.h"
 #include "logic/entry/entryphoneticoptions.h"
 #include "logic/settings/settings.h"
 #include "logic/settings/settingsutils.h"
 #include "logic/utils/utils_qt.h"
 
-#include <QAbstractTextDocumentLayout>
+#include <QFontMetrics>
 #include <QGuiApplication>
-#include <QRectF>
-#include <QTextDocument>
-#include <QTextLayout>
+#include <QTransform>
 #include <QVariant>
 
+namespace {
+
+// Enough for every visible row of a maximized window, several times over
+constexpr std::size_t maxCachedRows = 512;
+
+QStaticText createPlainText(const QString &text, const QFont &font)
+{
+    QStaticText staticText{text};
+    staticText.setTextFormat(Qt::PlainText);
+    staticText.prepare(QTransform{}, font);
+    return staticText;
+}
+
+} // namespace
+
 ResultListDelegate::ResultListDelegate(QWidget *parent)
     : QStyledItemDelegate (parent)
 {
@@ -24,16 +37,16 @@ void ResultListDelegate::paint(QPainter *painter,
                                const QStyleOptionViewItem &option,
                                const QModelIndex &index) const
 {
-    if (!index.data().canConvert<Entry>()) {
+    if (!index.data().canConvert<EntryPreview>()) {
         return;
     }
 
     painter->save();
 
-    Entry entry = qvariant_cast<Entry>(index.data());
+    EntryPreview preview = qvariant_cast<EntryPreview>(index.data());
 
-    bool isWelcomeEntry = entry.isWelcome();
-    bool isEmptyEntry = entry.isEmpty();
+    bool isWelcomeEntry = preview.isWelcome;
+    bool isEmptyEntry = preview.isEmpty;
 
     QColor backgroundColour;
     if (option.state & QStyle::State_Selected && !isWelcomeEntry && !isEmptyEntry) {
@@ -58,194 +71,45 @@ void ResultListDelegate::paint(QPainter *painter,
 
     painter->setRenderHint(QPainter::Antialiasing, true);
 
-    EntryCharactersOptions characterOptions;
-    EntryPhoneticOptions phoneticOptions;
-    CantoneseOptions cantoneseOptions = CantoneseOptions::RAW_JYUTPING;
-    MandarinOptions mandarinOptions = MandarinOptions::PRETTY_PINYIN;
-    bool use_colours = false;
-    if (isWelcomeEntry || isEmptyEntry) {
-        characterOptions = EntryCharactersOptions::ONLY_SIMPLIFIED;
-        phoneticOptions = EntryPhoneticOptions::ONLY_MANDARIN;
-    } else {
-        characterOptions
-            = _settings
-                  ->value("characterOptions",
-                          QVariant::fromValue(
-                              EntryCharactersOptions::PREFER_TRADITIONAL))
-                  .value<EntryCharactersOptions>();
-        phoneticOptions = _settings
-                              ->value("Preview/phoneticOptions",
-                                      QVariant::fromValue(
-                                          EntryPhoneticOptions::PREFER_CANTONESE))
-                              .value<EntryPhoneticOptions>();
-        cantoneseOptions
-            = Settings::getSettings()
-                  ->value("Preview/cantonesePronunciationOptions",
-                          QVariant::fromValue(CantoneseOptions::RAW_JYUTPING))
-                  .value<CantoneseOptions>();
-        mandarinOptions
-            = Settings::getSettings()
-                  ->value("Preview/mandarinPronunciationOptions",
-                          QVariant::fromValue(MandarinOptions::PRETTY_PINYIN))
-                  .value<MandarinOptions>();
-        use_colours = !(option.state & QStyle::State_Selected);
-    }
-    entry.generatePhonetic(cantoneseOptions, mandarinOptions);
+    bool useColours = !isWelcomeEntry && !isEmptyEntry
+                      && !(option.state & QStyle::State_Selected);
+    const RowLayout &layout = getRowLayout(preview,
+                                           index.row(),
+                                           useColours,
+                                           option.rect.width(),
+                                           painter->font());
 
-    QRect r = option.rect;
-    QRect boundingRect;
-    QFont font = painter->font();
-    int interfaceSize = static_cast<int>(
-        _settings
-            ->value("Interface/size",
-                    QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-            .value<Settings::InterfaceSize>());
-    int h4FontSize = Settings::h4FontSize.at(
-        static_cast<unsigned long>(interfaceSize - 1));
-    int bodyFontSize = Settings::bodyFontSize.at(
-        static_cast<unsigned long>(interfaceSize - 1));
-    int bodyFontSizeHan = Settings::bodyFontSizeHan.at(
-        static_cast<unsigned long>(interfaceSize - 1));
-    int cellTopPadding = bodyFontSize;
-    int cellLeftPadding = bodyFontSize;
-    int contentSpacingMargin = bodyFontSize / 2;
+    painter->translate(option.rect.topLeft());
 
     // Chinese characters
-#ifdef Q_OS_WIN
-    QFont oldFont = font;
-    font = QFont("Microsoft Yahei");
-#endif
-    font.setPixelSize(h4FontSize);
-    painter->setFont(font);
-    r = option.rect.adjusted(cellLeftPadding,
-                             cellTopPadding,
-                             -cellLeftPadding,
-                             0);
-
-    // Use QTextDocument for rich text
-    QTextDocument *doc = new QTextDocument{};
-    entry.refreshColours(
-        _settings
-            ->value("entryColourPhoneticType",
-                    QVariant::fromValue(EntryColourPhoneticType::CANTONESE))
-            .value<EntryColourPhoneticType>());
     // Can't elide this text because QFontMetrics tries to elide the rich text
-    // HTML annotations.
-    QString characters
-        = entry.getCharacters(characterOptions, use_colours).c_str();
-    doc->setHtml(characters);
-    doc->setTextWidth(r.width());
-    doc->setDefaultFont(font);
-    doc->setDocumentMargin(0);
-    QAbstractTextDocumentLayout *documentLayout = doc->documentLayout();
-    auto ctx = QAbstractTextDocumentLayout::PaintContext();
-    ctx.palette.setColor(QPalette::Text, painter->pen().color());
-    QRectF bounds = QRectF(0, 0, r.width(), h4FontSize);
-    ctx.clip = bounds;
-    painter->translate(cellLeftPadding, r.y());
-    documentLayout->draw(painter, ctx);
-    painter->translate(-cellLeftPadding, -r.y());
-    r = r.adjusted(0, h4FontSize + contentSpacingMargin * 2, 0, 0);
-
-    delete doc;
+    // HTML annotations, so clip it to a single line instead.
+    painter->save();
+    painter->setFont(layout.charactersFont);
+    painter->setClipRect(layout.charactersClip);
+    painter->drawStaticText(layout.charactersPosition, layout.characters);
+    painter->restore();
 
     // Phonetic and definition snippets
-#ifdef Q_OS_WIN
-    font = oldFont;
-#endif
-    QFontMetrics metrics{font};
-    QString snippet;
-    if (isEmptyEntry) {
-        r = r.adjusted(0, -contentSpacingMargin, 0, 0);
-        font.setPixelSize(bodyFontSize + 2);
-        painter->setFont(font);
-        metrics = QFontMetrics(font);
-        QString phonetic = metrics.elidedText(entry.getJyutping().c_str(),
-                                              Qt::ElideRight,
-                                              r.width());
-        painter->drawText(r, 0, phonetic, &boundingRect);
-        r = r.adjusted(0, bodyFontSize + 2 + contentSpacingMargin * 2, 0, 0);
+    painter->setFont(layout.phoneticFont);
+    painter->drawStaticText(layout.phoneticPosition, layout.phonetic);
 
-        if (Settings::isCurrentLocaleHan()) {
-            font.setPixelSize(bodyFontSizeHan);
-        } else {
-            font.setPixelSize(bodyFontSize);
-        }
-        painter->setFont(font);
+    painter->setFont(layout.snippetFont);
+    if (isEmptyEntry) {
         painter->save();
         painter->setPen(QPen(option.palette.color(QPalette::PlaceholderText)));
-
-        // Do custom text layout to get eliding double-line label
-        snippet = entry.getDefinitionSnippet().c_str();
-        QTextLayout *textLayout = new QTextLayout{snippet, painter->font()};
-        textLayout->beginLayout();
-
-        // Define start and end y coordinates
-        // max height of label is five lines, so height * 5
-        int y = r.y();
-        int height = y + metrics.height() * 5;
-
-        for (;;) {
-            QTextLine line = textLayout->createLine();
-
-            if (!line.isValid()) {
-                break;
-            }
-
-            line.setLineWidth(r.width());
-            int nextLineY = y + metrics.lineSpacing();
-
-            if (height >= nextLineY + metrics.lineSpacing()) {
-                line.draw(painter, QPoint(r.x(), y));
-                y = nextLineY;
-            } else {
-                QString lastLine = snippet.mid(line.textStart());
-                QString elidedLastLine = metrics.elidedText(lastLine,
-                                                            Qt::ElideRight,
-                                                            r.width());
-                // For some reason at small font sizes, -4 is necessary to make
-                // it look right (except in Chinese fonts). *shrug*
-                if (Settings::isCurrentLocaleHan()) {
-                    painter->drawText(QPoint(r.x(), y + metrics.ascent()),
-                                      elidedLastLine);
-                } else {
-                    painter->drawText(QPoint(r.x(), y + metrics.ascent() - 4),
-                                      elidedLastLine);
-                }
-                line = textLayout->createLine();
-                break;
-            }
+        for (size_t i = 0; i < layout.snippetLinePositions.size(); i++) {
+            layout.snippetLines->lineAt(static_cast<int>(i))
+                .draw(painter, layout.snippetLinePositions[i]);
         }
-
-        textLayout->endLayout();
-        delete textLayout;
+        painter->drawStaticText(layout.snippetPosition, layout.snippet);
         painter->restore();
     } else {
-        font.setPixelSize(bodyFontSize);
-        painter->setFont(font);
-        // We can't get a bounding rect from QAbstractTextDocumentLayout::draw(),
-        // so we have to manually adjust the location where the painter draws
-        // phonetic + definition snippets
-        metrics = QFontMetrics{font};
-        QString phonetic = metrics.elidedText(entry
-                                                  .getPhonetic(phoneticOptions,
-                                                               cantoneseOptions,
-                                                               mandarinOptions)
-                                                  .c_str(),
-                                              Qt::ElideRight,
-                                              r.width());
-        if (phonetic.isEmpty()) {
-            phonetic = "-";
-        }
-        painter->drawText(r, 0, phonetic, &boundingRect);
-        r = r.adjusted(0, bodyFontSize + contentSpacingMargin / 2, 0, 0);
-
-        snippet = metrics.elidedText(
-            entry.getDefinitionSnippet().c_str(),
-            Qt::ElideRight, r.width());
-        painter->drawText(r, 0, snippet, &boundingRect);
+        painter->drawStaticText(layout.snippetPosition, layout.snippet);
     }
 
+    painter->translate(-option.rect.topLeft());
+
     // Bottom divider
     QRect rct = option.rect;
     rct.setY(rct.bottom());
@@ -259,14 +123,10 @@ QSize ResultListDelegate::sizeHint(const QStyleOptionViewItem &option,
 {
     (void) (option);
 
-    Entry entry = qvariant_cast<Entry>(index.data());
-    bool isEmptyEntry = entry.isEmpty();
+    bool isEmptyEntry = qvariant_cast<EntryPreview>(index.data()).isEmpty;
 
     Settings::InterfaceSize interfaceSize
-        = _settings
-              ->value("Interface/size",
-                      QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-              .value<Settings::InterfaceSize>();
+        = getDisplaySettings().interfaceSize;
 
     if (isEmptyEntry) {
 #ifdef Q_OS_MAC
@@ -405,3 +265,237 @@ QSize ResultListDelegate::sizeHint(const QStyleOptionViewItem &option,
     // never reach here.
     return QSize(100, 100);
 }
+
+void ResultListDelegate::invalidateCache(void)
+{
+    _displaySettings.reset();
+    _rowLayouts.clear();
+}
+
+const ResultListDelegate::DisplaySettings &ResultListDelegate::getDisplaySettings(
+    void) const
+{
+    if (_displaySettings
+        && _displaySettings->toneColoursVersion
+               == Settings::toneColoursVersion) {
+        return *_displaySettings;
+    }
+
+    // The tone colours don't go through QSettings, so changing them has to
+    // throw away the layouts as well
+    _rowLayouts.clear();
+    _displaySettings = DisplaySettings{
+        _settings
+            ->value("characterOptions",
+                    QVariant::fromValue(
+                        EntryCharactersOptions::PREFER_TRADITIONAL))
+            .value<EntryCharactersOptions>(),
+        _settings
+            ->value("Preview/phoneticOptions",
+                    QVariant::fromValue(EntryPhoneticOptions::PREFER_CANTONESE))
+            .value<EntryPhoneticOptions>(),
+        _settings
+            ->value("Preview/cantonesePronunciationOptions",
+                    QVariant::fromValue(CantoneseOptions::RAW_JYUTPING))
+            .value<CantoneseOptions>(),
+        _settings
+            ->value("Preview/mandarinPronunciationOptions",
+                    QVariant::fromValue(MandarinOptions::PRETTY_PINYIN))
+            .value<MandarinOptions>(),
+        _settings
+            ->value("entryColourPhoneticType",
+                    QVariant::fromValue(EntryColourPhoneticType::CANTONESE))
+            .value<EntryColourPhoneticType>(),
+        _settings
+            ->value("Interface/size",
+                    QVariant::fromValue(Settings::InterfaceSize::NORMAL))
+            .value<Settings::InterfaceSize>(),
+        Settings::toneColoursVersion,
+    };
+    return *_displaySettings;
+}
+
+const ResultListDelegate::RowLayout &ResultListDelegate::getRowLayout(
+    const EntryPreview &preview,
+    int row,
+    bool useColours,
+    int width,
+    const QFont &font) const
+{
+    getDisplaySettings();
+
+    qint64 key = (static_cast<qint64>(row) << 1) | (useColours ? 1 : 0);
+    auto layout = _rowLayouts.find(key);
+    if (layout != _rowLayouts.end() && layout->second.width == width) {
+        return layout->second;
+    }
+
+    // Only the rows near the viewport are ever needed again, so rather than
+    // tracking which rows are oldest, start over once the cache gets large
+    if (layout == _rowLayouts.end() && _rowLayouts.size() >= maxCachedRows) {
+        _rowLayouts.clear();
+    }
+    RowLayout &newLayout = _rowLayouts[key];
+    newLayout = createRowLayout(preview, useColours, width, font);
+    return newLayout;
+}
+
+ResultListDelegate::RowLayout ResultListDelegate::createRowLayout(
+    const EntryPreview &preview,
+    bool useColours,
+    int width,
+    const QFont &baseFont) const
+{
+    const DisplaySettings &settings = getDisplaySettings();
+
+    bool isWelcomeEntry = preview.isWelcome;
+    bool isEmptyEntry = preview.isEmpty;
+
+    EntryCharactersOptions characterOptions = settings.characterOptions;
+    EntryPhoneticOptions phoneticOptions = settings.phoneticOptions;
+    CantoneseOptions cantoneseOptions = settings.cantoneseOptions;
+    MandarinOptions mandarinOptions = settings.mandarinOptions;
+    if (isWelcomeEntry || isEmptyEntry) {
+        characterOptions = EntryCharactersOptions::ONLY_SIMPLIFIED;
+        phoneticOptions = EntryPhoneticOptions::ONLY_MANDARIN;
+        cantoneseOptions = CantoneseOptions::RAW_JYUTPING;
+        mandarinOptions = MandarinOptions::PRETTY_PINYIN;
+    }
+
+    RowLayout layout;
+    layout.width = width;
+
+    int interfaceSize = static_cast<int>(settings.interfaceSize);
+    int h4FontSize = Settings::h4FontSize.at(
+        static_cast<unsigned long>(interfaceSize - 1));
+    int bodyFontSize = Settings::bodyFontSize.at(
+        static_cast<unsigned long>(interfaceSize - 1));
+    int bodyFontSizeHan = Settings::bodyFontSizeHan.at(
+        static_cast<unsigned long>(interfaceSize - 1));
+    int cellTopPadding = bodyFontSize;
+    int cellLeftPadding = bodyFontSize;
+    int contentSpacingMargin = bodyFontSize / 2;
+
+    QRect r = QRect{0, 0, width, 0}.adjusted(cellLeftPadding,
+                                             cellTopPadding,
+                                             -cellLeftPadding,
+                                             0);
+
+    // Chinese characters
+    QFont font = baseFont;
+#ifdef Q_OS_WIN
+    font = QFont("Microsoft Yahei");
+#endif
+    font.setPixelSize(h4FontSize);
+    layout.charactersFont = font;
+    layout.characters.setTextFormat(Qt::RichText);
+    layout.characters.setTextWidth(r.width());
+    layout.characters.setText(QString::fromStdString(
+        EntryPreviewUtils::getCharacters(preview,
+                                         characterOptions,
+                                         settings.colourType,
+                                         useColours)));
+    layout.characters.prepare(QTransform{}, font);
+    layout.charactersPosition = r.topLeft();
+    layout.charactersClip = QRect{r.x(), r.y(), r.width(), h4FontSize};
+    r = r.adjusted(0, h4FontSize + contentSpacingMargin * 2, 0, 0);
+
+    // Phonetic and definition snippets
+    font = baseFont;
+    QString snippet = QString::fromUtf8(preview.definitionSnippet.data(),
+                                        preview.definitionSnippet.size());
+    if (isEmptyEntry) {
+        r = r.adjusted(0, -contentSpacingMargin, 0, 0);
+        font.setPixelSize(bodyFontSize + 2);
+        QFontMetrics metrics{font};
+        layout.phoneticFont = font;
+        layout.phonetic = createPlainText(
+            metrics.elidedText(QString::fromUtf8(preview.jyutping.data(),
+                                                 preview.jyutping.size()),
+                               Qt::ElideRight,
+                               r.width()),
+            font);
+        layout.phoneticPosition = r.topLeft();
+        r = r.adjusted(0, bodyFontSize + 2 + contentSpacingMargin * 2, 0, 0);
+
+        if (Settings::isCurrentLocaleHan()) {
+            font.setPixelSize(bodyFontSizeHan);
+        } else {
+            font.setPixelSize(bodyFontSize);
+        }
+        layout.snippetFont = font;
+
+        // Do custom text layout to get eliding double-line label
+        layout.snippetLines = std::make_unique<QTextLayout>(snippet, font);
+        layout.snippetLines->beginLayout();
+
+        // Define start and end y coordinates
+        // max height of label is five lines, so height * 5
+        int y = r.y();
+        int height = y + metrics.height() * 5;
+
+        for (;;) {
+            QTextLine line = layout.snippetLines->createLine();
+
+            if (!line.isValid()) {
+                break;
+            }
+
+            line.setLineWidth(r.width());
+            int nextLineY = y + metrics.lineSpacing();
+
+            if (height >= nextLineY + metrics.lineSpacing()) {
+                layout.snippetLinePositions.emplace_back(r.x(), y);
+                y = nextLineY;
+            } else {
+                QString lastLine = snippet.mid(line.textStart());
+                QString elidedLastLine = metrics.elidedText(lastLine,
+                                                            Qt::ElideRight,
+                                                            r.width());
+                layout.snippet = createPlainText(elidedLastLine, font);
+
+                // The last line used to be drawn from its baseline, so
+                // convert that to the top of the static text.
+                // For some reason at small font sizes, -4 is necessary to make
+                // it look right (except in Chinese fonts). *shrug*
+                int baseline = y + metrics.ascent();
+                if (!Settings::isCurrentLocaleHan()) {
+                    baseline -= 4;
+                }
+                layout.snippetPosition
+                    = QPoint{r.x(), baseline - QFontMetrics{font}.ascent()};
+                break;
+            }
+        }
+
+        layout.snippetLines->endLayout();
+    } else {
+        font.setPixelSize(bodyFontSize);
+        QFontMetrics metrics{font};
+        layout.phoneticFont = font;
+        layout.snippetFont = font;
+
+        QString phonetic = metrics.elidedText(
+            QString::fromStdString(
+                EntryPreviewUtils::getPhonetic(preview,
+                                               phoneticOptions,
+                                               cantoneseOptions,
+                                               mandarinOptions)),
+            Qt::ElideRight,
+            r.width());
+        if (phonetic.isEmpty()) {
+            phonetic = "-";
+        }
+        layout.phonetic = createPlainText(phonetic, font);
+        layout.phoneticPosition = r.topLeft();
+        r = r.adjusted(0, bodyFontSize + contentSpacingMargin / 2, 0, 0);
+
+        layout.snippet = createPlainText(metrics.elidedText(snippet,
+                                                            Qt::ElideRight,
+                                                            r.width()),
+                                         font);
+        layout.snippetPosition = r.topLeft();
+    }
+
+    return layout;
+}
@@ -1,18 +1,36 @@
 #ifndef RESULTLISTDELEGATE_H
 #define RESULTLISTDELEGATE_H
 
+#include "logic/entry/entrycharactersoptions.h"
+#include "logic/entry/entryphoneticoptions.h"
+#include "logic/entry/entrypreview.h"
+#include "logic/settings/settings.h"
+
+#include <QFont>
 #include <QModelIndex>
 #include <QPainter>
+#include <QPoint>
+#include <QRect>
 #include <QSettings>
+#include <QStaticText>
 #include <QStyledItemDelegate>
 #include <QStyleOptionViewItem>
+#include <QTextLayout>
 #include <QWidget>
 
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 // The ResultListDelegate is responsible for painting elements in the ResultListView
 // It also provides a sizehint for each element
 
+// Laying out a row (formatting and colouring the entry, then shaping its text)
+// costs far more than drawing it, so each row is laid out once and cached
+// until the row's width or selection changes. Call invalidateCache() when the
+// settings or the model change.
+
 class ResultListDelegate : public QStyledItemDelegate
 {
 Q_OBJECT
@@ -25,8 +43,61 @@ public:
     QSize sizeHint(const QStyleOptionViewItem &option,
                        const QModelIndex &index) const override;
 
+    void invalidateCache(void);
+
 private:
+    // The settings that affect how a row is laid out, read once per
+    // invalidation instead of once per paint
+    struct DisplaySettings
+    {
+        EntryCharactersOptions characterOptions;
+        EntryPhoneticOptions phoneticOptions;
+        CantoneseOptions cantoneseOptions;
+        MandarinOptions mandarinOptions;
+        EntryColourPhoneticType colourType;
+        Settings::InterfaceSize interfaceSize;
+        uint32_t toneColoursVersion;
+    };
+
+    // Positions are relative to the top left corner of the row
+    struct RowLayout
+    {
+        int width = 0;
+
+        QFont charactersFont;
+        QStaticText characters;
+        QPoint charactersPosition;
+        QRect charactersClip;
+
+        QFont phoneticFont;
+        QStaticText phonetic;
+        QPoint phoneticPosition;
+
+        // Only the empty entry lays its snippet out over multiple lines; the
+        // last line that fits is elided and drawn as snippet
+        QFont snippetFont;
+        std::unique_ptr<QTextLayout> snippetLines;
+        std::vector<QPoint> snippetLinePositions;
+        QStaticText snippet;
+        QPoint snippetPosition;
+    };
+
+    const DisplaySettings &getDisplaySettings(void) const;
+    const RowLayout &getRowLayout(const EntryPreview &preview,
+                                  int row,
+                                  bool useColours,
+                                  int width,
+                                  const QFont &font) const;
+    RowLayout createRowLayout(const EntryPreview &preview,
+                              bool useColours,
+                              int width,
+                              const QFont &font) const;
+
     std::unique_ptr<QSettings> _settings;
+
+    mutable std::optional<DisplaySettings> _displaySettings;
+    // Keyed by row and whether the row is drawn with colours
+    mutable std::unordered_map<qint64, RowLayout> _rowLayouts;
 };
 
 #endif // RESULTLISTDELEGATE_H
@@ -1,7 +1,27 @@
 #include "resultlistmodel.h"
 
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+namespace {
+
+// A few screenfuls of rows at the smallest interface size
+constexpr std::size_t pageSize = 100;
+
+// Enough for the current row and the ones the user just moved away from
+constexpr std::size_t entryCacheSize = 4;
+
+QString toQString(std::string_view view)
+{
+    return QString::fromUtf8(view.data(), static_cast<qsizetype>(view.size()));
+}
+
+} // namespace
+
 ResultListModel::ResultListModel(std::shared_ptr<ISearchObservable> sqlSearch,
-                                 std::vector<Entry> entries,
+                                 std::shared_ptr<SQLSearch> entrySearch,
+                                 const std::vector<Entry> &entries,
                                  bool isFavouritesList, QObject *parent)
     : QAbstractListModel(parent),
     _isFavouritesList{isFavouritesList}
@@ -13,16 +33,13 @@ ResultListModel::ResultListModel(std::shared_ptr<ISearchObservable> sqlSearch,
     if (entries.empty() && !isFavouritesList) {
         setWelcome();
     } else {
-        _entries = entries;
+        _previews = EntryPreviewSet{entries};
+        _rowCount = std::min(pageSize, _previews.size());
     }
 
     _search = sqlSearch;
     _search->registerObserver(this);
-
-    connect(this,
-            &ResultListModel::callbackInvoked,
-            this,
-            &ResultListModel::copyEntries);
+    _entrySearch = entrySearch;
 }
 
 ResultListModel::~ResultListModel()
@@ -35,38 +52,57 @@ void ResultListModel::callback(const std::vector<Entry> &entries, bool emptyQuer
     // This function is usually called in another thread (since ISearchObservable
     // objects do their work in a separate thread to avoid congesting the UI thread).
     //
-    // Copying entries into the result model is NOT re-entrant. But with Qt's
-    // signals/slots mechanism, since the connection is a QueuedConnection,
-    // only one copyEntries is called at a time by the main thread
-    // AND in the order the callbackInvoked signals came in, because the thread's
-    // event loop processes signals as a FIFO queue.
-    emit callbackInvoked(entries, emptyQuery);
+    // The previews are made here in the search thread, and moved into the
+    // model by the main thread; the entries themselves are not kept.
+    //
+    // Copying previews into the result model is NOT re-entrant. But since the
+    // call is queued, only one copyPreviews is called at a time by the main
+    // thread AND in the order the callbacks came in, because the thread's
+    // event loop processes queued calls as a FIFO queue.
+    auto previews = std::make_shared<EntryPreviewSet>(entries);
+    QMetaObject::invokeMethod(
+        this,
+        [this, previews, emptyQuery]() {
+            copyPreviews(std::move(*previews), emptyQuery);
+        },
+        Qt::QueuedConnection);
 }
 
-void ResultListModel::copyEntries(const std::vector<Entry> &entries, bool emptyQuery)
+void ResultListModel::copyPreviews(EntryPreviewSet previews, bool emptyQuery)
 {
     // As soon as another event wants to update the list model, kill
     // any prior pending updates by stopping the timer.
     _updateModelTimer->stop();
     disconnect(_updateModelTimer, nullptr, nullptr, nullptr);
 
-    if (entries.empty() && !emptyQuery) {
+    if (previews.empty() && !emptyQuery) {
         _updateModelTimer->setInterval(500);
         _updateModelTimer->setSingleShot(true);
-        QObject::connect(_updateModelTimer, &QTimer::timeout, this, [=, this]() {
-            setEntries(entries, emptyQuery);
+        QObject::connect(_updateModelTimer, &QTimer::timeout, this, [this, emptyQuery]() {
+            setPreviews(EntryPreviewSet{}, emptyQuery);
         });
         _updateModelTimer->start();
     } else {
-        setEntries(entries, emptyQuery);
+        setPreviews(std::move(previews), emptyQuery);
     }
 }
 
-void ResultListModel::setEntries(const std::vector<Entry> &entries, bool emptyQuery) {
+void ResultListModel::setEntries(const std::vector<Entry> &entries,
+                                 bool emptyQuery)
+{
+    setPreviews(EntryPreviewSet{entries}, emptyQuery);
+}
+
+void ResultListModel::setPreviews(EntryPreviewSet previews, bool emptyQuery)
+{
+    // A new set of results replaces every row, so this is still a reset;
+    // only the first page is shown now, and the rest in fetchMore()
     beginResetModel();
-    _entries = entries;
+    _previews = std::move(previews);
+    _rowCount = std::min(pageSize, _previews.size());
+    _entryCache.clear();
     endResetModel();
-    if (_entries.empty() && !emptyQuery) {
+    if (_previews.empty() && !emptyQuery) {
         setEmpty();
     }
 }
@@ -138,36 +174,110 @@ void ResultListModel::setIsFavouritesList(bool isFavouritesList)
 int ResultListModel::rowCount(const QModelIndex &parent) const
 {
     if (!parent.isValid()) {
-        return static_cast<int>(_entries.size());
+        return static_cast<int>(_rowCount);
     }
 
-    if (static_cast<unsigned long>(parent.row()) >= _entries.size()) {
-        return static_cast<int>(_entries.size());
+    if (static_cast<unsigned long>(parent.row()) >= _rowCount) {
+        return static_cast<int>(_rowCount);
     }
 
-    return static_cast<int>(_entries.size() - 1
+    return static_cast<int>(_rowCount - 1
                             - static_cast<unsigned long>(parent.row()));
 }
 
+bool ResultListModel::canFetchMore(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return false;
+    }
+
+    return _rowCount < _previews.size();
+}
+
+void ResultListModel::fetchMore(const QModelIndex &parent)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    std::size_t count = std::min(pageSize, _previews.size() - _rowCount);
+    if (!count) {
+        return;
+    }
+
+    int first = static_cast<int>(_rowCount);
+    beginInsertRows(QModelIndex(), first, first + static_cast<int>(count) - 1);
+    _rowCount += count;
+    endInsertRows();
+}
+
 QVariant ResultListModel::data(const QModelIndex &index, int role) const
 {
     if (!index.isValid()) {
         return QVariant();
     }
 
-    if (static_cast<unsigned long>(index.row()) >= _entries.size()) {
+    if (static_cast<unsigned long>(index.row()) >= _rowCount) {
         return QVariant();
     }
 
     if (role == Qt::DisplayRole) {
         QVariant var;
-        var.setValue(_entries.at(static_cast<unsigned long>(index.row())));
+        var.setValue(_previews.at(static_cast<unsigned long>(index.row())));
+        return var;
+    } else if (role == EntryRole) {
+        QVariant var;
+        var.setValue(getEntry(static_cast<unsigned long>(index.row())));
         return var;
     } else {
         return QVariant();
     }
 }
 
+Entry ResultListModel::getEntry(std::size_t row) const
+{
+    auto cached = std::find_if(_entryCache.begin(),
+                               _entryCache.end(),
+                               [row](const auto &item) {
+                                   return item.first == row;
+                               });
+    if (cached != _entryCache.end()) {
+        return cached->second;
+    }
+
+    if (_entryCache.size() == entryCacheSize) {
+        _entryCache.pop_back();
+    }
+    _entryCache.emplace_front(row, loadEntry(_previews.at(row)));
+    return _entryCache.front().second;
+}
+
+Entry ResultListModel::loadEntry(const EntryPreview &preview) const
+{
+    if (!preview.isWelcome && !preview.isEmpty && _entrySearch) {
+        std::vector<Entry> entries
+            = _entrySearch->lookUpByUnique(toQString(preview.simplified),
+                                           toQString(preview.traditional),
+                                           toQString(preview.jyutping),
+                                           toQString(preview.pinyin));
+        if (!entries.empty()) {
+            return entries.front();
+        }
+    }
+
+    // The welcome and empty placeholders are not in the dictionary, and an
+    // entry may have been removed from it since the search (e.g. when its
+    // source is deleted), so the entry is rebuilt from the preview instead.
+    Entry entry{std::string{preview.simplified},
+                std::string{preview.traditional},
+                std::string{preview.jyutping},
+                std::string{preview.pinyin},
+                {}};
+    entry.setIsWelcome(preview.isWelcome);
+    entry.setIsEmpty(preview.isEmpty);
+    return entry;
+}
+
 QVariant ResultListModel::headerData(int section, Qt::Orientation orientation,
                                     int role) const
 {
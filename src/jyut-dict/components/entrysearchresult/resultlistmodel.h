@@ -2,6 +2,7 @@
 #define RESULTLISTMODEL_H
 
 #include "logic/entry/entry.h"
+#include "logic/entry/entrypreview.h"
 #include "logic/search/isearchobservable.h"
 #include "logic/search/isearchobserver.h"
 #include "logic/search/sqlsearch.h"
@@ -12,13 +13,25 @@
 #include <QTimer>
 #include <QVariant>
 
-#include <string>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <utility>
 #include <vector>
 
-// The ResultListModel contains data (a vector of Entry objects)
+// The ResultListModel contains data (a set of EntryPreview objects)
 // It is populated with the results of a search, being a searchobserver
 
-// Entries are returned as QVariants when an index is provided
+// Only the previews of the results are kept, which hold the headwords,
+// romanization and the beginning of the definition snippet of each row. They
+// are made in the search thread, and handed to the view a page at a time
+// when it asks for more rows with fetchMore() (usually because the user
+// scrolled to the bottom).
+
+// For the display role, the lightweight EntryPreview is returned as a QVariant.
+// The EntryRole returns the full Entry, which is looked up in the dictionary
+// by the headwords and romanization of the row when it is asked for; the
+// last few are cached, since opening a row asks for its entry more than once.
 // Header data override is "good manners", but currently is not useful
 
 class ResultListModel : public QAbstractListModel, public ISearchObserver
@@ -26,8 +39,13 @@ class ResultListModel : public QAbstractListModel, public ISearchObserver
     Q_OBJECT
 
 public:
+    enum Roles {
+        EntryRole = Qt::UserRole,
+    };
+
     explicit ResultListModel(std::shared_ptr<ISearchObservable> sqlSearch,
-                             std::vector<Entry> entries,
+                             std::shared_ptr<SQLSearch> entrySearch,
+                             const std::vector<Entry> &entries,
                              bool isFavouritesList = false,
                              QObject *parent = nullptr);
     ~ResultListModel() override;
@@ -40,27 +58,33 @@ public:
     void setIsFavouritesList(bool isFavouritesList);
 
     int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex &parent) const override;
+    void fetchMore(const QModelIndex &parent) override;
     QVariant data(const QModelIndex &index, int role) const override;
     QVariant headerData(int section,
                         Qt::Orientation orientation,
                         int role = Qt::DisplayRole) const override;
 
 private:
+    void copyPreviews(EntryPreviewSet previews, bool emptyQuery);
+    void setPreviews(EntryPreviewSet previews, bool emptyQuery);
+
+    Entry getEntry(std::size_t row) const;
+    Entry loadEntry(const EntryPreview &preview) const;
+
     bool _isFavouritesList = false;
 
     QTimer *_updateModelTimer;
 
-    std::vector<Entry> _entries;
+    // All of the results, of which the first _rowCount have been shown so far
+    EntryPreviewSet _previews;
+    std::size_t _rowCount = 0;
 
-    std::shared_ptr<ISearchObservable> _search;
-
-private slots:
-    void copyEntries(
-        const std::vector<Entry> &entries, bool emptyQuery);
+    // The entries of the rows that were asked for most recently, newest first
+    mutable std::deque<std::pair<std::size_t, Entry>> _entryCache;
 
-signals:
-    void callbackInvoked(
-        const std::vector<Entry> &entries, bool emptyQuery);
+    std::shared_ptr<ISearchObservable> _search;
+    std::shared_ptr<SQLSearch> _entrySearch;
 };
 
 #endif // RESULTLISTMODEL_H
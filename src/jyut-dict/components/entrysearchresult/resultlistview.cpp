@@ -18,6 +18,11 @@ ResultListView::ResultListView(QWidget *parent)
     setItemDelegate(_delegate);
 
     setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+
+    // Every row is the same height (the only exception is the welcome or
+    // empty row, which is always alone), so only the first row's size hint
+    // is ever needed
+    setUniformItemSizes(true);
     connect(qApp,
             &QGuiApplication::applicationStateChanged,
             this,
@@ -37,8 +42,19 @@ void ResultListView::wheelEvent(QWheelEvent *event)
 }
 #endif
 
+// The delegate caches the layout of each row by row number, so it has to be
+// cleared whenever the model's rows are replaced
+void ResultListView::reset(void)
+{
+    static_cast<ResultListDelegate *>(_delegate)->invalidateCache();
+    QListView::reset();
+}
+
 void ResultListView::paintWithApplicationState()
 {
+    // This is also called when settings change, which can change the
+    // layout of every row
+    static_cast<ResultListDelegate *>(_delegate)->invalidateCache();
     viewport()->update();         // Forces repaint of viewing area
     scheduleDelayedItemsLayout(); // Forces items to resize themselves
 }
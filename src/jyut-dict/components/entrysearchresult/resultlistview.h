@@ -26,6 +26,8 @@ public:
     void wheelEvent(QWheelEvent *event) override;
 #endif
 
+    void reset(void) override;
+
 private:
     QStyledItemDelegate *_delegate;
 
@@ -87,11 +87,11 @@ void EntryViewSentenceCardSection::translateUI()
 
 void EntryViewSentenceCardSection::cleanup(void)
 {
-    for (const auto &card : _sentenceCards) {
-        _sentenceCardsLayout->removeWidget(card);
-        delete card;
+    for (size_t i = 0; i < _sentenceCardsInUse; i++) {
+        _sentenceCardsLayout->removeWidget(_sentenceCards[i]);
+        _sentenceCards[i]->hide();
     }
-    _sentenceCards.clear();
+    _sentenceCardsInUse = 0;
     _sentenceCardsLayout->removeWidget(_viewAllSentencesButton);
     _sentenceCardsLayout->setContentsMargins(0, 0, 0, 0);
 }
@@ -228,10 +228,16 @@ void EntryViewSentenceCardSection::updateUI(
 
     emit addingCards();
     for (const auto &item : samples) {
-        _sentenceCards.push_back(new SentenceCardWidget{this});
-        _sentenceCards.back()->displaySentences(item.second);
+        // Re-bind cards left over from the previous entry before creating
+        // new ones
+        if (_sentenceCardsInUse == _sentenceCards.size()) {
+            _sentenceCards.push_back(new SentenceCardWidget{this});
+        }
+        SentenceCardWidget *card = _sentenceCards[_sentenceCardsInUse++];
+        card->displaySentences(item.second);
+        card->show();
 
-        _sentenceCardsLayout->addWidget(_sentenceCards.back(), Qt::AlignHCenter);
+        _sentenceCardsLayout->addWidget(card, Qt::AlignHCenter);
     }
 
     _sentenceCardsLayout->addWidget(_viewAllSentencesButton);
@@ -330,17 +336,17 @@ void EntryViewSentenceCardSection::openSentenceWindow(
 
 // Given some sourceSentences, returns a set of five (or fewer) sentences from
 // each source that exists in the source sentence.
-std::unordered_map<std::string, std::vector<SourceSentence>>
-EntryViewSentenceCardSection::getSamplesForEachSource(
+sentenceSamples EntryViewSentenceCardSection::getSamplesForEachSource(
     const std::vector<SourceSentence> &sourceSentences) const
 {
-    std::unordered_map<std::string, std::vector<SourceSentence>> samples;
+    sentenceSamples samples;
 
     for (const auto &sourceSentence : sourceSentences) {
         for (const auto &sentenceSet : sourceSentence.getSentenceSets()) {
-            std::string source = sentenceSet.getSource();
+            std::vector<SourceSentence> &sourceSamples
+                = samples[sentenceSet.getInternedSource()];
 
-            if (samples[source].size() >= 2) {
+            if (sourceSamples.size() >= 2) {
                 continue;
             }
 
@@ -352,7 +358,7 @@ EntryViewSentenceCardSection::getSamplesForEachSource(
                                  sourceSentence.getPinyin(),
                                  std::vector<SentenceSet>{sentenceSet});
 
-            samples[source].push_back(sentence);
+            sourceSamples.push_back(sentence);
         }
     }
     return samples;
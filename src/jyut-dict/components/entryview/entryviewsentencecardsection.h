@@ -6,6 +6,7 @@
 #include "logic/database/sqldatabasemanager.h"
 #include "logic/search/isearchobserver.h"
 #include "logic/search/sqlsearch.h"
+#include "logic/utils/internedstring.h"
 
 #include <QEvent>
 #include <QString>
@@ -20,9 +21,11 @@
 
 // The EntryViewSentenceCardSection displays cards for each set of sentences,
 // where each set of sentences belongs to a particular source.
+// Cards are reused between entries; only the first _sentenceCardsInUse cards
+// are shown.
 
 using sentenceSamples
-    = std::unordered_map<std::string, std::vector<SourceSentence>>;
+    = std::unordered_map<InternedString, std::vector<SourceSentence>>;
 
 class EntryViewSentenceCardSection : public QWidget, public ISearchObserver
 {
@@ -50,7 +53,7 @@ private:
     std::mutex layoutMutex;
     std::mutex updateMutex;
 
-    std::unordered_map<std::string, std::vector<SourceSentence>>
+    sentenceSamples
     getSamplesForEachSource(const std::vector<SourceSentence> &sourceSentences) const;
 
     std::shared_ptr<SQLDatabaseManager> _manager;
@@ -69,6 +72,7 @@ private:
     QVBoxLayout *_sentenceCardsLayout;
     LoadingWidget *_loadingWidget;
     std::vector<SentenceCardWidget *> _sentenceCards;
+    size_t _sentenceCardsInUse = 0;
     QToolButton *_viewAllSentencesButton;
 
 signals:
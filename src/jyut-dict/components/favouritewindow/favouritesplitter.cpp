@@ -17,6 +17,7 @@ FavouriteSplitter::FavouriteSplitter(std::shared_ptr<SQLUserDataUtils> sqlUserUt
     : QSplitter(parent)
     , _sqlUserUtils{sqlUserUtils}
     , _manager{manager}
+    , _sqlSearch{std::make_shared<SQLSearch>(manager)}
 {
     setupUI();
     translateUI();
@@ -57,7 +58,7 @@ void FavouriteSplitter::setupUI()
     _entryScrollArea = new EntryScrollArea{_sqlUserUtils, _manager, this};
     _resultListView = new ResultListView{this};
 
-    _model = new ResultListModel{_sqlUserUtils, {}, true, this};
+    _model = new ResultListModel{_sqlUserUtils, _sqlSearch, {}, true, this};
     _resultListView->setModel(_model);
 
     addWidget(_resultListView);
@@ -166,7 +167,8 @@ void FavouriteSplitter::prepareEntry(Entry &entry)
 
 void FavouriteSplitter::handleClick(const QModelIndex &selection)
 {
-    Entry entry = qvariant_cast<Entry>(selection.data());
+    Entry entry = qvariant_cast<Entry>(
+        selection.data(ResultListModel::EntryRole));
     bool isWelcomeEntry = entry.isWelcome();
     bool isEmptyEntry = entry.isEmpty();
     if (isWelcomeEntry || isEmptyEntry) {
@@ -179,7 +181,8 @@ void FavouriteSplitter::handleClick(const QModelIndex &selection)
 
 void FavouriteSplitter::handleDoubleClick(const QModelIndex &selection)
 {
-    Entry entry = qvariant_cast<Entry>(selection.data());
+    Entry entry = qvariant_cast<Entry>(
+        selection.data(ResultListModel::EntryRole));
     bool isWelcomeEntry = entry.isWelcome();
     bool isEmptyEntry = entry.isEmpty();
     if (isWelcomeEntry || isEmptyEntry) {
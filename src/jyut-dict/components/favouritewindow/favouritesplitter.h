@@ -5,6 +5,7 @@
 #include "logic/database/sqldatabasemanager.h"
 #include "logic/database/sqluserdatautils.h"
 #include "logic/entry/entry.h"
+#include "logic/search/sqlsearch.h"
 
 #include <QAbstractListModel>
 #include <QEvent>
@@ -47,6 +48,8 @@ private:
 
     std::shared_ptr<SQLUserDataUtils> _sqlUserUtils;
     std::shared_ptr<SQLDatabaseManager> _manager;
+    // Only used by the model to look up the entries of saved words
+    std::shared_ptr<SQLSearch> _sqlSearch;
 
     QAbstractListModel *_model;
     EntryScrollArea *_entryScrollArea;
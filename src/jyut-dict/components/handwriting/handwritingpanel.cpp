@@ -23,6 +23,13 @@ void HandwritingPanel::clearPanel(void)
     update();
 }
 
+void HandwritingPanel::setGrid(int rows, int columns)
+{
+    _rows = rows;
+    _columns = columns;
+    update();
+}
+
 void HandwritingPanel::mousePressEvent(QMouseEvent *event)
 {
     if (event->button() == Qt::RightButton) {
@@ -65,6 +72,16 @@ void HandwritingPanel::paintEvent(QPaintEvent *event)
     QPainter painter{this};
     painter.drawPixmap(0, 0, _pixmap);
 
+    painter.setPen({palette().mid().color(), 1.0, Qt::DashLine});
+    for (int column = 1; column < _columns; ++column) {
+        int x = width() * column / _columns;
+        painter.drawLine(x, 0, x, height());
+    }
+    for (int row = 1; row < _rows; ++row) {
+        int y = height() * row / _rows;
+        painter.drawLine(0, y, width(), y);
+    }
+
     QStyleOption opt;
     opt.initFrom(this);
     style()->drawPrimitive(QStyle::PE_Widget, &opt, &painter, this);
@@ -19,6 +19,7 @@ public:
     explicit HandwritingPanel(QWidget *parent = nullptr);
 
     void clearPanel(void);
+    void setGrid(int rows, int columns);
 
 protected:
     void mousePressEvent(QMouseEvent *event) override;
@@ -34,6 +35,11 @@ private:
     QPixmap _pixmap;
     QPoint _lastPos;
 
+    // Guides for writing one character per cell; not part of the pixmap, so
+    // that they survive clearing it
+    int _rows = 1;
+    int _columns = 1;
+
 signals:
     void pixmapDimensions(int width, int height);
 
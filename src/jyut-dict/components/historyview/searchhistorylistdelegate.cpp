@@ -60,11 +60,7 @@ void SearchHistoryListDelegate::paint(QPainter *painter,
     QRect r = option.rect;
     QRect boundingRect;
     QFont font = painter->font();
-    int interfaceSize = static_cast<int>(
-        _settings
-            ->value("Interface/size",
-                    QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-            .value<Settings::InterfaceSize>());
+    int interfaceSize = static_cast<int>(getInterfaceSize());
     int h4FontSize = Settings::h4FontSize.at(
         static_cast<unsigned long>(interfaceSize - 1));
     int bodyFontSize = Settings::bodyFontSize.at(
@@ -204,11 +200,7 @@ QSize SearchHistoryListDelegate::sizeHint(const QStyleOptionViewItem &option,
         = qvariant_cast<searchTermHistoryItem>(index.data());
     bool isEmptyPair = (pair.second == -1);
 
-    Settings::InterfaceSize interfaceSize
-        = _settings
-              ->value("Interface/size",
-                      QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-              .value<Settings::InterfaceSize>();
+    Settings::InterfaceSize interfaceSize = getInterfaceSize();
 
     if (isEmptyPair) {
 #ifdef Q_OS_MAC
@@ -317,3 +309,20 @@ QSize SearchHistoryListDelegate::sizeHint(const QStyleOptionViewItem &option,
     // never reach here.
     return QSize(100, 100);
 }
+
+void SearchHistoryListDelegate::invalidateCache(void)
+{
+    _interfaceSize.reset();
+}
+
+Settings::InterfaceSize SearchHistoryListDelegate::getInterfaceSize(void) const
+{
+    if (!_interfaceSize) {
+        _interfaceSize
+            = _settings
+                  ->value("Interface/size",
+                          QVariant::fromValue(Settings::InterfaceSize::NORMAL))
+                  .value<Settings::InterfaceSize>();
+    }
+    return *_interfaceSize;
+}
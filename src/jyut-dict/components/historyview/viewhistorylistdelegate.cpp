@@ -94,11 +94,7 @@ void ViewHistoryListDelegate::paint(QPainter *painter,
     QRect r = option.rect;
     QRect boundingRect;
     QFont font = painter->font();
-    int interfaceSize = static_cast<int>(
-        _settings
-            ->value("Interface/size",
-                    QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-            .value<Settings::InterfaceSize>());
+    int interfaceSize = static_cast<int>(getInterfaceSize());
     int h4FontSize = Settings::h4FontSize.at(
         static_cast<unsigned long>(interfaceSize - 1));
     int bodyFontSize = Settings::bodyFontSize.at(
@@ -243,11 +239,7 @@ QSize ViewHistoryListDelegate::sizeHint(const QStyleOptionViewItem &option,
     Entry entry = qvariant_cast<Entry>(index.data());
     bool isEmptyEntry = entry.isEmpty();
 
-    Settings::InterfaceSize interfaceSize
-        = _settings
-              ->value("Interface/size",
-                      QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-              .value<Settings::InterfaceSize>();
+    Settings::InterfaceSize interfaceSize = getInterfaceSize();
 
     if (isEmptyEntry) {
 #ifdef Q_OS_MAC
@@ -380,3 +372,20 @@ QSize ViewHistoryListDelegate::sizeHint(const QStyleOptionViewItem &option,
     // never reach here.
     return QSize(100, 100);
 }
+
+void ViewHistoryListDelegate::invalidateCache(void)
+{
+    _interfaceSize.reset();
+}
+
+Settings::InterfaceSize ViewHistoryListDelegate::getInterfaceSize(void) const
+{
+    if (!_interfaceSize) {
+        _interfaceSize
+            = _settings
+                  ->value("Interface/size",
+                          QVariant::fromValue(Settings::InterfaceSize::NORMAL))
+                  .value<Settings::InterfaceSize>();
+    }
+    return *_interfaceSize;
+}
@@ -1,6 +1,8 @@
 #ifndef VIEWHISTORYLISTDELEGATE_H
 #define VIEWHISTORYLISTDELEGATE_H
 
+#include "logic/settings/settings.h"
+
 #include <QModelIndex>
 #include <QPainter>
 #include <QSettings>
@@ -9,6 +11,7 @@
 #include <QWidget>
 
 #include <memory>
+#include <optional>
 
 // The ViewHistoryListDelegate is responsible for painting elements in the
 // ViewHistoryListView
@@ -26,8 +29,15 @@ public:
     QSize sizeHint(const QStyleOptionViewItem &option,
                        const QModelIndex &index) const override;
 
+    void invalidateCache(void);
+
 private:
+    Settings::InterfaceSize getInterfaceSize(void) const;
+
     std::unique_ptr<QSettings> _settings;
+    // Read once rather than on every paint and size hint; cleared by
+    // invalidateCache() when the settings change
+    mutable std::optional<Settings::InterfaceSize> _interfaceSize;
 };
 
 #endif // VIEWHISTORYLISTDELEGATE_H
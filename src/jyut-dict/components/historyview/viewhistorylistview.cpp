@@ -17,6 +17,11 @@ ViewHistoryListView::ViewHistoryListView(QWidget *parent)
     setItemDelegate(_delegate);
 
     setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+
+    // Every row is the same height (the only exception is the placeholder
+    // row, which is always alone), so only the first row's size hint is
+    // ever needed
+    setUniformItemSizes(true);
     connect(qApp,
             &QGuiApplication::applicationStateChanged,
             this,
@@ -38,6 +43,7 @@ void ViewHistoryListView::wheelEvent(QWheelEvent *event)
 
 void ViewHistoryListView::paintWithApplicationState()
 {
+    static_cast<ViewHistoryListDelegate *>(_delegate)->invalidateCache();
     viewport()->update();         // Forces repaint of viewing area
     scheduleDelayedItemsLayout(); // Forces items to resize themselves
 }
@@ -22,7 +22,7 @@ MainSplitter::MainSplitter(std::shared_ptr<SQLUserDataUtils> sqlUserUtils,
 
     _entryScrollArea = new EntryScrollArea{sqlUserUtils, manager, this};
     _resultListView = new ResultListView{this};
-    _model = new ResultListModel{sqlSearch, {}, false, this};
+    _model = new ResultListModel{sqlSearch, sqlSearch, {}, false, this};
     _resultListView->setModel(_model);
 
     addWidget(_resultListView);
@@ -240,7 +240,8 @@ void MainSplitter::handleModelReset(void)
 
 void MainSplitter::handleClick(const QModelIndex &selection)
 {
-    Entry entry = qvariant_cast<Entry>(selection.data());
+    Entry entry = qvariant_cast<Entry>(
+        selection.data(ResultListModel::EntryRole));
     bool isWelcomeEntry = entry.isWelcome();
     bool isEmptyEntry = entry.isEmpty();
     if (isWelcomeEntry || isEmptyEntry) {
@@ -253,7 +254,8 @@ void MainSplitter::handleClick(const QModelIndex &selection)
 
 void MainSplitter::handleDoubleClick(const QModelIndex &selection)
 {
-    Entry entry = qvariant_cast<Entry>(selection.data());
+    Entry entry = qvariant_cast<Entry>(
+        selection.data(ResultListModel::EntryRole));
     bool isWelcomeEntry = entry.isWelcome();
     bool isEmptyEntry = entry.isEmpty();
     if (isWelcomeEntry || isEmptyEntry) {
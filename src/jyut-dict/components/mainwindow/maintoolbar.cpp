@@ -14,17 +14,23 @@
 
 #include <QGuiApplication>
 
-MainToolBar::MainToolBar(std::shared_ptr<SQLSearch> sqlSearch,
-                         std::shared_ptr<SQLUserHistoryUtils> sqlHistoryUtils,
-                         QWidget *parent) : QToolBar(parent)
+MainToolBar::MainToolBar(
+    std::shared_ptr<SQLSearch> sqlSearch,
+    std::shared_ptr<SQLUserHistoryUtils> sqlHistoryUtils,
+    std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils,
+    QWidget *parent)
+    : QToolBar(parent)
 {
     setContextMenuPolicy(Qt::PreventContextMenu);
 
     _searchOptions = std::make_shared<SearchOptionsMediator>();
     _settings = Settings::getSettings(this);
 
-    _searchBar
-        = new SearchLineEdit(_searchOptions, sqlSearch, sqlHistoryUtils, this);
+    _searchBar = new SearchLineEdit(_searchOptions,
+                                    sqlSearch,
+                                    sqlHistoryUtils,
+                                    sqlHandwritingUtils,
+                                    this);
     _searchOptions->registerLineEdit(_searchBar);
 
     _optionsBox = new SearchOptionsRadioGroupBox(_searchOptions,
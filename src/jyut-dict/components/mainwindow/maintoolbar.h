@@ -3,6 +3,7 @@
 
 #include "components/mainwindow/searchlineedit.h"
 #include "components/mainwindow/searchoptionsradiogroupbox.h"
+#include "logic/database/sqlhandwritingutils.h"
 #include "logic/database/sqluserhistoryutils.h"
 #include "logic/search/isearchoptionsmediator.h"
 #include "logic/search/sqlsearch.h"
@@ -27,9 +28,11 @@ class MainToolBar : public QToolBar
 {
     Q_OBJECT
 public:
-    explicit MainToolBar(std::shared_ptr<SQLSearch> sqlSearch,
-                         std::shared_ptr<SQLUserHistoryUtils> sqlHistoryUtils,
-                         QWidget *parent = nullptr);
+    explicit MainToolBar(
+        std::shared_ptr<SQLSearch> sqlSearch,
+        std::shared_ptr<SQLUserHistoryUtils> sqlHistoryUtils,
+        std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils,
+        QWidget *parent = nullptr);
 
     void changeEvent(QEvent *event) override;
     void focusInEvent(QFocusEvent *event) override;
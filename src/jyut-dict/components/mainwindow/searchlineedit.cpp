@@ -1,5 +1,6 @@
 #include "searchlineedit.h"
 
+#include "logic/search/searchconfig.h"
 #include "logic/settings/settings.h"
 #include "logic/settings/settingsutils.h"
 #include "logic/utils/utils_qt.h"
@@ -22,11 +23,13 @@ SearchLineEdit::SearchLineEdit(
     std::shared_ptr<ISearchOptionsMediator> mediator,
     std::shared_ptr<ISearch> sqlSearch,
     std::shared_ptr<SQLUserHistoryUtils> sqlHistoryUtils,
+    std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils,
     QWidget *parent)
     : QLineEdit(parent)
     , _mediator{mediator}
     , _search{sqlSearch}
     , _sqlHistoryUtils{sqlHistoryUtils}
+    , _sqlHandwritingUtils{sqlHandwritingUtils}
 {
     _settings = Settings::getSettings(this);
     _timer = new QTimer{this};
@@ -263,7 +266,7 @@ void SearchLineEdit::startHandwriting(void)
 {
     checkClearVisibility();
 
-    _handwritingWindow = new HandwritingWindow{this};
+    _handwritingWindow = new HandwritingWindow{_sqlHandwritingUtils, this};
     _handwritingWindow->setAttribute(Qt::WA_DeleteOnClose);
     _handwritingWindow->setFocus();
     _handwritingWindow->show();
@@ -360,7 +363,7 @@ void SearchLineEdit::addSearchTermToHistory(SearchParameters parameters) const
 void SearchLineEdit::searchTriggered(void)
 {
     checkClearVisibility();
-    if (_settings->value("Search/autoDetectLanguage", QVariant{true}).toBool()) {
+    if (SearchConfigUtils::getSearchConfig()->autoDetectLanguage) {
         _search->searchAutoDetect(text().trimmed());
         addSearchTermToHistory(SearchParameters::AUTO_DETECT);
     } else {
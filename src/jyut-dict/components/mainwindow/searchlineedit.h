@@ -2,6 +2,7 @@
 #define SEARCHLINEEDIT_H
 
 #include "components/mainwindow/isearchlineedit.h"
+#include "logic/database/sqlhandwritingutils.h"
 #include "logic/database/sqluserhistoryutils.h"
 #include "logic/search/isearch.h"
 #include "logic/search/isearchoptionsmediator.h"
@@ -27,10 +28,12 @@ class SearchLineEdit : public QLineEdit, public ISearchLineEdit
     Q_OBJECT
 
 public:
-    explicit SearchLineEdit(std::shared_ptr<ISearchOptionsMediator> mediator,
-                            std::shared_ptr<ISearch> manager,
-                            std::shared_ptr<SQLUserHistoryUtils> sqlHistoryUtils,
-                            QWidget *parent = nullptr);
+    explicit SearchLineEdit(
+        std::shared_ptr<ISearchOptionsMediator> mediator,
+        std::shared_ptr<ISearch> manager,
+        std::shared_ptr<SQLUserHistoryUtils> sqlHistoryUtils,
+        std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils,
+        QWidget *parent = nullptr);
 
     void changeEvent(QEvent *event) override;
     void focusInEvent(QFocusEvent *event) override;
@@ -57,6 +60,7 @@ private:
     std::shared_ptr<ISearchOptionsMediator> _mediator;
     std::shared_ptr<ISearch> _search;
     std::shared_ptr<SQLUserHistoryUtils> _sqlHistoryUtils;
+    std::shared_ptr<SQLHandwritingUtils> _sqlHandwritingUtils;
     std::unique_ptr<QSettings> _settings;
 
     QAction *_searchLineEdit;
@@ -87,11 +87,7 @@ void SentenceResultListDelegate::paint(QPainter *painter,
     QRect r = option.rect;
     QRect boundingRect;
     QFont font = painter->font();
-    int interfaceSize = static_cast<int>(
-        _settings
-            ->value("Interface/size",
-                    QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-            .value<Settings::InterfaceSize>());
+    int interfaceSize = static_cast<int>(getInterfaceSize());
     int h4FontSize = Settings::h4FontSize.at(
         static_cast<unsigned long>(interfaceSize - 1));
     int bodyFontSize = Settings::bodyFontSize.at(
@@ -263,11 +259,7 @@ QSize SentenceResultListDelegate::sizeHint(const QStyleOptionViewItem &option,
     (void) (option);
     (void) (index);
 
-    Settings::InterfaceSize interfaceSize
-        = _settings
-              ->value("Interface/size",
-                      QVariant::fromValue(Settings::InterfaceSize::NORMAL))
-              .value<Settings::InterfaceSize>();
+    Settings::InterfaceSize interfaceSize = getInterfaceSize();
 #if defined(Q_OS_LINUX) || defined(Q_OS_WIN)
     switch (interfaceSize) {
     case Settings::InterfaceSize::SMALLER: {
@@ -310,3 +302,20 @@ QSize SentenceResultListDelegate::sizeHint(const QStyleOptionViewItem &option,
     // never reach here.
     return QSize(100, 100);
 }
+
+void SentenceResultListDelegate::invalidateCache(void)
+{
+    _interfaceSize.reset();
+}
+
+Settings::InterfaceSize SentenceResultListDelegate::getInterfaceSize(void) const
+{
+    if (!_interfaceSize) {
+        _interfaceSize
+            = _settings
+                  ->value("Interface/size",
+                          QVariant::fromValue(Settings::InterfaceSize::NORMAL))
+                  .value<Settings::InterfaceSize>();
+    }
+    return *_interfaceSize;
+}
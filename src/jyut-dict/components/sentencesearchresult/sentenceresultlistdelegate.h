@@ -1,6 +1,8 @@
 #ifndef SENTENCERESULTLISTDELEGATE_H
 #define SENTENCERESULTLISTDELEGATE_H
 
+#include "logic/settings/settings.h"
+
 #include <QModelIndex>
 #include <QPainter>
 #include <QSettings>
@@ -9,6 +11,7 @@
 #include <QWidget>
 
 #include <memory>
+#include <optional>
 
 // The SentenceResultListDelegate is responsible for painting elements in the
 // SentenceResultListView (basically, a bunch of sentence objects)
@@ -27,8 +30,15 @@ public:
     QSize sizeHint(const QStyleOptionViewItem &option,
                    const QModelIndex &index) const override;
 
+    void invalidateCache(void);
+
 private:
+    Settings::InterfaceSize getInterfaceSize(void) const;
+
     std::unique_ptr<QSettings> _settings;
+    // Read once rather than on every paint and size hint; cleared by
+    // invalidateCache() when the settings change
+    mutable std::optional<Settings::InterfaceSize> _interfaceSize;
 };
 
 #endif // SENTENCERESULTLISTDELEGATE_H
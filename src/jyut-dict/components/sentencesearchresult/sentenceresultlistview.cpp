@@ -18,6 +18,10 @@ SentenceResultListView::SentenceResultListView(QWidget *parent)
     setItemDelegate(_delegate);
 
     setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+
+    // Every row is the same height, so only the first row's size hint is
+    // ever needed
+    setUniformItemSizes(true);
     connect(qApp,
             &QGuiApplication::applicationStateChanged,
             this,
@@ -39,6 +43,7 @@ void SentenceResultListView::wheelEvent(QWheelEvent *event)
 
 void SentenceResultListView::paintWithApplicationState()
 {
+    static_cast<SentenceResultListDelegate *>(_delegate)->invalidateCache();
     viewport()->update();         // Forces repaint of viewing area
     scheduleDelayedItemsLayout(); // Forces items to resize themselves
 }
@@ -3,6 +3,7 @@
 #include "dialogs/resetsettingsdialog.h"
 #include "logic/database/sqldatabasemanager.h"
 #include "logic/entry/entryspeaker.h"
+#include "logic/search/searchconfig.h"
 #include "logic/settings/settingsutils.h"
 #include "logic/strings/strings.h"
 #ifdef Q_OS_MAC
@@ -553,6 +554,7 @@ void AdvancedTab::setLanguageComboboxDefault(QComboBox &combobox)
 void AdvancedTab::resetSettings(QSettings &settings)
 {
     Settings::clearSettings(settings);
+    SearchConfigUtils::refreshSearchConfig(settings);
 
     setUpdateCheckboxDefault(*_updateCheckbox);
 #if defined(Q_OS_LINUX) || defined(Q_OS_WIN)
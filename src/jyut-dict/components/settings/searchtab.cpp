@@ -1,5 +1,6 @@
 #include "searchtab.h"
 
+#include "logic/search/searchconfig.h"
 #include "logic/settings/settingsutils.h"
 #include "logic/strings/strings.h"
 #ifdef Q_OS_MAC
@@ -236,6 +237,7 @@ void SearchTab::initializeSearchAutoDetectCheckbox(QCheckBox &checkbox)
     connect(&checkbox, &QCheckBox::checkStateChanged, this, [&]() {
         _settings->setValue("Search/autoDetectLanguage", checkbox.checkState());
         _settings->sync();
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         emit triggerSearch();
     });
 
@@ -253,6 +255,7 @@ void SearchTab::initializeFuzzyJyutping(QWidget &widget)
         _settings->setValue("Search/fuzzyJyutping",
                             _fuzzyJyutpingCheckbox->checkState());
         _settings->sync();
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         _dangerousFuzzyJyutpingCheckbox->setEnabled(
             _fuzzyJyutpingCheckbox->checkState());
         emit triggerSearch();
@@ -275,6 +278,7 @@ void SearchTab::initializeDangerousFuzzyJyutping(QWidget &widget)
                     ->setValue("Search/dangerousFuzzyJyutping",
                                _dangerousFuzzyJyutpingCheckbox->checkState());
                 _settings->sync();
+                SearchConfigUtils::refreshSearchConfig(*_settings);
                 emit triggerSearch();
             });
     setDangerousFuzzyJyutpingCheckboxDefault(*_dangerousFuzzyJyutpingCheckbox);
@@ -291,6 +295,7 @@ void SearchTab::initializeFuzzyPinyin(QWidget &widget)
         _settings->setValue("Search/fuzzyPinyin",
                             _fuzzyPinyinCheckbox->checkState());
         _settings->sync();
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         emit triggerSearch();
     });
     setFuzzyPinyinCheckboxDefault(*_fuzzyPinyinCheckbox);
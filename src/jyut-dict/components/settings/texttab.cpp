@@ -341,6 +341,7 @@ void TextTab::initializeJyutpingColourWidget(QWidget &jyutpingColourWidget)
                 = static_cast<unsigned long>(sender->property("tone").toInt());
             Settings::jyutpingToneColours[index]
                 = newColour.name().toStdString();
+            Settings::toneColoursVersion++;
             sender->setStyleSheet(QString{COLOUR_BUTTON_STYLE}.arg(
                 Settings::jyutpingToneColours[index].c_str()));
 
@@ -374,6 +375,7 @@ void TextTab::initializePinyinColourWidget(QWidget &pinyinColourWidget)
             = color.name().toStdString();
     }
     _settings->endArray();
+    Settings::toneColoursVersion++;
 
     // Create widgets
     QGridLayout *pinyinLayout = new QGridLayout{&pinyinColourWidget};
@@ -402,6 +404,7 @@ void TextTab::initializePinyinColourWidget(QWidget &pinyinColourWidget)
             std::vector<std::string>::size_type index
                 = static_cast<unsigned long>(sender->property("tone").toInt());
             Settings::pinyinToneColours[index] = newColour.name().toStdString();
+            Settings::toneColoursVersion++;
             sender->setStyleSheet(QString{COLOUR_BUTTON_STYLE}.arg(
                 Settings::pinyinToneColours[index].c_str()));
 
@@ -500,6 +503,7 @@ void TextTab::resetSettings(void)
 {
     Settings::jyutpingToneColours = Settings::defaultJyutpingToneColours;
     Settings::pinyinToneColours = Settings::defaultPinyinToneColours;
+    Settings::toneColoursVersion++;
 
     setCharacterComboBoxDefault(*_characterCombobox);
 
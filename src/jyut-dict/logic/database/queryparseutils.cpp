@@ -7,7 +7,9 @@
 
 namespace QueryParseUtils {
 
-std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions)
+std::vector<Entry> parseEntries(QSqlQuery &query,
+                                bool parseDefinitions,
+                                const CancellationToken &token)
 {
     std::vector<Entry> entries;
 
@@ -19,6 +21,10 @@ std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions)
                 query.record().indexOf("definitions") : 0;
 
     while (query.next()) {
+        if (token.isCancelled()) {
+            return {};
+        }
+
         // Get fields from table
         std::string simplified
             = query.value(simplifiedIndex).toString().toStdString();
@@ -27,9 +33,13 @@ std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions)
         std::string jyutping
             = query.value(jyutpingIndex).toString().toStdString();
         std::string pinyin = query.value(pinyinIndex).toString().toStdString();
-        std::string definition
-            = query.value(definitionIndex).toString().toStdString();
-        if (definition.empty()) {
+        // Keep the definitions column as UTF-8 bytes; it is handed straight
+        // to the JSON parser, so round-tripping it through std::string and
+        // back to a QString would only copy it twice more
+        QByteArray definition = query.value(definitionIndex)
+                                    .toString()
+                                    .toUtf8();
+        if (definition.isEmpty()) {
             continue;
         }
 
@@ -38,30 +48,43 @@ std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions)
 
         if (parseDefinitions) {
             // Parse JSON returned by query
-            QJsonDocument doc = QJsonDocument::fromJson(
-                QString::fromStdString(definition).toUtf8());
+            QJsonDocument doc = QJsonDocument::fromJson(definition);
             // Each object in the array represents a group of definitions
             // that are all from the same source
             // We can ignore the C++ range-loop error because Qt no longer supports
             // using foreach with QJsonValue
-            for (const QJsonValue definitionGroup : doc.array()) {
-                std::string sourceName = definitionGroup["source"].toString().toStdString();
+            //
+            // Every nested vector is sized up front from its JSON array and
+            // every parsed string is moved (never copied) into its parent,
+            // so each string is allocated exactly once per entry
+            const QJsonArray definitionGroups = doc.array();
+            definitionsSets.reserve(definitionGroups.size());
+            for (const QJsonValue definitionGroup : definitionGroups) {
+                InternedString sourceName{
+                    definitionGroup["source"].toString().toStdString()};
+                const QJsonArray definitionsArray
+                    = definitionGroup["definitions"].toArray();
                 std::vector<Definition::Definition> definitions;
+                definitions.reserve(definitionsArray.size());
 
-                for (const QJsonValue definition :
-                     definitionGroup["definitions"].toArray()) {
+                for (const QJsonValue definition : definitionsArray) {
+                    const QJsonArray sentencesArray
+                        = definition["sentences"].toArray();
                     std::vector<SourceSentence> sentences;
-                    for (const QJsonValue sentence :
-                         definition["sentences"].toArray()) {
+                    sentences.reserve(sentencesArray.size());
+                    for (const QJsonValue sentence : sentencesArray) {
                         std::vector<SentenceSet> sentence_translations;
 
                         // Parse each sentence
                         if (!sentence.isNull()) {
                             std::vector<Sentence::TargetSentence> targetSentences;
                             if (!sentence["translations"].isNull()) {
+                                const QJsonArray translations
+                                    = sentence["translations"].toArray();
+                                targetSentences.reserve(translations.size());
                                 // Parse each of the sentence translations
                                 for (const QJsonValue translation :
-                                     sentence["translations"].toArray()) {
+                                     translations) {
                                     targetSentences.emplace_back(
                                         translation["sentence"]
                                             .toString()
@@ -71,7 +94,9 @@ std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions)
                                             .toStdString(),
                                         translation["direct"].toInt() == 1);
                                 }
-                                sentence_translations.emplace_back(sourceName, targetSentences);
+                                sentence_translations.emplace_back(
+                                    sourceName,
+                                    std::move(targetSentences));
                             }
 
                             sentences.emplace_back(sentence["language"].toString().toStdString(),
@@ -79,7 +104,7 @@ std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions)
                                                    sentence["traditional"].toString().toStdString(),
                                                    sentence["jyutping"].toString().toStdString(),
                                                    sentence["pinyin"].toString().toStdString(),
-                                                   sentence_translations);
+                                                   std::move(sentence_translations));
                         }
                     }
 
@@ -90,25 +115,26 @@ std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions)
                                              definition["label"]
                                                  .toString()
                                                  .toStdString(),
-                                             sentences);
+                                             std::move(sentences));
                 }
 
                 definitionsSets.emplace_back(sourceName,
-                                             definitions);
+                                             std::move(definitions));
             }
         }
 
-        entries.emplace_back(simplified,
-                             traditional,
-                             jyutping,
-                             pinyin,
-                             definitionsSets);
+        entries.emplace_back(std::move(simplified),
+                             std::move(traditional),
+                             std::move(jyutping),
+                             std::move(pinyin),
+                             std::move(definitionsSets));
     }
 
     return entries;
 }
 
-std::vector<SourceSentence> parseSentences(QSqlQuery &query)
+std::vector<SourceSentence> parseSentences(QSqlQuery &query,
+                                           const CancellationToken &token)
 {
     std::vector<SourceSentence> sentences;
 
@@ -121,6 +147,10 @@ std::vector<SourceSentence> parseSentences(QSqlQuery &query)
     int definitionSourceNameIndex = query.record().indexOf("sourcename");
 
     while (query.next()) {
+        if (token.isCancelled()) {
+            return {};
+        }
+
         // Get fields from table
         std::string simplified
             = query.value(simplifiedIndex).toString().toStdString();
@@ -131,23 +161,25 @@ std::vector<SourceSentence> parseSentences(QSqlQuery &query)
         std::string pinyin = query.value(pinyinIndex).toString().toStdString();
         std::string sourceLanguage
             = query.value(sourceLanguageIndex).toString().toStdString();
-        std::string combinedTargetSentencesData
-            = query.value(translationsIndex).toString().toStdString();
-        std::string definitionSourceName
-            = query.value(definitionSourceNameIndex).toString().toStdString();
+        QByteArray combinedTargetSentencesData
+            = query.value(translationsIndex).toString().toUtf8();
+        InternedString definitionSourceName{
+            query.value(definitionSourceNameIndex).toString().toStdString()};
 
         // Each sentence will have a vector of SentenceSets that represents
         // a group of translations that are from the same source
         std::vector<SentenceSet> sentence_translation_sets;
 
-        if (!combinedTargetSentencesData.empty()) {
+        if (!combinedTargetSentencesData.isEmpty()) {
             // Parse JSON returned by query
             QJsonDocument doc = QJsonDocument::fromJson(
-                QString::fromStdString(combinedTargetSentencesData).toUtf8());
+                combinedTargetSentencesData);
+            const QJsonArray translationSets = doc.array();
+            sentence_translation_sets.reserve(translationSets.size());
             // Parse each of the sentence translation groups
-            for (const QJsonValue translation_set : doc.array()) {
-                std::string sentenceSourceName
-                    = translation_set["source"].toString().toStdString();
+            for (const QJsonValue translation_set : translationSets) {
+                InternedString sentenceSourceName{
+                    translation_set["source"].toString().toStdString()};
 
                 // If the sentence has the source it comes from, use it
                 // Otherwise, assume it comes from the same source as the
@@ -159,7 +191,6 @@ std::vector<SourceSentence> parseSentences(QSqlQuery &query)
                 for (const QJsonValue translation :
                      translation_set["translations"].toArray()) {
                     // Parse each translation in this group
-                    std::vector<Sentence::TargetSentence> targetSentences;
                     sentence_translation_sets.back().pushSentence(
                         {translation["sentence"].toString().toStdString(),
                          translation["language"].toString().toStdString(),
@@ -168,12 +199,12 @@ std::vector<SourceSentence> parseSentences(QSqlQuery &query)
             }
         }
 
-        sentences.emplace_back(sourceLanguage,
-                               simplified,
-                               traditional,
-                               jyutping,
-                               pinyin,
-                               sentence_translation_sets);
+        sentences.emplace_back(std::move(sourceLanguage),
+                               std::move(simplified),
+                               std::move(traditional),
+                               std::move(jyutping),
+                               std::move(pinyin),
+                               std::move(sentence_translation_sets));
     }
 
     return sentences;
@@ -203,7 +234,7 @@ std::vector<searchTermHistoryItem> parseHistoryItems(QSqlQuery &query)
         std::string text = query.value(textIndex).toString().toStdString();
         int options = query.value(optionsIndex).toInt();
 
-        results.push_back(searchTermHistoryItem{text, options});
+        results.push_back(searchTermHistoryItem{std::move(text), options});
     }
 
     return results;
@@ -2,6 +2,7 @@
 #define QUERYPARSEUTILS_H
 
 #include "logic/entry/entry.h"
+#include "logic/search/cancellationtoken.h"
 #include "logic/sentence/sourcesentence.h"
 
 #include <QSqlQuery>
@@ -15,8 +16,15 @@ namespace QueryParseUtils {
 
 using searchTermHistoryItem = std::pair<std::string, long>;
 
-std::vector<Entry> parseEntries(QSqlQuery &query, bool parseDefinitions = true);
-std::vector<SourceSentence> parseSentences(QSqlQuery &query);
+// If the token is cancelled while parsing, parsing stops and an empty
+// result set is returned.
+std::vector<Entry> parseEntries(QSqlQuery &query,
+                                bool parseDefinitions = true,
+                                const CancellationToken &token
+                                = CancellationToken{});
+std::vector<SourceSentence> parseSentences(QSqlQuery &query,
+                                           const CancellationToken &token
+                                           = CancellationToken{});
 
 bool parseExistence(QSqlQuery &query);
 std::vector<searchTermHistoryItem> parseHistoryItems(QSqlQuery &query);
@@ -1,5 +1,7 @@
 #include "sqldatabaseutils.h"
 
+#include "logic/utils/internedstring.h"
+
 #include <QtSql>
 
 #include <chrono>
@@ -323,6 +325,11 @@ bool SQLDatabaseUtils::readSources(
         std::string sourceshortname
             = query.value(sourceshortnameIndex).toString().toStdString();
 
+        // Seed the intern pool so that parsing results never has to take
+        // the pool's write lock for a known source
+        (void) InternedString{sourcename};
+        (void) InternedString{sourceshortname};
+
         sources.push_back(
             std::pair<std::string, std::string>(sourcename, sourceshortname));
     }
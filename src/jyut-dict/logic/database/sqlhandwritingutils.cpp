@@ -0,0 +1,96 @@
+#include "sqlhandwritingutils.h"
+
+#include <QSqlQuery>
+#include <QStringList>
+#include <QVariant>
+
+#include <algorithm>
+
+namespace {
+// Candidates with ASCII characters are left out: no word in the dictionary
+// is written with them, and they could be mistaken for GLOB syntax.
+QStringList usableCandidates(const std::vector<std::string> &candidates)
+{
+    QStringList characters;
+    for (const auto &candidate : candidates) {
+        QString character = QString::fromStdString(candidate);
+        if (character.isEmpty()
+            || std::any_of(character.begin(),
+                           character.end(),
+                           [](QChar c) { return c.unicode() < 0x80; })) {
+            continue;
+        }
+        characters << character;
+    }
+    return characters;
+}
+} // namespace
+
+SQLHandwritingUtils::SQLHandwritingUtils(
+    std::shared_ptr<SQLDatabaseManager> manager)
+    : _manager{manager}
+{}
+
+std::vector<std::string> SQLHandwritingUtils::searchWords(
+    const std::vector<std::vector<std::string>> &candidates,
+    SearchParameters script,
+    int limit) const
+{
+    std::vector<std::string> words;
+    if (!_manager || candidates.empty() || limit <= 0) {
+        return words;
+    }
+
+    std::vector<QStringList> characters;
+    for (const auto &characterCandidates : candidates) {
+        characters.emplace_back(usableCandidates(characterCandidates));
+        if (characters.back().isEmpty()) {
+            return words;
+        }
+    }
+
+    // The rest of the word is matched with a character class for each
+    // character. The first character is spelled out in a pattern of its own
+    // for each candidate, so that every pattern has a literal prefix. Each
+    // pattern gets its own SELECT, since SQLite only turns a GLOB with a
+    // literal prefix into an index search when it is not part of an OR; the
+    // patterns joined with OR scan every entry instead. The search uses
+    // entries_simplified_idx for simplified, and the index that
+    // UNIQUE(traditional, simplified, pinyin, jyutping) creates for
+    // traditional, which starts with that column.
+    QString rest;
+    for (size_t i = 1; i < characters.size(); ++i) {
+        rest += "[" + characters[i].join("") + "]";
+    }
+
+    QString column = script == SearchParameters::SIMPLIFIED ? "simplified"
+                                                            : "traditional";
+    QStringList patterns;
+    for (qsizetype i = 0; i < characters.front().size(); ++i) {
+        patterns << QString{"SELECT %1 AS word, frequency "
+                            "FROM entries "
+                            "WHERE %1 GLOB ?"}
+                        .arg(column);
+    }
+
+    QSqlQuery query{_manager->getDatabase()};
+    query.prepare(QString{"SELECT word, "
+                          "  MAX(frequency) AS word_frequency "
+                          "FROM (%1) "
+                          "GROUP BY word "
+                          "ORDER BY word_frequency DESC, word "
+                          "LIMIT ?"}
+                      .arg(patterns.join(" UNION ALL ")));
+    for (const auto &character : characters.front()) {
+        query.addBindValue(character + rest);
+    }
+    query.addBindValue(limit);
+    query.setForwardOnly(true);
+    query.exec();
+
+    while (query.next()) {
+        words.emplace_back(query.value(0).toString().toStdString());
+    }
+
+    return words;
+}
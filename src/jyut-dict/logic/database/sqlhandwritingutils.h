@@ -0,0 +1,34 @@
+#ifndef SQLHANDWRITINGUTILS_H
+#define SQLHANDWRITINGUTILS_H
+
+#include "logic/database/sqldatabasemanager.h"
+#include "logic/search/searchparameters.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// The SQLHandwritingUtils class searches the dictionary for words that can be
+// written with the candidates recognized for each handwritten character.
+// Unlike the other database utilities, it searches synchronously, since it is
+// called from the thread that recognizes the characters.
+
+class SQLHandwritingUtils
+{
+public:
+    SQLHandwritingUtils(std::shared_ptr<SQLDatabaseManager> manager);
+
+    // candidates holds the candidates for each character of the word, in
+    // order. script must be SearchParameters::SIMPLIFIED or
+    // SearchParameters::TRADITIONAL. Returns at most limit words, most
+    // frequent first.
+    std::vector<std::string> searchWords(
+        const std::vector<std::vector<std::string>> &candidates,
+        SearchParameters script,
+        int limit) const;
+
+private:
+    std::shared_ptr<SQLDatabaseManager> _manager;
+};
+
+#endif // SQLHANDWRITINGUTILS_H
@@ -0,0 +1,184 @@
+#include "logic/database/sqldatabasemanager.h"
+#include "logic/database/sqlhandwritingutils.h"
+
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QtTest>
+
+namespace {
+constexpr auto dbCreateConnName = "dbCreateConn";
+} // namespace
+
+class TestSqlHandwritingUtils : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestSqlHandwritingUtils();
+    ~TestSqlHandwritingUtils();
+
+private slots:
+    void searchWordsTraditional();
+    void searchWordsSimplified();
+    void searchWordsOrderedByFrequency();
+    void searchWordsLimit();
+    void searchWordsNoResults();
+    void searchWordsIgnoresGlobSyntax();
+
+private:
+    void createDatabase(const QString &dbPath);
+
+    std::shared_ptr<SQLDatabaseManager> _manager;
+};
+
+TestSqlHandwritingUtils::TestSqlHandwritingUtils()
+{
+    _manager = std::make_shared<SQLDatabaseManager>();
+
+    createDatabase(_manager->getDictionaryDatabasePath());
+}
+
+TestSqlHandwritingUtils::~TestSqlHandwritingUtils()
+{
+    _manager->removeAllDatabaseConnections();
+    QFile::remove(_manager->getDictionaryDatabasePath());
+}
+
+void TestSqlHandwritingUtils::createDatabase(const QString &dbPath)
+{
+    QFile databaseFile{dbPath};
+    QDir databaseDir{QFileInfo{databaseFile.fileName()}.absolutePath()};
+    QCOMPARE(databaseDir.mkpath(
+                 QFileInfo{databaseFile.fileName()}.absolutePath()),
+             true);
+    if (databaseFile.exists()) {
+        QFile::remove(databaseFile.fileName());
+    }
+    QCOMPARE(databaseFile.open(QIODevice::ReadWrite), true);
+    QCOMPARE(databaseFile.exists(), true);
+    databaseFile.close();
+
+    QSqlDatabase::addDatabase("QSQLITE", dbCreateConnName);
+    QSqlDatabase::database(dbCreateConnName).setDatabaseName(dbPath);
+    QSqlDatabase::database(dbCreateConnName).open();
+    QSqlQuery query{QSqlDatabase::database(dbCreateConnName)};
+    query.exec("CREATE TABLE entries( "
+               "  entry_id INTEGER PRIMARY KEY, "
+               "  traditional TEXT, "
+               "  simplified TEXT, "
+               "  pinyin TEXT, "
+               "  jyutping TEXT, "
+               "  frequency REAL, "
+               "  UNIQUE(traditional, simplified, pinyin, jyutping) ON "
+               "    CONFLICT IGNORE "
+               ") ");
+    QCOMPARE(query.lastError().type(), QSqlError::NoError);
+    query.exec("CREATE INDEX entries_simplified_idx ON entries(simplified)");
+    QCOMPARE(query.lastError().type(), QSqlError::NoError);
+
+    query.exec("INSERT INTO entries (traditional, simplified, pinyin, "
+               "  jyutping, frequency) "
+               "VALUES "
+               "  ('一石二鳥', '一石二鸟', 'yi1 shi2 er4 niao3', "
+               "    'jat1 sek6 ji6 niu5', '2.50'), "
+               "  ('一石二鳥', '一石二鸟', 'yi1 dan4 er4 niao3', "
+               "    'jat1 daam3 ji6 niu5', '3.00'), "
+               "  ('一日三秋', '一日三秋', 'yi1 ri4 san1 qiu1', "
+               "    'jat1 jat6 saam1 cau1', '2.75'), "
+               "  ('一日', '一日', 'yi1 ri4', 'jat1 jat6', '5.00'), "
+               "  ('白雲', '白云', 'bai2 yun2', 'baak6 wan4', '4.00'), "
+               "  ('白雪', '白雪', 'bai2 xue3', 'baak6 syut3', '4.50'), "
+               "  ('百貨', '百货', 'bai3 huo4', 'baak3 fo3', '3.50')");
+    QCOMPARE(query.lastError().type(), QSqlError::NoError);
+}
+
+void TestSqlHandwritingUtils::searchWordsTraditional()
+{
+    SQLHandwritingUtils utils{_manager};
+
+    std::vector<std::string> words
+        = utils.searchWords({{"一", "二"}, {"石", "右"}, {"二"}, {"鳥", "烏"}},
+                            SearchParameters::TRADITIONAL,
+                            10);
+    QCOMPARE(words, std::vector<std::string>{"一石二鳥"});
+}
+
+void TestSqlHandwritingUtils::searchWordsSimplified()
+{
+    SQLHandwritingUtils utils{_manager};
+
+    std::vector<std::string> words
+        = utils.searchWords({{"白", "百"}, {"云", "雲"}},
+                            SearchParameters::SIMPLIFIED,
+                            10);
+    QCOMPARE(words, std::vector<std::string>{"白云"});
+}
+
+void TestSqlHandwritingUtils::searchWordsOrderedByFrequency()
+{
+    SQLHandwritingUtils utils{_manager};
+
+    // Words of a different length never match, and a word with several
+    // entries is ranked by its most frequent one
+    std::vector<std::string> words
+        = utils.searchWords({{"一"}, {"日", "石"}, {"三", "二"}, {"秋", "鳥"}},
+                            SearchParameters::TRADITIONAL,
+                            10);
+    QCOMPARE(words, (std::vector<std::string>{"一石二鳥", "一日三秋"}));
+
+    words = utils.searchWords({{"百", "白"}, {"雲", "雪", "貨"}},
+                              SearchParameters::TRADITIONAL,
+                              10);
+    QCOMPARE(words, (std::vector<std::string>{"白雪", "白雲", "百貨"}));
+}
+
+void TestSqlHandwritingUtils::searchWordsLimit()
+{
+    SQLHandwritingUtils utils{_manager};
+
+    std::vector<std::string> words
+        = utils.searchWords({{"百", "白"}, {"雲", "雪", "貨"}},
+                            SearchParameters::TRADITIONAL,
+                            2);
+    QCOMPARE(words, (std::vector<std::string>{"白雪", "白雲"}));
+}
+
+void TestSqlHandwritingUtils::searchWordsNoResults()
+{
+    SQLHandwritingUtils utils{_manager};
+
+    std::vector<std::string> words
+        = utils.searchWords({{"一"}, {"月"}},
+                            SearchParameters::TRADITIONAL,
+                            10);
+    QCOMPARE(words.empty(), true);
+
+    words = utils.searchWords({{"一"}, {}}, SearchParameters::TRADITIONAL, 10);
+    QCOMPARE(words.empty(), true);
+
+    words = utils.searchWords({}, SearchParameters::TRADITIONAL, 10);
+    QCOMPARE(words.empty(), true);
+}
+
+void TestSqlHandwritingUtils::searchWordsIgnoresGlobSyntax()
+{
+    SQLHandwritingUtils utils{_manager};
+
+    // Candidates that could be read as GLOB syntax are left out, instead of
+    // matching other words
+    std::vector<std::string> words
+        = utils.searchWords({{"白"}, {"*", "?", "]", "雲"}},
+                            SearchParameters::TRADITIONAL,
+                            10);
+    QCOMPARE(words, std::vector<std::string>{"白雲"});
+
+    words = utils.searchWords({{"白"}, {"*"}},
+                              SearchParameters::TRADITIONAL,
+                              10);
+    QCOMPARE(words.empty(), true);
+}
+
+QTEST_MAIN(TestSqlHandwritingUtils)
+
+#include "tst_sqlhandwritingutils.moc"
@@ -4,11 +4,12 @@
 
 #include <sstream>
 
-DefinitionsSet::DefinitionsSet(std::string source,
+DefinitionsSet::DefinitionsSet(InternedString source,
                                std::vector<Definition::Definition> definitions)
     : _source{source}
-    , _sourceShortString{DictionarySourceUtils::getSourceShortString(source)}
-    , _definitions{definitions}
+    , _sourceShortString{
+          DictionarySourceUtils::getSourceShortString(_source.str())}
+    , _definitions{std::move(definitions)}
 {
 
 }
@@ -47,19 +48,24 @@ void DefinitionsSet::generatePhonetic(CantoneseOptions cantoneseOptions,
     }
 }
 
-const std::string &DefinitionsSet::getSource() const
+InternedString DefinitionsSet::getInternedSource() const
 {
     return _source;
 }
 
+const std::string &DefinitionsSet::getSource() const
+{
+    return _source.str();
+}
+
 const std::string &DefinitionsSet::getSourceLongString() const
 {
-    return _source;
+    return _source.str();
 }
 
 const std::string &DefinitionsSet::getSourceShortString() const
 {
-    return _sourceShortString;
+    return _sourceShortString.str();
 }
 
 // getDefinitionSnippet() returns a string that shows the definitions contained
@@ -3,6 +3,7 @@
 
 #include "logic/entry/entryphoneticoptions.h"
 #include "logic/sentence/sourcesentence.h"
+#include "logic/utils/internedstring.h"
 
 #include <iostream>
 #include <span>
@@ -16,13 +17,15 @@ namespace Definition {
 struct Definition
 {
     std::string definitionContent;
-    std::string label;
+    InternedString label;
     std::vector<SourceSentence> sentences;
 
-    Definition(std::string definitionContent, std::string label, std::vector<SourceSentence> sentences):
-        definitionContent{definitionContent},
-        label{label},
-        sentences(sentences)
+    Definition(std::string definitionContent,
+               InternedString label,
+               std::vector<SourceSentence> sentences)
+        : definitionContent{std::move(definitionContent)}
+        , label{label}
+        , sentences(std::move(sentences))
     {}
 
     bool operator==(const Definition &other) const
@@ -40,7 +43,7 @@ class DefinitionsSet
 {
 public:
     DefinitionsSet() = delete;
-    DefinitionsSet(std::string source, std::vector<Definition::Definition> definitions);
+    DefinitionsSet(InternedString source, std::vector<Definition::Definition> definitions);
 
     friend std::ostream &operator<<(std::ostream &out,
                                     DefinitionsSet const &definitions);
@@ -55,6 +58,7 @@ public:
     void generatePhonetic(CantoneseOptions cantoneseOptions,
                           MandarinOptions mandarinOptions);
 
+    InternedString getInternedSource() const;
     const std::string &getSource() const;
     const std::string &getSourceLongString() const;
     const std::string &getSourceShortString() const;
@@ -62,8 +66,8 @@ public:
     std::span<const Definition::Definition> getDefinitions(void) const;
 
 private:
-    std::string _source;
-    std::string _sourceShortString;
+    InternedString _source;
+    InternedString _sourceShortString;
     mutable std::string _snippet;
     std::vector<Definition::Definition> _definitions;
 };
@@ -5,14 +5,14 @@
 #include "logic/utils/chineseutils.h"
 #include "logic/utils/mandarinutils.h"
 
-Entry::Entry(const std::string &simplified, const std::string &traditional,
-             const std::string &jyutping, const std::string &pinyin,
-             const std::vector<DefinitionsSet> &definitions)
-    : _simplified{simplified},
-      _traditional{traditional},
-      _jyutping{jyutping},
-      _pinyin{pinyin},
-      _definitions{definitions}
+Entry::Entry(std::string simplified, std::string traditional,
+             std::string jyutping, std::string pinyin,
+             std::vector<DefinitionsSet> definitions)
+    : _simplified{std::move(simplified)},
+      _traditional{std::move(traditional)},
+      _jyutping{std::move(jyutping)},
+      _pinyin{std::move(pinyin)},
+      _definitions{std::move(definitions)}
 {
     // Normalize pinyin and jyutping to lowercase >:(
     std::transform(_jyutping.cbegin(),
@@ -45,6 +45,9 @@ Entry::Entry(const Entry &entry)
     , _colouredTraditional{entry._colouredTraditional}
     , _colouredTraditionalDifference{entry._colouredTraditionalDifference}
     , _colouredPreferTraditional{entry._colouredPreferTraditional}
+    , _isColouredValid{entry._isColouredValid}
+    , _colouredType{entry._colouredType}
+    , _colouredVersion{entry._colouredVersion}
     , _jyutping{entry._jyutping}
     , _yale{entry._yale}
     , _isYaleValid{entry._isYaleValid}
@@ -83,6 +86,9 @@ Entry::Entry(Entry &&entry)
     , _colouredTraditionalDifference{std::move(
           entry._colouredTraditionalDifference)}
     , _colouredPreferTraditional{std::move(entry._colouredPreferTraditional)}
+    , _isColouredValid{entry._isColouredValid}
+    , _colouredType{entry._colouredType}
+    , _colouredVersion{entry._colouredVersion}
     , _jyutping{std::move(entry._jyutping)}
     , _yale{std::move(entry._yale)}
     , _isYaleValid{entry._isYaleValid}
@@ -124,6 +130,9 @@ Entry &Entry::operator=(const Entry &entry)
     _colouredTraditional = entry._colouredTraditional;
     _colouredTraditionalDifference = entry._colouredTraditionalDifference;
     _colouredPreferTraditional = entry._colouredPreferTraditional;
+    _isColouredValid = entry._isColouredValid;
+    _colouredType = entry._colouredType;
+    _colouredVersion = entry._colouredVersion;
     _jyutping = entry._jyutping;
     _yale = entry._yale;
     _isYaleValid = entry._isYaleValid;
@@ -167,6 +176,9 @@ Entry &Entry::operator=(Entry &&entry)
     _colouredTraditional = std::move(entry._colouredTraditional);
     _colouredTraditionalDifference = std::move(entry._colouredTraditionalDifference);
     _colouredPreferTraditional = std::move(entry._colouredPreferTraditional);
+    _isColouredValid = entry._isColouredValid;
+    _colouredType = entry._colouredType;
+    _colouredVersion = entry._colouredVersion;
     _jyutping = std::move(entry._jyutping);
     _yale = std::move(entry._yale);
     _isYaleValid = entry._isYaleValid;
@@ -292,6 +304,7 @@ void Entry::setSimplified(std::string simplified)
     _simplifiedDifference = ChineseUtils::compareStrings(_traditional, _simplified);
     _preferSimplified = _simplified + " [" + _traditionalDifference + "]";
     _preferTraditional = _traditional + " [" + _simplifiedDifference + "]";
+    _isColouredValid = false;
 }
 
 const std::string &Entry::getTraditional(void) const
@@ -308,6 +321,7 @@ void Entry::setTraditional(std::string traditional)
     _simplifiedDifference = ChineseUtils::compareStrings(_traditional, _simplified);
     _preferTraditional = _traditional + " [" + _simplifiedDifference + "]";
     _preferSimplified = _simplified + " [" + _traditionalDifference + "]";
+    _isColouredValid = false;
 }
 
 bool Entry::generatePhonetic(CantoneseOptions cantoneseOptions,
@@ -471,6 +485,7 @@ void Entry::setJyutping(const std::string &jyutping)
                    _jyutping.begin(),
                    [](unsigned char c) { return std::tolower(c); });
     _isJyutpingNumbersValid = false;
+    _isColouredValid = false;
 }
 
 const std::vector<uint8_t> &Entry::getJyutpingNumbers()
@@ -502,6 +517,7 @@ void Entry::setPinyin(const std::string &pinyin)
     _pinyin = pinyin;
     std::transform(_pinyin.begin(), _pinyin.end(), _pinyin.begin(), ::tolower);
     _isPinyinNumbersValid = false;
+    _isColouredValid = false;
 }
 
 const std::vector<uint8_t> &Entry::getPinyinNumbers()
@@ -554,7 +570,17 @@ void Entry::addDefinitions(const std::string &source,
 
 void Entry::refreshColours(const EntryColourPhoneticType type)
 {
-    std::vector<uint8_t> tones;
+    // Every row gets refreshed each time it is painted, but the coloured
+    // strings only change with the colour type or the tone colours
+    if (_isColouredValid && _colouredType == type
+        && _colouredVersion == Settings::toneColoursVersion) {
+        return;
+    }
+    _isColouredValid = true;
+    _colouredType = type;
+    _colouredVersion = Settings::toneColoursVersion;
+
+    std::span<const uint8_t> tones;
     switch (type) {
     case EntryColourPhoneticType::NONE: {
         _colouredSimplified = _simplified;
@@ -22,9 +22,9 @@ class Entry : public QObject
 {
 public:
     Entry() = default;
-    Entry(const std::string &simplified, const std::string &traditional,
-          const std::string &jyutping, const std::string &pinyin,
-          const std::vector<DefinitionsSet> &definitions);
+    Entry(std::string simplified, std::string traditional,
+          std::string jyutping, std::string pinyin,
+          std::vector<DefinitionsSet> definitions);
 
     // Must define rule-of-five functions to allow registering this class
     // as a Qt Metatype, since QObject explicitly deletes them
@@ -102,6 +102,10 @@ private:
     std::string _colouredTraditional;
     std::string _colouredTraditionalDifference;
     std::string _colouredPreferTraditional;
+    // Which colour type and tone colours the coloured strings were made with
+    bool _isColouredValid = false;
+    EntryColourPhoneticType _colouredType = EntryColourPhoneticType::NONE;
+    uint32_t _colouredVersion = 0;
 
     std::string _jyutping;
     std::string _yale;
@@ -0,0 +1,278 @@
+#include "entrypreview.h"
+
+#include "logic/settings/settings.h"
+#include "logic/utils/cantoneseutils.h"
+#include "logic/utils/chineseutils.h"
+#include "logic/utils/mandarinutils.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// Each string in a row is stored with a 16-bit size
+constexpr std::size_t maxStringSize = UINT16_MAX;
+
+// A result only shows one line of its snippet, which is usually elided well
+// before this, so there is no need to keep the rest. The welcome and empty
+// placeholders show all of theirs.
+constexpr std::size_t maxSnippetSize = 96;
+
+// This mirrors Entry::getDefinitionSnippet(), which cannot be used here
+// since it is not const. Long snippets are cut at the last UTF-8 character
+// boundary before maxSnippetSize.
+std::string_view getSnippet(std::span<const DefinitionsSet> definitions,
+                            bool isPlaceholder)
+{
+    for (const auto &definition : definitions) {
+        if (definition.isEmpty()) {
+            continue;
+        }
+
+        std::string_view snippet = definition.getDefinitionsSnippet();
+        if (isPlaceholder || snippet.size() <= maxSnippetSize) {
+            return snippet;
+        }
+        std::size_t size = maxSnippetSize;
+        while (size && (snippet[size] & 0xC0) == 0x80) {
+            size--;
+        }
+        return snippet.substr(0, size);
+    }
+    return {};
+}
+
+// These mirror Entry::getJyutpingNumbers() and Entry::getPinyinNumbers()
+std::vector<uint8_t> getToneNumbers(std::string_view romanisation,
+                                    std::string_view toneNumbers)
+{
+    std::vector<uint8_t> tones;
+    for (char c : romanisation) {
+        if (toneNumbers.find(c) != std::string_view::npos) {
+            tones.push_back(static_cast<uint8_t>(c - '0'));
+        }
+    }
+    return tones;
+}
+
+std::string getCantonesePhonetic(std::string_view jyutping,
+                                 CantoneseOptions cantoneseOptions)
+{
+    switch (cantoneseOptions) {
+    case CantoneseOptions::PRETTY_YALE: {
+        return CantoneseUtils::convertJyutpingToYale(std::string{jyutping});
+    }
+    case CantoneseOptions::CANTONESE_IPA: {
+        return CantoneseUtils::convertJyutpingToIPA(std::string{jyutping});
+    }
+    case CantoneseOptions::RAW_JYUTPING:
+    default:
+        return std::string{jyutping};
+    }
+}
+
+std::string getMandarinPhonetic(std::string_view pinyin,
+                                MandarinOptions mandarinOptions)
+{
+    switch (mandarinOptions) {
+    case MandarinOptions::PRETTY_PINYIN: {
+        return MandarinUtils::createPrettyPinyin(std::string{pinyin});
+    }
+    case MandarinOptions::NUMBERED_PINYIN: {
+        return MandarinUtils::createNumberedPinyin(std::string{pinyin});
+    }
+    case MandarinOptions::ZHUYIN: {
+        return MandarinUtils::convertPinyinToZhuyin(std::string{pinyin});
+    }
+    case MandarinOptions::MANDARIN_IPA: {
+        return MandarinUtils::convertPinyinToIPA(std::string{pinyin});
+    }
+    default: {
+        return std::string{pinyin};
+    }
+    }
+}
+
+} // namespace
+
+EntryPreviewSet::EntryPreviewSet(std::span<const Entry> entries)
+{
+    append(entries);
+}
+
+void EntryPreviewSet::append(std::span<const Entry> entries)
+{
+    if (entries.empty()) {
+        return;
+    }
+
+    _rows.reserve(_rows.size() + entries.size());
+
+    // First pass: figure out how large the arena needs to be
+    std::vector<std::string_view> snippets;
+    snippets.reserve(entries.size());
+    std::size_t arenaSize = 0;
+    for (const auto &entry : entries) {
+        snippets.push_back(
+            getSnippet(entry.getDefinitionsSets(),
+                       entry.isWelcome() || entry.isEmpty()));
+
+        arenaSize += entry.getSimplified().size()
+                     + entry.getTraditional().size()
+                     + entry.getJyutping().size() + entry.getPinyin().size()
+                     + snippets.back().size();
+    }
+
+    // Second pass: copy all the strings into a new arena
+    _arenas.emplace_back(new char[arenaSize ? arenaSize : 1]);
+    char *arena = _arenas.back().get();
+    char *cursor = arena;
+    auto copy = [&cursor](std::string_view string) {
+        std::size_t size = std::min(string.size(), maxStringSize);
+        std::memcpy(cursor, string.data(), size);
+        cursor += size;
+        return static_cast<std::uint16_t>(size);
+    };
+
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        const Entry &entry = entries[i];
+        Row row;
+        row.offset = static_cast<std::uint32_t>(cursor - arena);
+        row.arena = static_cast<std::uint16_t>(_arenas.size() - 1);
+        row.sizes[0] = copy(entry.getSimplified());
+        row.sizes[1] = copy(entry.getTraditional());
+        row.sizes[2] = copy(entry.getJyutping());
+        row.sizes[3] = copy(entry.getPinyin());
+        row.sizes[4] = copy(snippets[i]);
+        row.isWelcome = entry.isWelcome();
+        row.isEmpty = entry.isEmpty();
+        _rows.push_back(row);
+    }
+}
+
+std::size_t EntryPreviewSet::size(void) const
+{
+    return _rows.size();
+}
+
+bool EntryPreviewSet::empty(void) const
+{
+    return _rows.empty();
+}
+
+EntryPreview EntryPreviewSet::at(std::size_t index) const
+{
+    const Row &row = _rows.at(index);
+    const char *cursor = _arenas[row.arena].get() + row.offset;
+    auto view = [&cursor](std::uint16_t size) {
+        std::string_view string{cursor, size};
+        cursor += size;
+        return string;
+    };
+
+    EntryPreview preview;
+    preview.simplified = view(row.sizes[0]);
+    preview.traditional = view(row.sizes[1]);
+    preview.jyutping = view(row.sizes[2]);
+    preview.pinyin = view(row.sizes[3]);
+    preview.definitionSnippet = view(row.sizes[4]);
+    preview.isWelcome = row.isWelcome;
+    preview.isEmpty = row.isEmpty;
+    return preview;
+}
+
+namespace EntryPreviewUtils {
+
+std::string getCharacters(const EntryPreview &preview,
+                          EntryCharactersOptions options,
+                          EntryColourPhoneticType colourType,
+                          bool useColours)
+{
+    bool preferSimplified = options == EntryCharactersOptions::ONLY_SIMPLIFIED
+                            || options
+                                   == EntryCharactersOptions::PREFER_SIMPLIFIED;
+    bool showDifference = options == EntryCharactersOptions::PREFER_SIMPLIFIED
+                          || options
+                                 == EntryCharactersOptions::PREFER_TRADITIONAL;
+
+    std::string simplified{preview.simplified};
+    std::string traditional{preview.traditional};
+    std::string characters = preferSimplified ? simplified : traditional;
+    std::string difference;
+    if (showDifference) {
+        difference = preferSimplified
+                         ? ChineseUtils::compareStrings(simplified, traditional)
+                         : ChineseUtils::compareStrings(traditional,
+                                                        simplified);
+    }
+
+    if (useColours && colourType != EntryColourPhoneticType::NONE) {
+        std::vector<uint8_t> tones
+            = colourType == EntryColourPhoneticType::CANTONESE
+                  ? getToneNumbers(preview.jyutping, "0123456")
+                  : getToneNumbers(preview.pinyin, "012345");
+        characters = ChineseUtils::applyColours(characters,
+                                                tones,
+                                                Settings::jyutpingToneColours,
+                                                Settings::pinyinToneColours,
+                                                colourType);
+        if (showDifference) {
+            difference
+                = ChineseUtils::applyColours(difference,
+                                             tones,
+                                             Settings::jyutpingToneColours,
+                                             Settings::pinyinToneColours,
+                                             colourType);
+        }
+    }
+
+    if (showDifference) {
+        return characters + " [" + difference + "]";
+    }
+    return characters;
+}
+
+// This mirrors Entry::getPhonetic()
+std::string getPhonetic(const EntryPreview &preview,
+                        EntryPhoneticOptions options,
+                        CantoneseOptions cantoneseOptions,
+                        MandarinOptions mandarinOptions)
+{
+    switch (options) {
+    case EntryPhoneticOptions::ONLY_CANTONESE: {
+        return getCantonesePhonetic(preview.jyutping, cantoneseOptions);
+    }
+    case EntryPhoneticOptions::ONLY_MANDARIN: {
+        return getMandarinPhonetic(preview.pinyin, mandarinOptions);
+    }
+    case EntryPhoneticOptions::PREFER_CANTONESE: {
+        std::string cantonese = getCantonesePhonetic(preview.jyutping,
+                                                     cantoneseOptions);
+        std::string mandarin = getMandarinPhonetic(preview.pinyin,
+                                                   mandarinOptions);
+        if (cantonese.empty()) {
+            return mandarin.empty() ? "" : "(" + mandarin + ")";
+        } else if (mandarin.empty()) {
+            return cantonese;
+        } else {
+            return cantonese + " (" + mandarin + ")";
+        }
+    }
+    case EntryPhoneticOptions::PREFER_MANDARIN: {
+        std::string cantonese = getCantonesePhonetic(preview.jyutping,
+                                                     cantoneseOptions);
+        std::string mandarin = getMandarinPhonetic(preview.pinyin,
+                                                   mandarinOptions);
+        if (mandarin.empty()) {
+            return cantonese.empty() ? "" : "(" + cantonese + ")";
+        } else if (cantonese.empty()) {
+            return mandarin;
+        } else {
+            return mandarin + " (" + cantonese + ")";
+        }
+    }
+    }
+    return std::string{preview.jyutping};
+}
+
+} // namespace EntryPreviewUtils
@@ -0,0 +1,104 @@
+#ifndef ENTRYPREVIEW_H
+#define ENTRYPREVIEW_H
+
+#include "logic/entry/entry.h"
+#include "logic/entry/entrycharactersoptions.h"
+#include "logic/entry/entryphoneticoptions.h"
+
+#include <QMetaType>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// An EntryPreview is the compact representation of an entry that is shown in
+// a list of search results. Unlike Entry, it is not a QObject and does not
+// cache any derived strings, so it is cheap to wrap in a QVariant.
+//
+// All strings are views into the arena of the EntryPreviewSet that created
+// the preview; an EntryPreview must not outlive its set.
+
+struct EntryPreview
+{
+    std::string_view simplified;
+    std::string_view traditional;
+    std::string_view jyutping;
+    std::string_view pinyin;
+    std::string_view definitionSnippet;
+
+    bool isWelcome = false;
+    bool isEmpty = false;
+};
+
+Q_DECLARE_METATYPE(EntryPreview);
+
+// An EntryPreviewSet holds the previews for a result set.
+//
+// The headwords, romanization and snippet of every row are packed into
+// contiguous blocks, one per call to append(), which are released all at once
+// when the set is destroyed. Appending never moves earlier blocks, so
+// previews stay valid as the set grows.
+// The set does not keep the definitions of its rows, and only keeps the
+// beginning of long snippets, since a row only has room for one line of
+// them. The headwords and romanization of a row are the key that the full
+// entry can be looked up with (see SQLSearch::lookUpByUnique()).
+
+class EntryPreviewSet
+{
+public:
+    EntryPreviewSet() = default;
+    explicit EntryPreviewSet(std::span<const Entry> entries);
+
+    // Previews point into the arenas, so copying is disallowed; moving is
+    // fine since the arenas themselves are never relocated.
+    EntryPreviewSet(const EntryPreviewSet &) = delete;
+    EntryPreviewSet &operator=(const EntryPreviewSet &) = delete;
+    EntryPreviewSet(EntryPreviewSet &&) = default;
+    EntryPreviewSet &operator=(EntryPreviewSet &&) = default;
+
+    void append(std::span<const Entry> entries);
+
+    std::size_t size(void) const;
+    bool empty(void) const;
+
+    EntryPreview at(std::size_t index) const;
+
+private:
+    // Instead of an EntryPreview, each row only stores where its strings are,
+    // which is a quarter of the size; at() makes the preview from it.
+    struct Row
+    {
+        std::uint32_t offset;
+        std::uint16_t arena;
+        std::uint16_t sizes[5];
+        bool isWelcome;
+        bool isEmpty;
+    };
+
+    std::vector<std::unique_ptr<char[]>> _arenas;
+    std::vector<Row> _rows;
+};
+
+// The EntryPreviewUtils namespace formats a preview the same way as the
+// corresponding Entry getters, without constructing an Entry. Nothing is
+// cached, so callers that show a preview more than once should keep the
+// result.
+
+namespace EntryPreviewUtils {
+
+std::string getCharacters(const EntryPreview &preview,
+                          EntryCharactersOptions options,
+                          EntryColourPhoneticType colourType,
+                          bool useColours);
+std::string getPhonetic(const EntryPreview &preview,
+                        EntryPhoneticOptions options,
+                        CantoneseOptions cantoneseOptions,
+                        MandarinOptions mandarinOptions);
+
+} // namespace EntryPreviewUtils
+
+#endif // ENTRYPREVIEW_H
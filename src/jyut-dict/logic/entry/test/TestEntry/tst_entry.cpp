@@ -2,6 +2,7 @@
 
 #include "logic/entry/entry.h"
 #include "logic/entry/entrycharactersoptions.h"
+#include "logic/settings/settings.h"
 #include "logic/utils/chineseutils.h"
 
 class TestEntry : public QObject
@@ -25,6 +26,7 @@ private slots:
     void definitions();
 
     void refreshColours();
+    void refreshColoursAfterChanges();
 
     void specialCases();
 };
@@ -342,6 +344,40 @@ void TestEntry::refreshColours()
              "嶺南文化");
 }
 
+void TestEntry::refreshColoursAfterChanges()
+{
+    Entry entry{"文化", "文化", "man4 faa3", "wen2 hua4", {}};
+
+    entry.refreshColours(EntryColourPhoneticType::CANTONESE);
+    QCOMPARE(QString::fromStdString(
+                 entry.getCharacters(EntryCharactersOptions::ONLY_SIMPLIFIED,
+                                     /* useColours = */ true)),
+             "<font color=\"#c2185b\">\u6587</font><font "
+             "color=\"#657ff1\">\u5316</font>");
+
+    // Changing the pronunciation recolours the entry...
+    entry.setJyutping("man6 faa3");
+    entry.refreshColours(EntryColourPhoneticType::CANTONESE);
+    QCOMPARE(QString::fromStdString(
+                 entry.getCharacters(EntryCharactersOptions::ONLY_SIMPLIFIED,
+                                     /* useColours = */ true)),
+             "<font color=\"#7651d0\">\u6587</font><font "
+             "color=\"#657ff1\">\u5316</font>");
+
+    // ... and so does changing the tone colours
+    Settings::jyutpingToneColours[3] = "#000000";
+    Settings::toneColoursVersion++;
+    entry.refreshColours(EntryColourPhoneticType::CANTONESE);
+    QCOMPARE(QString::fromStdString(
+                 entry.getCharacters(EntryCharactersOptions::ONLY_SIMPLIFIED,
+                                     /* useColours = */ true)),
+             "<font color=\"#7651d0\">\u6587</font><font "
+             "color=\"#000000\">\u5316</font>");
+
+    Settings::jyutpingToneColours = Settings::defaultJyutpingToneColours;
+    Settings::toneColoursVersion++;
+}
+
 void TestEntry::specialCases()
 {
     Entry entry;
@@ -0,0 +1,228 @@
+#include <QtTest>
+
+#include "logic/entry/entry.h"
+#include "logic/entry/entrypreview.h"
+
+namespace {
+QString toQString(std::string_view view)
+{
+    return QString::fromUtf8(view.data(), static_cast<qsizetype>(view.size()));
+}
+} // namespace
+
+class TestEntryPreview : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestEntryPreview();
+    ~TestEntryPreview();
+
+private slots:
+    void empty();
+    void previews();
+    void longSnippet();
+    void characters();
+    void phonetic();
+    void append();
+    void move();
+};
+
+TestEntryPreview::TestEntryPreview() {}
+
+TestEntryPreview::~TestEntryPreview() {}
+
+void TestEntryPreview::empty()
+{
+    EntryPreviewSet set{std::vector<Entry>{}};
+
+    QCOMPARE(set.empty(), true);
+    QCOMPARE(set.size(), static_cast<std::size_t>(0));
+}
+
+void TestEntryPreview::previews()
+{
+    std::vector<Definition::Definition> definitions{
+        {"Chinatown", "", {}},
+        {"CL:條|条[tiao2],座[zuo4]", "", {}},
+    };
+    DefinitionsSet definitionsSet{"CC-CEDICT", definitions};
+
+    Entry welcome{"Welcome!", "Welcome!", "—", "—", {}};
+    welcome.setIsWelcome(true);
+
+    std::vector<Entry> entries{
+        {"唐人街",
+         "唐人街",
+         "tong4 jan4 gaai1",
+         "tang2 ren2 jie1",
+         {definitionsSet}},
+        {"清远", "清遠", "cing1 jyun5", "qing1 yuan3", {}},
+        welcome,
+    };
+    EntryPreviewSet set{entries};
+
+    QCOMPARE(set.size(), static_cast<std::size_t>(3));
+
+    QCOMPARE(toQString(set.at(0).simplified), "唐人街");
+    QCOMPARE(toQString(set.at(0).traditional), "唐人街");
+    QCOMPARE(toQString(set.at(0).jyutping), "tong4 jan4 gaai1");
+    QCOMPARE(toQString(set.at(0).pinyin), "tang2 ren2 jie1");
+    QCOMPARE(toQString(set.at(0).definitionSnippet),
+             "Chinatown; CL:條|条[tiao2],座[zuo4]");
+    QCOMPARE(set.at(0).isWelcome, false);
+    QCOMPARE(set.at(0).isEmpty, false);
+
+    QCOMPARE(toQString(set.at(1).simplified), "清远");
+    QCOMPARE(toQString(set.at(1).traditional), "清遠");
+    QCOMPARE(toQString(set.at(1).definitionSnippet), "");
+
+    QCOMPARE(set.at(2).isWelcome, true);
+    QCOMPARE(set.at(2).isEmpty, false);
+}
+
+void TestEntryPreview::longSnippet()
+{
+    // One byte, then 40 characters of three bytes each: the snippet is too
+    // long to keep, and the byte it would be cut at is inside a character
+    std::string definition = "a";
+    for (int i = 0; i < 40; i++) {
+        definition += "街";
+    }
+    std::vector<Definition::Definition> definitions{{definition, "", {}}};
+    DefinitionsSet definitionsSet{"CC-CEDICT", definitions};
+
+    Entry entry{"唐人街",
+                "唐人街",
+                "tong4 jan4 gaai1",
+                "tang2 ren2 jie1",
+                {definitionsSet}};
+    Entry empty{"No results...", "No results...", "", "", {definitionsSet}};
+    empty.setIsEmpty(true);
+
+    EntryPreviewSet set{std::vector<Entry>{entry, empty}};
+
+    QString snippet = toQString(set.at(0).definitionSnippet);
+    QCOMPARE(snippet, QString::fromStdString(definition).left(32));
+    QCOMPARE(toQString(set.at(0).pinyin), "tang2 ren2 jie1");
+
+    // The placeholders keep all of their snippet
+    QCOMPARE(toQString(set.at(1).definitionSnippet),
+             QString::fromStdString(definition));
+}
+
+void TestEntryPreview::characters()
+{
+    Entry entry{"清远", "清遠", "cing1 jyun5", "qing1 yuan3", {}};
+    EntryPreviewSet set{std::vector<Entry>{entry}};
+
+    for (auto colourType : {EntryColourPhoneticType::NONE,
+                            EntryColourPhoneticType::CANTONESE,
+                            EntryColourPhoneticType::MANDARIN}) {
+        entry.refreshColours(colourType);
+        for (auto options : {EntryCharactersOptions::ONLY_SIMPLIFIED,
+                             EntryCharactersOptions::ONLY_TRADITIONAL,
+                             EntryCharactersOptions::PREFER_SIMPLIFIED,
+                             EntryCharactersOptions::PREFER_TRADITIONAL}) {
+            for (bool useColours : {false, true}) {
+                QCOMPARE(QString::fromStdString(
+                             EntryPreviewUtils::getCharacters(set.at(0),
+                                                              options,
+                                                              colourType,
+                                                              useColours)),
+                         QString::fromStdString(
+                             entry.getCharacters(options, useColours)));
+            }
+        }
+    }
+}
+
+void TestEntryPreview::phonetic()
+{
+    Entry entry{"清远", "清遠", "cing1 jyun5", "qing1 yuan3", {}};
+    Entry noMandarin{"冇", "冇", "mou5", "", {}};
+    EntryPreviewSet set{std::vector<Entry>{entry, noMandarin}};
+
+    CantoneseOptions allCantonese = CantoneseOptions::RAW_JYUTPING
+                                    | CantoneseOptions::PRETTY_YALE
+                                    | CantoneseOptions::CANTONESE_IPA;
+    MandarinOptions allMandarin = MandarinOptions::PRETTY_PINYIN
+                                  | MandarinOptions::NUMBERED_PINYIN
+                                  | MandarinOptions::ZHUYIN
+                                  | MandarinOptions::MANDARIN_IPA;
+    entry.generatePhonetic(allCantonese, allMandarin);
+    noMandarin.generatePhonetic(allCantonese, allMandarin);
+
+    for (auto options : {EntryPhoneticOptions::ONLY_CANTONESE,
+                         EntryPhoneticOptions::ONLY_MANDARIN,
+                         EntryPhoneticOptions::PREFER_CANTONESE,
+                         EntryPhoneticOptions::PREFER_MANDARIN}) {
+        for (auto cantoneseOptions : {CantoneseOptions::RAW_JYUTPING,
+                                      CantoneseOptions::PRETTY_YALE,
+                                      CantoneseOptions::CANTONESE_IPA}) {
+            for (auto mandarinOptions : {MandarinOptions::PRETTY_PINYIN,
+                                         MandarinOptions::NUMBERED_PINYIN,
+                                         MandarinOptions::ZHUYIN,
+                                         MandarinOptions::MANDARIN_IPA}) {
+                QCOMPARE(QString::fromStdString(
+                             EntryPreviewUtils::getPhonetic(set.at(0),
+                                                            options,
+                                                            cantoneseOptions,
+                                                            mandarinOptions)),
+                         QString::fromStdString(
+                             entry.getPhonetic(options,
+                                               cantoneseOptions,
+                                               mandarinOptions)));
+                QCOMPARE(QString::fromStdString(
+                             EntryPreviewUtils::getPhonetic(set.at(1),
+                                                            options,
+                                                            cantoneseOptions,
+                                                            mandarinOptions)),
+                         QString::fromStdString(
+                             noMandarin.getPhonetic(options,
+                                                    cantoneseOptions,
+                                                    mandarinOptions)));
+            }
+        }
+    }
+}
+
+void TestEntryPreview::append()
+{
+    std::vector<Entry> entries{
+        {"唐人街", "唐人街", "tong4 jan4 gaai1", "tang2 ren2 jie1", {}},
+        {"清远", "清遠", "cing1 jyun5", "qing1 yuan3", {}},
+        {"文化", "文化", "man4 faa3", "wen2 hua4", {}},
+    };
+    std::span<const Entry> span{entries};
+
+    EntryPreviewSet set{span.first(1)};
+    std::string_view firstPreview = set.at(0).simplified;
+
+    set.append(span.subspan(1, 2));
+    set.append(span.subspan(3));
+
+    QCOMPARE(set.size(), static_cast<std::size_t>(3));
+    QCOMPARE(toQString(set.at(1).simplified), "清远");
+    QCOMPARE(toQString(set.at(2).jyutping), "man4 faa3");
+
+    // Earlier pages are not moved by appending
+    QCOMPARE(set.at(0).simplified.data(), firstPreview.data());
+    QCOMPARE(toQString(firstPreview), "唐人街");
+}
+
+void TestEntryPreview::move()
+{
+    EntryPreviewSet set{std::vector<Entry>{
+        {"清远", "清遠", "cing1 jyun5", "qing1 yuan3", {}},
+    }};
+    EntryPreviewSet movedSet = std::move(set);
+
+    QCOMPARE(movedSet.size(), static_cast<std::size_t>(1));
+    QCOMPARE(toQString(movedSet.at(0).simplified), "清远");
+    QCOMPARE(toQString(movedSet.at(0).jyutping), "cing1 jyun5");
+}
+
+QTEST_APPLESS_MAIN(TestEntryPreview)
+
+#include "tst_entrypreview.moc"
@@ -5,25 +5,61 @@
 #endif
 
 #include <QCoreApplication>
+#include <QFile>
 #include <QFileInfo>
 #include <QStandardPaths>
 #include <QtConcurrent/QtConcurrent>
 
+#include <algorithm>
 #include <iostream>
-#include <sstream>
 
 namespace {
 constexpr auto SIMPLIFIED_MODEL = "handwriting-zh_CN.model";
 constexpr auto TRADITIONAL_MODEL = "handwriting-zh_TW.model";
-constexpr auto CHARACTER_PREAMBLE
-    = "(character (width %1)(height %1) (strokes ";
-constexpr auto CHARACTER_POSTSCRIPT = "))";
+constexpr auto SIMPLIFIED_QUANTIZED_MODEL = "handwriting-zh_CN.qmodel";
+constexpr auto TRADITIONAL_QUANTIZED_MODEL = "handwriting-zh_TW.qmodel";
+constexpr auto LIVE_RECOGNITION_INTERVAL = 50;
+constexpr auto NUM_RESULTS = 10;
+
+// Models in local storage are quantized, so that they open without being
+// read; portable builds use the bundled models as they are.
+#ifdef PORTABLE
+constexpr auto SIMPLIFIED_RECOGNIZER_MODEL = SIMPLIFIED_MODEL;
+constexpr auto TRADITIONAL_RECOGNIZER_MODEL = TRADITIONAL_MODEL;
+#else
+constexpr auto SIMPLIFIED_RECOGNIZER_MODEL = SIMPLIFIED_QUANTIZED_MODEL;
+constexpr auto TRADITIONAL_RECOGNIZER_MODEL = TRADITIONAL_QUANTIZED_MODEL;
+#endif
+
+// The quantized model is written under a temporary name first, so that an
+// interrupted conversion is never mistaken for a finished one
+bool quantizeModel(const QString &model, const QString &quantizedModel)
+{
+    QString partialModel = quantizedModel + ".part";
+    QFile::remove(partialModel);
+    if (!zinnia::Trainer::quantize(model.toStdString().c_str(),
+                                   partialModel.toStdString().c_str())) {
+        QFile::remove(partialModel);
+        return false;
+    }
+    QFile::remove(quantizedModel);
+    return QFile::rename(partialModel, quantizedModel);
+}
 } // namespace
 
-HandwritingWrapper::HandwritingWrapper(Handwriting::Script script)
+HandwritingWrapper::HandwritingWrapper(
+    Handwriting::Script script,
+    std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils)
     : QObject()
-    , _recognizer{zinnia::Recognizer::create()}
+    , _simplifiedRecognizer{zinnia::Recognizer::create()}
+    , _traditionalRecognizer{zinnia::Recognizer::create()}
+    , _script{script}
+    , _sqlHandwritingUtils{sqlHandwritingUtils}
 {
+    for (auto &cell : _cells) {
+        cell.character.reset(zinnia::Character::create());
+    }
+
     showProgressDialog(tr("Preparing handwriting models..."));
     _boolReturnWatcher = new QFutureWatcher<Utils::Result<bool>>{this};
     disconnect(_boolReturnWatcher, nullptr, nullptr, nullptr);
@@ -36,70 +72,102 @@ HandwritingWrapper::HandwritingWrapper(Handwriting::Script script)
                 if (std::system_error *e = std::get_if<std::system_error>(
                         &result)) {
                     emit modelError(*e);
+                    return;
                 }
+                setRecognizerScript(_script);
             });
     QFuture<Utils::Result<bool>> future = QtConcurrent::run(
-        [=, this]() { return copyModels(); });
+        [=, this]() { return openModels(); });
     _boolReturnWatcher->setFuture(future);
 
-    setRecognizerScript(script);
+    _classifyWatcher = new QFutureWatcher<std::vector<std::string>>{this};
+    connect(_classifyWatcher,
+            &QFutureWatcher<std::vector<std::string>>::finished,
+            this,
+            [=, this]() {
+                std::vector<std::string> results = _classifyWatcher->result();
+                if (_classifyingGeneration == _generation) {
+                    emit recognizedResults(results);
+                }
+                if (_classifyPending) {
+                    _classifyPending = false;
+                    classifyCharacter();
+                }
+            });
 }
 
 HandwritingWrapper::~HandwritingWrapper()
 {
-    if (_character) {
-        delete _character;
+    _boolReturnWatcher->waitForFinished();
+    _classifyWatcher->waitForFinished();
+    if (_simplifiedRecognizer) {
+        delete _simplifiedRecognizer;
     }
-    if (_recognizer) {
-        delete _recognizer;
+    if (_traditionalRecognizer) {
+        delete _traditionalRecognizer;
     }
 }
 
+// Until the models are ready, the script is only remembered; it is switched
+// to once they are.
 bool HandwritingWrapper::setRecognizerScript(Handwriting::Script script)
 {
-    if (!_recognizer) {
+    _script = script;
+    if (!_boolReturnWatcher->isFinished()) {
+        return false;
+    }
+    Utils::Result<bool> result = _boolReturnWatcher->result();
+    if (std::holds_alternative<std::system_error>(result)) {
         return false;
     }
 
-    std::string modelFile;
     switch (script) {
     case Handwriting::Script::SIMPLIFIED: {
-        modelFile = getModelPath().toStdString() + SIMPLIFIED_MODEL;
+        _recognizer = _simplifiedRecognizer;
         break;
     }
     case Handwriting::Script::TRADITIONAL: {
-        modelFile = getModelPath().toStdString() + TRADITIONAL_MODEL;
+        _recognizer = _traditionalRecognizer;
         break;
     }
     }
 
-    while (_boolReturnWatcher && _boolReturnWatcher->isRunning()) {
-        std::this_thread::sleep_for(std::chrono::milliseconds{50});
-    }
-
-    _recognizer->close();
-    int status = _recognizer->open(modelFile.c_str());
-    if (!status) {
-        std::system_error e{ENOENT,
-                            std::generic_category(),
-                            _recognizer->what()};
-        emit modelError(e);
-        return false;
-    }
-
+    // A classification that is still running for the other script is stale
+    _generation++;
     classifyCharacter();
     return true;
 }
 
+void HandwritingWrapper::setLiveRecognition(bool enabled)
+{
+    _liveRecognition = enabled;
+}
+
+void HandwritingWrapper::setMultiCharacter(bool enabled)
+{
+    if (enabled == _multiCharacter) {
+        return;
+    }
+    _multiCharacter = enabled;
+    clearStrokes();
+}
+
 void HandwritingWrapper::clearStrokes(void)
 {
-    _strokes.clear();
+    _generation++;
+    for (auto &cell : _cells) {
+        cell.resetCharacter = true;
+        cell.strokes.clear();
+    }
     _currentStrokePoints.clear();
 }
 
 bool HandwritingWrapper::strokesCleared(void)
 {
-    return _strokes.empty() && _currentStrokePoints.empty();
+    return std::all_of(_cells.begin(),
+                       _cells.end(),
+                       [](const Cell &cell) { return cell.strokes.empty(); })
+           && _currentStrokePoints.empty();
 }
 
 QString HandwritingWrapper::getModelPath() const
@@ -209,12 +277,19 @@ Utils::Result<bool> HandwritingWrapper::copyModels(void) const
         }
     }
 
+    QFileInfo traditionalQuantizedFile{getLocalModelPath()
+                                       + TRADITIONAL_QUANTIZED_MODEL};
     QFileInfo traditionalLocalFile{getLocalModelPath() + TRADITIONAL_MODEL};
     QFileInfo traditionalBundleFile{getBundleModelPath() + TRADITIONAL_MODEL};
+    QFileInfo simplifiedQuantizedFile{getLocalModelPath()
+                                      + SIMPLIFIED_QUANTIZED_MODEL};
     QFileInfo simplifiedLocalFile{getLocalModelPath() + SIMPLIFIED_MODEL};
     QFileInfo simplifiedBundleFile{getBundleModelPath() + SIMPLIFIED_MODEL};
-    // Copy file from bundle to Application Support
-    if (!traditionalLocalFile.exists() || !traditionalLocalFile.isFile()) {
+    // Copy file from bundle to Application Support. The copy is kept after it
+    // is quantized, so that openModels() can quantize it again if the
+    // quantized model can't be opened.
+    if ((!traditionalLocalFile.exists() || !traditionalLocalFile.isFile())
+        && traditionalBundleFile.isFile()) {
         if (!QFile::copy(traditionalBundleFile.absoluteFilePath(),
                          traditionalLocalFile.absoluteFilePath())) {
             return std::system_error{
@@ -224,7 +299,8 @@ Utils::Result<bool> HandwritingWrapper::copyModels(void) const
                 "Application Support location"};
         }
     }
-    if (!simplifiedLocalFile.exists() || !simplifiedLocalFile.isFile()) {
+    if ((!simplifiedLocalFile.exists() || !simplifiedLocalFile.isFile())
+        && simplifiedBundleFile.isFile()) {
         if (!QFile::copy(simplifiedBundleFile.absoluteFilePath(),
                          simplifiedLocalFile.absoluteFilePath())) {
             return std::system_error{
@@ -235,6 +311,30 @@ Utils::Result<bool> HandwritingWrapper::copyModels(void) const
         }
     }
 
+    // Quantize the copy in Application Support
+    if (!traditionalQuantizedFile.exists()
+        || !traditionalQuantizedFile.isFile()) {
+        if (!quantizeModel(traditionalLocalFile.absoluteFilePath(),
+                           traditionalQuantizedFile.absoluteFilePath())) {
+            return std::system_error{
+                ENOENT,
+                std::generic_category(),
+                "Failed to convert traditional handwriting model in "
+                "Application Support location"};
+        }
+    }
+    if (!simplifiedQuantizedFile.exists()
+        || !simplifiedQuantizedFile.isFile()) {
+        if (!quantizeModel(simplifiedLocalFile.absoluteFilePath(),
+                           simplifiedQuantizedFile.absoluteFilePath())) {
+            return std::system_error{
+                ENOENT,
+                std::generic_category(),
+                "Failed to convert simplified handwriting model in "
+                "Application Support location"};
+        }
+    }
+
     // Delete file in bundle
     if (traditionalBundleFile.exists() && traditionalBundleFile.isFile()) {
         if (!QFile::remove(traditionalBundleFile.absoluteFilePath())) {
@@ -255,37 +355,257 @@ Utils::Result<bool> HandwritingWrapper::copyModels(void) const
 #endif
 }
 
-void HandwritingWrapper::classifyCharacter(void) const
+// A quantized model that can't be opened, e.g. because it was written in an
+// older format, is quantized again from the copy of the model it was made
+// from. Portable builds open the models as they are, so there is nothing to
+// redo.
+bool HandwritingWrapper::requantizeModel(zinnia::Recognizer *recognizer,
+                                         const char *model,
+                                         const char *quantizedModel) const
+{
+#ifdef PORTABLE
+    Q_UNUSED(recognizer);
+    Q_UNUSED(model);
+    Q_UNUSED(quantizedModel);
+    return false;
+#else
+    QFileInfo localFile{getLocalModelPath() + model};
+    QFileInfo quantizedFile{getLocalModelPath() + quantizedModel};
+    if (!localFile.isFile()
+        || !quantizeModel(localFile.absoluteFilePath(),
+                          quantizedFile.absoluteFilePath())) {
+        return false;
+    }
+    return recognizer->open(
+        quantizedFile.absoluteFilePath().toStdString().c_str());
+#endif
+}
+
+// Runs on a worker thread, before either recognizer is used
+Utils::Result<bool> HandwritingWrapper::openModels(void)
+{
+    Utils::Result<bool> result = copyModels();
+    if (std::holds_alternative<std::system_error>(result)) {
+        return result;
+    }
+
+    std::string simplifiedModel = getModelPath().toStdString()
+                                  + SIMPLIFIED_RECOGNIZER_MODEL;
+    if (!_simplifiedRecognizer->open(simplifiedModel.c_str())
+        && !requantizeModel(_simplifiedRecognizer,
+                            SIMPLIFIED_MODEL,
+                            SIMPLIFIED_RECOGNIZER_MODEL)) {
+        return std::system_error{ENOENT,
+                                 std::generic_category(),
+                                 _simplifiedRecognizer->what()};
+    }
+    std::string traditionalModel = getModelPath().toStdString()
+                                   + TRADITIONAL_RECOGNIZER_MODEL;
+    if (!_traditionalRecognizer->open(traditionalModel.c_str())
+        && !requantizeModel(_traditionalRecognizer,
+                            TRADITIONAL_MODEL,
+                            TRADITIONAL_RECOGNIZER_MODEL)) {
+        return std::system_error{ENOENT,
+                                 std::generic_category(),
+                                 _traditionalRecognizer->what()};
+    }
+
+    return true;
+}
+
+void HandwritingWrapper::classifyCharacter(void)
 {
-    if (_strokes.empty()) {
+    if (!_recognizer) {
         return;
     }
 
-    std::ostringstream character_ss;
-    character_ss << QString{CHARACTER_PREAMBLE}.arg(_width).toStdString();
-    for (const auto &stroke : _strokes) {
-        character_ss << stroke;
+    bool hasStrokes = std::any_of(_cells.begin(),
+                                  _cells.end(),
+                                  [](const Cell &cell) {
+                                      return !cell.strokes.empty();
+                                  });
+    if (!hasStrokes
+        && (!_liveRecognition || _currentStrokePoints.size() <= 1)) {
+        return;
     }
-    character_ss << CHARACTER_POSTSCRIPT;
 
-    zinnia::Character *character = zinnia::Character::create();
-    if (!character->parse(character_ss.str().c_str())) {
-        std::cerr << "Could not parse character: " << character->what()
-                  << std::endl;
+    // Only one classification runs at a time; if strokes come in while one
+    // is running, classify again with the latest strokes once it finishes.
+    if (_classifyWatcher->isRunning()) {
+        _classifyPending = true;
+        return;
     }
 
-    zinnia::Result *res = _recognizer->classify(*character, 10);
-    if (!res) {
-        std::cerr << "Could not classify character: " << _recognizer->what()
-                  << std::endl;
+    std::vector<size_t> cells = updateCharacters();
+
+    _classifyingGeneration = _generation;
+    zinnia::Recognizer *recognizer = _recognizer;
+    Handwriting::Script script = _script;
+    QFuture<std::vector<std::string>> future = QtConcurrent::run(
+        [=, this]() { return recognize(recognizer, cells, script); });
+    _classifyWatcher->setFuture(future);
+}
+
+// Brings the characters in the cells up to date with the completed strokes,
+// and in live mode the stroke being drawn. Completed strokes that are already
+// in a character are kept, so usually only the newest stroke gets added.
+// Returns the cells that have something written in them, in reading order.
+std::vector<size_t> HandwritingWrapper::updateCharacters(void)
+{
+    size_t currentCell = _cells.size();
+    if (_liveRecognition && _currentStrokePoints.size() > 1) {
+        currentCell = cellAt(_currentStrokePoints);
     }
+
+    std::vector<size_t> cells;
+    for (size_t i = 0; i < static_cast<size_t>(rows() * columns()); ++i) {
+        Cell &cell = _cells[i];
+
+        // zinnia can't remove a single stroke, so a stroke that was still
+        // being drawn last time means starting over
+        if (cell.resetCharacter || cell.hasCurrentStroke) {
+            cell.character->clear();
+            cell.resetCharacter = false;
+            cell.hasCurrentStroke = false;
+        }
+
+        // Both axes are scaled by the width, which keeps the aspect ratio of
+        // the strokes intact
+        cell.character->set_width(static_cast<size_t>(_width / columns()));
+        cell.character->set_height(static_cast<size_t>(_width / columns()));
+
+        for (size_t id = cell.character->strokes_size();
+             id < cell.strokes.size();
+             ++id) {
+            for (const auto &[x, y] : cell.strokes[id]) {
+                cell.character->add(id, x, y);
+            }
+        }
+
+        if (i == currentCell) {
+            const auto [originX, originY] = cellOrigin(i);
+            for (const auto &[x, y] : _currentStrokePoints) {
+                cell.character->add(cell.strokes.size(),
+                                    x - originX,
+                                    y - originY);
+            }
+            cell.hasCurrentStroke = true;
+        }
+
+        if (cell.character->strokes_size() > 0) {
+            cells.push_back(i);
+        }
+    }
+
+    return cells;
+}
+
+// Returns the candidates for a single cell. Several cells are classified
+// together, and the results are the dictionary words that can be written with
+// their candidates, most frequent first, followed by the best candidates
+// joined together in case the word isn't in the dictionary.
+std::vector<std::string> HandwritingWrapper::recognize(
+    zinnia::Recognizer *recognizer,
+    std::vector<size_t> cells,
+    Handwriting::Script script)
+{
     std::vector<std::string> results;
-    for (size_t i = 0; i < res->size(); ++i) {
-        results.emplace_back(res->value(i));
+
+    std::vector<const zinnia::Features *> features;
+    for (size_t cell : cells) {
+        if (!_cells[cell].features.read(*_cells[cell].character)) {
+            std::cerr << "Could not read features of character" << std::endl;
+            return results;
+        }
+        features.push_back(&_cells[cell].features);
+    }
+
+    std::vector<zinnia::Result *> classified(features.size());
+    if (!recognizer->classify(features.data(),
+                              features.size(),
+                              NUM_RESULTS,
+                              classified.data())) {
+        std::cerr << "Could not classify character: " << recognizer->what()
+                  << std::endl;
+        return results;
+    }
+    std::vector<std::vector<std::string>> candidates;
+    for (zinnia::Result *result : classified) {
+        candidates.emplace_back();
+        for (size_t i = 0; i < result->size(); ++i) {
+            candidates.back().emplace_back(result->value(i));
+        }
+        delete result;
+    }
+
+    if (candidates.size() == 1) {
+        return candidates.front();
+    }
+
+    if (_sqlHandwritingUtils) {
+        results = _sqlHandwritingUtils->searchWords(
+            candidates,
+            script == Handwriting::Script::SIMPLIFIED
+                ? SearchParameters::SIMPLIFIED
+                : SearchParameters::TRADITIONAL,
+            NUM_RESULTS);
+    }
+
+    std::string bestCandidates;
+    for (const auto &cellCandidates : candidates) {
+        if (cellCandidates.empty()) {
+            return results;
+        }
+        bestCandidates += cellCandidates.front();
+    }
+    if (std::find(results.begin(), results.end(), bestCandidates)
+        == results.end()) {
+        if (results.size() >= NUM_RESULTS) {
+            results.pop_back();
+        }
+        results.emplace_back(bestCandidates);
     }
-    delete character;
 
-    emit recognizedResults(results);
+    return results;
+}
+
+int HandwritingWrapper::rows(void) const
+{
+    return _multiCharacter ? Handwriting::MULTI_CHARACTER_ROWS : 1;
+}
+
+int HandwritingWrapper::columns(void) const
+{
+    return _multiCharacter ? Handwriting::MULTI_CHARACTER_COLUMNS : 1;
+}
+
+// A stroke belongs to the cell that the middle of its bounding box is in
+size_t HandwritingWrapper::cellAt(
+    const std::vector<std::pair<int, int>> &points) const
+{
+    const auto [left, right] = std::minmax_element(
+        points.begin(), points.end(), [](const auto &a, const auto &b) {
+            return a.first < b.first;
+        });
+    const auto [top, bottom] = std::minmax_element(
+        points.begin(), points.end(), [](const auto &a, const auto &b) {
+            return a.second < b.second;
+        });
+    int x = (left->first + right->first) / 2;
+    int y = (top->second + bottom->second) / 2;
+
+    int column = std::clamp(x * columns() / std::max(_width, 1),
+                            0,
+                            columns() - 1);
+    int row = std::clamp(y * rows() / std::max(_height, 1), 0, rows() - 1);
+    return static_cast<size_t>(row * columns() + column);
+}
+
+std::pair<int, int> HandwritingWrapper::cellOrigin(size_t cell) const
+{
+    int column = static_cast<int>(cell) % columns();
+    int row = static_cast<int>(cell) / columns();
+    return {column * _width / columns(), row * _height / rows()};
 }
 
 void HandwritingWrapper::setDimensions(int width, int height)
@@ -306,6 +626,13 @@ void HandwritingWrapper::updateStroke(int x, int y)
         || _currentStrokePoints.back().second != y) {
         _currentStrokePoints.emplace_back(x, y);
     }
+
+    if (_liveRecognition
+        && (!_liveRecognitionTimer.isValid()
+            || _liveRecognitionTimer.elapsed() >= LIVE_RECOGNITION_INTERVAL)) {
+        _liveRecognitionTimer.start();
+        classifyCharacter();
+    }
 }
 
 void HandwritingWrapper::completeStroke(int x, int y)
@@ -321,14 +648,15 @@ void HandwritingWrapper::completeStroke(int x, int y)
         return;
     }
 
-    std::ostringstream stroke;
-    stroke << "(";
-    for (const auto &[x, y] : _currentStrokePoints) {
-        stroke << "(" << std::to_string(x) << " " << std::to_string(y) << ")";
+    size_t cell = cellAt(_currentStrokePoints);
+    const auto [originX, originY] = cellOrigin(cell);
+    for (auto &[x, y] : _currentStrokePoints) {
+        x -= originX;
+        y -= originY;
     }
-    stroke << ")";
-    _strokes.emplace_back(stroke.str());
+    _cells[cell].strokes.emplace_back(std::move(_currentStrokePoints));
     _currentStrokePoints.clear();
+    _generation++;
 
     classifyCharacter();
 }
@@ -1,15 +1,21 @@
 #ifndef HANDWRITINGWRAPPER_H
 #define HANDWRITINGWRAPPER_H
 
+#include "logic/database/sqlhandwritingutils.h"
 #include "logic/utils/utils.h"
 
+#include "vendor/zinnia/feature.h"
 #include "vendor/zinnia/zinnia.h"
 
+#include <QElapsedTimer>
 #include <QFutureWatcher>
 #include <QObject>
 #include <QProgressDialog>
 #include <QString>
 
+#include <array>
+#include <memory>
+
 // The handwriting wrapper receives stroke data, and then
 // submits them to the backend library (currently Zinnia)
 // to recognize characters.
@@ -23,6 +29,13 @@ enum class Backend : int {
 
 enum class Script : int { SIMPLIFIED, TRADITIONAL };
 
+// In multi-character mode, the canvas is split into a grid of cells with one
+// character in each, read left to right and then top to bottom.
+constexpr int MULTI_CHARACTER_ROWS = 2;
+constexpr int MULTI_CHARACTER_COLUMNS = 2;
+constexpr int MULTI_CHARACTER_CELLS = MULTI_CHARACTER_ROWS
+                                      * MULTI_CHARACTER_COLUMNS;
+
 } // namespace Handwriting
 
 Q_DECLARE_METATYPE(Handwriting::Script)
@@ -32,10 +45,14 @@ class HandwritingWrapper : public QObject
     Q_OBJECT
 
 public:
-    explicit HandwritingWrapper(Handwriting::Script script);
+    explicit HandwritingWrapper(
+        Handwriting::Script script,
+        std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils);
     ~HandwritingWrapper();
 
     bool setRecognizerScript(Handwriting::Script script);
+    void setLiveRecognition(bool enabled);
+    void setMultiCharacter(bool enabled);
 
     void clearStrokes(void);
     bool strokesCleared(void);
@@ -46,17 +63,74 @@ public:
 
 private:
     Utils::Result<bool> copyModels(void) const;
+    Utils::Result<bool> openModels(void);
+    bool requantizeModel(zinnia::Recognizer *recognizer,
+                         const char *model,
+                         const char *quantizedModel) const;
     void showProgressDialog(QString text);
-    void classifyCharacter(void) const;
-
+    void classifyCharacter(void);
+    std::vector<size_t> updateCharacters(void);
+    std::vector<std::string> recognize(zinnia::Recognizer *recognizer,
+                                       std::vector<size_t> cells,
+                                       Handwriting::Script script);
+
+    int rows(void) const;
+    int columns(void) const;
+    size_t cellAt(const std::vector<std::pair<int, int>> &points) const;
+    std::pair<int, int> cellOrigin(size_t cell) const;
+
+    // Both models are opened once, in the background, so that switching
+    // scripts only switches recognizers. _recognizer is the one for _script,
+    // and stays null until the models are ready.
+    zinnia::Recognizer *_simplifiedRecognizer = nullptr;
+    zinnia::Recognizer *_traditionalRecognizer = nullptr;
     zinnia::Recognizer *_recognizer = nullptr;
-    zinnia::Character *_character = nullptr;
+    Handwriting::Script _script;
+
+    // The canvas is split into cells, one per character; outside of
+    // multi-character mode, a single cell covers the whole canvas. Each
+    // completed stroke belongs to the cell its middle is in, and is kept
+    // relative to that cell.
+    struct Cell
+    {
+        std::vector<std::vector<std::pair<int, int>>> strokes;
+
+        // The character handed to the recognizer. It is kept across strokes
+        // and only changed on the GUI thread while no classification is
+        // running; resetCharacter is set when its strokes no longer match
+        // strokes.
+        std::unique_ptr<zinnia::Character> character;
+        bool resetCharacter = false;
+        bool hasCurrentStroke = false;
+
+        // Features of the strokes classified so far, so that only new or
+        // changed strokes are extracted again. Only used by the
+        // classification worker.
+        zinnia::Features features;
+    };
+    std::array<Cell, Handwriting::MULTI_CHARACTER_CELLS> _cells;
+    bool _multiCharacter = false;
+
+    // Words written across several cells are looked up in the dictionary
+    std::shared_ptr<SQLHandwritingUtils> _sqlHandwritingUtils;
+
+    // In live mode, the stroke being drawn is classified as well, at most
+    // once every LIVE_RECOGNITION_INTERVAL milliseconds.
+    bool _liveRecognition = false;
+    QElapsedTimer _liveRecognitionTimer;
 
     QFutureWatcher<Utils::Result<bool>> *_boolReturnWatcher = nullptr;
+
+    // Classification runs on a worker thread, one request at a time. Results
+    // are only emitted if nothing has changed since the request was made;
+    // _generation is bumped whenever the strokes or the model change.
+    QFutureWatcher<std::vector<std::string>> *_classifyWatcher = nullptr;
+    unsigned int _generation = 0;
+    unsigned int _classifyingGeneration = 0;
+    bool _classifyPending = false;
     QProgressDialog *_progressDialog = nullptr;
 
     std::vector<std::pair<int, int>> _currentStrokePoints;
-    std::vector<std::string> _strokes;
     int _width;
     int _height;
 
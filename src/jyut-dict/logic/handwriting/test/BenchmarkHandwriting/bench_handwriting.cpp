@@ -0,0 +1,459 @@
+// Replays a corpus of handwritten characters through one or more recognizer
+// variants, and reports how fast and how accurately each of them classifies.
+//
+// The corpus is in zinnia's training format: one S-expression per line, as
+// parsed by zinnia::Character::parse, e.g.
+//   (character (value 字)(width 300)(height 300)(strokes ((x y)...)...))
+//
+// Every model given with -m is benchmarked with zinnia's recognizer. A model
+// given with -r is benchmarked with the reference recognizer, which scores
+// every class with the merge-join dot product zinnia shipped with; comparing
+// against it shows whether changes to RecognizerImpl::classify change what
+// is recognized. If no models are given, the shipped models are used.
+
+#include "vendor/zinnia/feature.h"
+#include "vendor/zinnia/zinnia.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr auto DEFAULT_NBEST = 10;
+constexpr const char *SHIPPED_MODELS[] = {"handwriting-zh_TW.model",
+                                          "handwriting-zh_CN.model"};
+
+// Returns the resident set size of this process in bytes, or 0 if it can't
+// be determined on this platform
+size_t residentSetSize(void)
+{
+#if defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(),
+                  MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info),
+                  &count)
+        != KERN_SUCCESS) {
+        return 0;
+    }
+    return info.resident_size;
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(),
+                              &counters,
+                              sizeof(counters))) {
+        return 0;
+    }
+    return counters.WorkingSetSize;
+#elif defined(__linux__)
+    std::ifstream statm{"/proc/self/statm"};
+    size_t size = 0;
+    size_t resident = 0;
+    if (!(statm >> size >> resident)) {
+        return 0;
+    }
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+struct Sample
+{
+    std::string value;
+    std::unique_ptr<zinnia::Character> character;
+};
+
+class Variant
+{
+public:
+    virtual ~Variant() = default;
+
+    virtual std::string name(void) const = 0;
+    virtual bool open(void) = 0;
+    virtual void close(void) = 0;
+    virtual std::string error(void) = 0;
+    virtual std::vector<std::string> classify(
+        const zinnia::Character &character, size_t nbest)
+        = 0;
+};
+
+class ZinniaVariant : public Variant
+{
+public:
+    explicit ZinniaVariant(const std::string &model)
+        : _model{model}
+        , _recognizer{zinnia::Recognizer::create()}
+    {}
+
+    std::string name(void) const override { return "zinnia " + _model; }
+
+    bool open(void) override { return _recognizer->open(_model.c_str()); }
+
+    void close(void) override { _recognizer->close(); }
+
+    std::string error(void) override { return _recognizer->what(); }
+
+    std::vector<std::string> classify(const zinnia::Character &character,
+                                      size_t nbest) override
+    {
+        std::vector<std::string> results;
+        std::unique_ptr<zinnia::Result> result{
+            _recognizer->classify(character, nbest)};
+        if (!result) {
+            return results;
+        }
+        for (size_t i = 0; i < result->size(); ++i) {
+            results.emplace_back(result->value(i));
+        }
+        return results;
+    }
+
+private:
+    std::string _model;
+    std::unique_ptr<zinnia::Recognizer> _recognizer;
+};
+
+// Classifies the way zinnia 0.06 did: every model is scored with a
+// merge-join over its features, in a single thread. Only reads binary
+// (version 1) models.
+class ReferenceVariant : public Variant
+{
+public:
+    explicit ReferenceVariant(const std::string &model)
+        : _model{model}
+    {}
+
+    std::string name(void) const override { return "reference " + _model; }
+
+    bool open(void) override
+    {
+        std::ifstream file{_model, std::ios::binary};
+        if (!file) {
+            _error = "no such file or directory: " + _model;
+            return false;
+        }
+        _data.assign(std::istreambuf_iterator<char>{file},
+                     std::istreambuf_iterator<char>{});
+
+        unsigned int header[3];
+        if (_data.size() < sizeof(header)) {
+            _error = "model file is broken";
+            return false;
+        }
+        std::memcpy(header, _data.data(), sizeof(header));
+        if (header[1] != 1) {
+            _error = "only binary (version 1) models can be used as a "
+                     "reference";
+            return false;
+        }
+
+        const char *ptr = _data.data() + sizeof(header);
+        const char *end = _data.data() + _data.size();
+        for (unsigned int i = 0; i < header[2]; ++i) {
+            if (end - ptr < 16 + static_cast<long>(sizeof(float))) {
+                _error = "model file is broken";
+                return false;
+            }
+            Model model;
+            model.character = ptr;
+            std::memcpy(&model.bias, ptr + 16, sizeof(float));
+            ptr += 16 + sizeof(float);
+            model.features = reinterpret_cast<const zinnia::FeatureNode *>(
+                ptr);
+            const zinnia::FeatureNode *x = model.features;
+            while (reinterpret_cast<const char *>(x + 1) <= end
+                   && x->index != -1) {
+                ++x;
+            }
+            if (reinterpret_cast<const char *>(x + 1) > end) {
+                _error = "model file is broken";
+                return false;
+            }
+            ptr = reinterpret_cast<const char *>(x + 1);
+            _models.push_back(model);
+        }
+        return true;
+    }
+
+    void close(void) override
+    {
+        std::vector<Model>().swap(_models);
+        std::vector<char>().swap(_data);
+    }
+
+    std::string error(void) override { return _error; }
+
+    std::vector<std::string> classify(const zinnia::Character &character,
+                                      size_t nbest) override
+    {
+        std::vector<std::string> results;
+        zinnia::Features features;
+        if (!features.read(character)) {
+            return results;
+        }
+
+        std::vector<std::pair<float, const char *>> scores;
+        scores.reserve(_models.size());
+        for (const Model &model : _models) {
+            scores.emplace_back(model.bias
+                                    + zinnia::dot(model.features,
+                                                  features.get()),
+                                model.character);
+        }
+        nbest = std::min(nbest, scores.size());
+        std::partial_sort(scores.begin(),
+                          scores.begin() + nbest,
+                          scores.end(),
+                          std::greater<std::pair<float, const char *>>());
+        for (size_t i = 0; i < nbest; ++i) {
+            results.emplace_back(scores[i].second);
+        }
+        return results;
+    }
+
+private:
+    struct Model
+    {
+        const char *character;
+        float bias;
+        const zinnia::FeatureNode *features;
+    };
+
+    std::string _model;
+    std::string _error;
+    std::vector<char> _data;
+    std::vector<Model> _models;
+};
+
+struct Report
+{
+    std::string name;
+    double openTime = 0;
+    size_t openMemory = 0;
+    size_t memory = 0;
+    std::vector<double> latencies;
+    size_t top1 = 0;
+    size_t topN = 0;
+    std::vector<std::vector<std::string>> results;
+};
+
+double percentile(const std::vector<double> &sorted, double p)
+{
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t rank = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+bool loadCorpus(const std::string &filename, std::vector<Sample> &samples)
+{
+    std::ifstream file{filename};
+    if (!file) {
+        std::cerr << "Could not open corpus " << filename << std::endl;
+        return false;
+    }
+
+    size_t skipped = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        std::unique_ptr<zinnia::Character> character{
+            zinnia::Character::create()};
+        if (!character->parse(line.c_str(), line.size())
+            || character->strokes_size() == 0) {
+            skipped++;
+            continue;
+        }
+        samples.push_back(Sample{character->value(), std::move(character)});
+    }
+    if (skipped) {
+        std::cerr << "Skipped " << skipped << " unreadable characters in "
+                  << filename << std::endl;
+    }
+    return true;
+}
+
+bool run(Variant &variant,
+         const std::vector<Sample> &samples,
+         size_t nbest,
+         Report &report)
+{
+    report.name = variant.name();
+
+    const size_t before = residentSetSize();
+    auto start = std::chrono::steady_clock::now();
+    if (!variant.open()) {
+        std::cerr << report.name << ": " << variant.error() << std::endl;
+        return false;
+    }
+    report.openTime = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    report.openMemory = residentSetSize() - before;
+
+    for (const Sample &sample : samples) {
+        start = std::chrono::steady_clock::now();
+        std::vector<std::string> results = variant.classify(*sample.character,
+                                                            nbest);
+        report.latencies.push_back(
+            std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+
+        if (!results.empty() && results.front() == sample.value) {
+            report.top1++;
+        }
+        if (std::find(results.begin(), results.end(), sample.value)
+            != results.end()) {
+            report.topN++;
+        }
+        report.results.emplace_back(std::move(results));
+    }
+    report.memory = residentSetSize() - before;
+
+    variant.close();
+    return true;
+}
+
+void printReports(const std::vector<Report> &reports,
+                  size_t samples,
+                  size_t nbest)
+{
+    std::printf("%zu characters, top %zu\n\n", samples, nbest);
+    for (const Report &report : reports) {
+        std::vector<double> sorted = report.latencies;
+        std::sort(sorted.begin(), sorted.end());
+        double total = 0;
+        for (double latency : sorted) {
+            total += latency;
+        }
+
+        std::printf("%s\n", report.name.c_str());
+        std::printf("  open        %9.2f ms, %7.1f MB resident\n",
+                    report.openTime,
+                    report.openMemory / 1048576.0);
+        std::printf("  classify    %9.3f ms mean, p50 %.3f, p90 %.3f, "
+                    "p99 %.3f, max %.3f\n",
+                    sorted.empty() ? 0 : total / sorted.size(),
+                    percentile(sorted, 0.50),
+                    percentile(sorted, 0.90),
+                    percentile(sorted, 0.99),
+                    sorted.empty() ? 0 : sorted.back());
+        std::printf("  memory      %9.1f MB resident after classifying\n",
+                    report.memory / 1048576.0);
+        std::printf("  accuracy    %8.2f%% top-1, %.2f%% top-%zu\n",
+                    samples ? 100.0 * report.top1 / samples : 0,
+                    samples ? 100.0 * report.topN / samples : 0,
+                    nbest);
+
+        // Compare every variant's candidates with the first variant's, so
+        // that an optimization can be checked against the reference
+        if (&report != &reports.front()) {
+            const Report &baseline = reports.front();
+            size_t sameTop1 = 0;
+            size_t sameCandidates = 0;
+            for (size_t i = 0; i < samples; ++i) {
+                const std::vector<std::string> &a = baseline.results[i];
+                const std::vector<std::string> &b = report.results[i];
+                if (!a.empty() && !b.empty() && a.front() == b.front()) {
+                    sameTop1++;
+                }
+                if (a == b) {
+                    sameCandidates++;
+                }
+            }
+            std::printf("  vs first    %8.2f%% same top-1, %.2f%% same "
+                        "top-%zu in the same order\n",
+                        samples ? 100.0 * sameTop1 / samples : 0,
+                        samples ? 100.0 * sameCandidates / samples : 0,
+                        nbest);
+        }
+        std::printf("\n");
+    }
+}
+
+void printUsage(const char *program)
+{
+    std::cerr << "Usage: " << program
+              << " [-n nbest] [-r reference-model]... [-m model]... "
+                 "corpus-file..."
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    size_t nbest = DEFAULT_NBEST;
+    std::vector<std::unique_ptr<Variant>> variants;
+    std::vector<std::string> corpora;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "-n" || arg == "-r" || arg == "-m") && i + 1 >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        if (arg == "-n") {
+            nbest = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "-r") {
+            variants.push_back(std::make_unique<ReferenceVariant>(argv[++i]));
+        } else if (arg == "-m") {
+            variants.push_back(std::make_unique<ZinniaVariant>(argv[++i]));
+        } else if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else {
+            corpora.push_back(arg);
+        }
+    }
+    if (corpora.empty() || nbest == 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (variants.empty()) {
+        for (const char *model : SHIPPED_MODELS) {
+            variants.push_back(
+                std::make_unique<ZinniaVariant>(std::string{MODEL_DIR} + model));
+        }
+    }
+
+    std::vector<Sample> samples;
+    for (const std::string &corpus : corpora) {
+        if (!loadCorpus(corpus, samples)) {
+            return 1;
+        }
+    }
+
+    std::vector<Report> reports;
+    for (const std::unique_ptr<Variant> &variant : variants) {
+        Report report;
+        if (!run(*variant, samples, nbest, report)) {
+            return 1;
+        }
+        reports.push_back(std::move(report));
+    }
+
+    printReports(reports, samples.size(), nbest);
+    return 0;
+}
@@ -0,0 +1,40 @@
+#ifndef CANCELLATIONTOKEN_H
+#define CANCELLATIONTOKEN_H
+
+#include <atomic>
+
+// A CancellationToken identifies one search by the epoch it was started in.
+//
+// Each new search increments the epoch counter of its SQLSearch, which
+// cancels every token handed out for earlier searches. Work for a search
+// (preparing the search term, parsing large result sets) should poll
+// isCancelled() and stop early, since nobody will see the results. A query
+// cannot be interrupted once QSqlQuery::exec() is running, so the token is
+// checked just before it starts and again as soon as it returns.
+//
+// A default-constructed token is never cancelled.
+
+class CancellationToken
+{
+public:
+    CancellationToken() = default;
+    CancellationToken(const std::atomic<unsigned long long> *currentEpoch,
+                      unsigned long long epoch)
+        : _currentEpoch{currentEpoch}
+        , _epoch{epoch}
+    {}
+
+    bool isCancelled(void) const
+    {
+        return _currentEpoch
+               && _currentEpoch->load(std::memory_order_relaxed) != _epoch;
+    }
+
+    unsigned long long getEpoch(void) const { return _epoch; }
+
+private:
+    const std::atomic<unsigned long long> *_currentEpoch = nullptr;
+    unsigned long long _epoch = 0;
+};
+
+#endif // CANCELLATIONTOKEN_H
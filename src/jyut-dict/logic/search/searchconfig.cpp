@@ -0,0 +1,59 @@
+#include "searchconfig.h"
+
+#include "logic/settings/settingsutils.h"
+
+#include <mutex>
+
+namespace {
+
+std::mutex configMutex;
+std::shared_ptr<const SearchConfig> currentConfig;
+
+} // namespace
+
+namespace SearchConfigUtils {
+
+SearchConfig readSearchConfig(const QSettings &settings)
+{
+    SearchConfig config;
+    config.autoDetectLanguage = settings
+                                    .value("Search/autoDetectLanguage",
+                                           QVariant{true})
+                                    .toBool();
+    config.fuzzyJyutping = settings
+                               .value("Search/fuzzyJyutping", QVariant{true})
+                               .toBool();
+    config.dangerousFuzzyJyutping = settings
+                                        .value("Search/dangerousFuzzyJyutping",
+                                               QVariant{false})
+                                        .toBool();
+    config.fuzzyPinyin = settings.value("Search/fuzzyPinyin", QVariant{true})
+                             .toBool();
+    return config;
+}
+
+std::shared_ptr<const SearchConfig> getSearchConfig(void)
+{
+    std::lock_guard<std::mutex> lock{configMutex};
+    if (!currentConfig) {
+        std::unique_ptr<QSettings> settings = Settings::getSettings();
+        currentConfig = std::make_shared<const SearchConfig>(
+            readSearchConfig(*settings));
+    }
+    return currentConfig;
+}
+
+void setSearchConfig(const SearchConfig &config)
+{
+    std::shared_ptr<const SearchConfig> newConfig
+        = std::make_shared<const SearchConfig>(config);
+    std::lock_guard<std::mutex> lock{configMutex};
+    currentConfig.swap(newConfig);
+}
+
+void refreshSearchConfig(const QSettings &settings)
+{
+    setSearchConfig(readSearchConfig(settings));
+}
+
+} // namespace SearchConfigUtils
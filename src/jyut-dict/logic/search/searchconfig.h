@@ -0,0 +1,45 @@
+#ifndef SEARCHCONFIG_H
+#define SEARCHCONFIG_H
+
+#include <QSettings>
+
+#include <memory>
+
+// SearchConfig is an immutable snapshot of the settings that change how a
+// search is performed.
+//
+// Search threads should never read from QSettings directly; instead, a
+// snapshot is captured on the thread that starts the search and passed to the
+// worker. This means that the behaviour of a query can be reproduced from
+// the config it was started with.
+
+struct SearchConfig
+{
+    // Read when a search is started rather than in the search thread, to
+    // choose between searching in every language and the selected one
+    bool autoDetectLanguage = true;
+    bool fuzzyJyutping = true;
+    bool dangerousFuzzyJyutping = false;
+    bool fuzzyPinyin = true;
+
+    bool operator==(const SearchConfig &other) const = default;
+};
+
+namespace SearchConfigUtils {
+
+SearchConfig readSearchConfig(const QSettings &settings);
+
+// Returns the most recently published snapshot. If no snapshot has been
+// published yet, one is read from the settings file.
+std::shared_ptr<const SearchConfig> getSearchConfig(void);
+
+// Replaces the current snapshot; searches that are already running keep
+// the snapshot they were started with.
+void setSearchConfig(const SearchConfig &config);
+
+// Call this after writing any of the "Search/" keys in settings.
+void refreshSearchConfig(const QSettings &settings);
+
+} // namespace SearchConfigUtils
+
+#endif // SEARCHCONFIG_H
@@ -790,10 +790,10 @@ constexpr auto SEARCH_UNIQUE_QUERY
       "    SELECT rowid "
       "    FROM entries "
       "    WHERE "
-      "      simplified LIKE ? "
-      "      AND traditional LIKE ? "
-      "      AND jyutping LIKE ? "
-      "      AND pinyin LIKE ? "
+      "      simplified = ? "
+      "      AND traditional = ? "
+      "      AND jyutping = ? "
+      "      AND pinyin = ? "
       "  ), "
       "  matching_definition_ids AS ( "
       "    SELECT definition_id, definition "
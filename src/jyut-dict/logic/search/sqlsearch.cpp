@@ -2,7 +2,6 @@
 
 #include "logic/database/queryparseutils.h"
 #include "logic/search/searchqueries.h"
-#include "logic/settings/settingsutils.h"
 #include "logic/utils/cantoneseutils.h"
 #include "logic/utils/chineseutils.h"
 #include "logic/utils/mandarinutils.h"
@@ -18,10 +17,13 @@
 
 namespace {
 
-void prepareJyutpingBindValues(const QString &searchTerm,
+// Returns false, leaving regexTerm unset, if the token is cancelled while the
+// search term is being prepared.
+bool prepareJyutpingBindValues(const QString &searchTerm,
                                QString &regexTerm,
                                bool fuzzyJyutping,
-                               bool unsafeFuzzyJyutping)
+                               bool unsafeFuzzyJyutping,
+                               const CancellationToken &token)
 {
     // When the search term is surrounded by quotes, search for only term
     // inside quotes (not the quotes themselves)
@@ -41,6 +43,9 @@ void prepareJyutpingBindValues(const QString &searchTerm,
             correctedSearchTerm,
             /* unsafeSubstitutions */ unsafeFuzzyJyutping);
     }
+    if (token.isCancelled()) {
+        return false;
+    }
 
     std::vector<std::string> jyutpingSyllables;
     if (searchExactMatch) {
@@ -58,11 +63,17 @@ void prepareJyutpingBindValues(const QString &searchTerm,
             /* removeGlobCharacters */ false,
             /* removeRegexCharacters= */ !fuzzyJyutping);
     }
+    if (token.isCancelled()) {
+        return false;
+    }
 
     if (!searchExactMatch && fuzzyJyutping) {
         // Attempt to broaden search for sound changes (e.g. nei5 -> lei5)
         CantoneseUtils::jyutpingSoundChanges(jyutpingSyllables);
     }
+    if (token.isCancelled()) {
+        return false;
+    }
 
     // Don't add wildcard characters to GLOB term if searching for exact match
     const char *globJoinDelimiter = searchExactMatch ? "" : "?";
@@ -83,11 +94,16 @@ void prepareJyutpingBindValues(const QString &searchTerm,
                     + QString{(searchExactMatch || dontAppendWildcard) ? ""
                                                                        : "*"};
     }
+
+    return true;
 }
 
-void preparePinyinBindValues(const QString &searchTerm,
+// Returns false, leaving regexTerm unset, if the token is cancelled while the
+// search term is being prepared.
+bool preparePinyinBindValues(const QString &searchTerm,
                              QString &regexTerm,
-                             bool fuzzyPinyin)
+                             bool fuzzyPinyin,
+                             const CancellationToken &token)
 {
     // Replace "v" and "ü" with "u:" since "ü" is stored as "u:" in the table
     QString processedSearchTerm = searchTerm;
@@ -125,10 +141,16 @@ void preparePinyinBindValues(const QString &searchTerm,
                                      /* removeSpecialCharacters */ true,
                                      /* removeGlobCharacters */ false);
     }
+    if (token.isCancelled()) {
+        return false;
+    }
 
     if (!searchExactMatch && fuzzyPinyin) {
         MandarinUtils::pinyinSoundChanges(pinyinSyllables);
     }
+    if (token.isCancelled()) {
+        return false;
+    }
 
     // Don't add wildcard characters to GLOB term if searching for exact match
     const char *globJoinDelimiter = searchExactMatch ? "" : "?";
@@ -149,24 +171,17 @@ void preparePinyinBindValues(const QString &searchTerm,
                     + QString{(searchExactMatch || dontAppendWildcard) ? ""
                                                                        : "*"};
     }
+
+    return true;
 }
 
 } // namespace
 
-SQLSearch::SQLSearch()
-{
-    std::random_device rd;
-    _generator = std::mt19937_64{rd()};
-    _settings = Settings::getSettings();
-}
+SQLSearch::SQLSearch() {}
 
 SQLSearch::SQLSearch(std::shared_ptr<SQLDatabaseManager> manager)
     : _manager{manager}
-{
-    std::random_device rd;
-    _generator = std::mt19937_64{rd()};
-    _settings = Settings::getSettings();
-}
+{}
 
 SQLSearch::~SQLSearch()
 {
@@ -222,10 +237,10 @@ void SQLSearch::notifyObservers(const std::vector<SourceSentence> &results,
 
 // This version assumes an empty result set
 void SQLSearch::notifyObserversOfEmptySet(bool emptyQuery,
-                                          const unsigned long long queryID)
+                                          const CancellationToken &token)
 {
     std::lock_guard<std::mutex> notifyLock{_notifyMutex};
-    if (queryID != _queryID) {
+    if (token.isCancelled()) {
         return;
     }
 
@@ -233,100 +248,94 @@ void SQLSearch::notifyObserversOfEmptySet(bool emptyQuery,
     notifyObservers(results, emptyQuery);
 }
 
-void SQLSearch::notifyObserversIfQueryIdCurrent(SearchParameters params,
-                                                const unsigned long long queryID)
+void SQLSearch::notifyObserversIfCurrent(SearchParameters params,
+                                         const CancellationToken &token)
 {
     std::lock_guard<std::mutex> notifyLock{_notifyMutex};
-    if (queryID != _queryID) {
+    if (token.isCancelled()) {
         return;
     }
 
     notifyObservers(params);
 }
 
-void SQLSearch::notifyObserversIfQueryIdCurrent(const std::vector<Entry> &results,
-                                                bool emptyQuery,
-                                                const unsigned long long queryID)
+void SQLSearch::notifyObserversIfCurrent(const std::vector<Entry> &results,
+                                         bool emptyQuery,
+                                         const CancellationToken &token)
 {
     std::lock_guard<std::mutex> notifyLock{_notifyMutex};
-    if (queryID != _queryID) {
+    if (token.isCancelled()) {
         return;
     }
 
     notifyObservers(results, emptyQuery);
 }
 
-void SQLSearch::notifyObserversIfQueryIdCurrent(const std::vector<SourceSentence> &results,
-                                                bool emptyQuery,
-                                                const unsigned long long queryID)
+void SQLSearch::notifyObserversIfCurrent(const std::vector<SourceSentence> &results,
+                                         bool emptyQuery,
+                                         const CancellationToken &token)
 {
     std::lock_guard<std::mutex> notifyLock{_notifyMutex};
-    if (queryID != _queryID) {
+    if (token.isCancelled()) {
         return;
     }
 
     notifyObservers(results, emptyQuery);
 }
 
-unsigned long long SQLSearch::generateAndSetQueryID(void) {
-    unsigned long long queryID = _dist(_generator);
-    _queryID = queryID;
-    return queryID;
-}
-
-bool SQLSearch::checkQueryIDCurrent(const unsigned long long queryID) const {
-    if (queryID != _queryID) {
-        return false;
-    }
-    return true;
+// Starting a new epoch cancels the tokens of all searches in flight.
+CancellationToken SQLSearch::startNewEpoch(void)
+{
+    unsigned long long epoch = ++_queryEpoch;
+    return CancellationToken{&_queryEpoch, epoch};
 }
 
 void SQLSearch::searchSimplified(const QString &searchTerm)
 {
-    unsigned long long queryID = generateAndSetQueryID();
+    CancellationToken token = startNewEpoch();
     runThread(&SQLSearch::searchSimplifiedThread,
               searchTerm.normalized(QString::NormalizationForm_C),
-              queryID);
+              token);
 }
 
 void SQLSearch::searchTraditional(const QString &searchTerm)
 {
-    unsigned long long queryID = generateAndSetQueryID();
+    CancellationToken token = startNewEpoch();
     runThread(&SQLSearch::searchTraditionalThread,
               searchTerm.normalized(QString::NormalizationForm_C),
-              queryID);
+              token);
 }
 
 void SQLSearch::searchJyutping(const QString &searchTerm)
 {
-    unsigned long long queryID = generateAndSetQueryID();
+    CancellationToken token = startNewEpoch();
     runThread(&SQLSearch::searchJyutpingThread,
               searchTerm.normalized(QString::NormalizationForm_C),
-              queryID);
+              token);
 }
 
 void SQLSearch::searchPinyin(const QString &searchTerm)
 {
-    unsigned long long queryID = generateAndSetQueryID();
+    CancellationToken token = startNewEpoch();
     runThread(&SQLSearch::searchPinyinThread,
               searchTerm.normalized(QString::NormalizationForm_C),
-              queryID);
+              token);
 }
 
 void SQLSearch::searchEnglish(const QString &searchTerm)
 {
-    unsigned long long queryID = generateAndSetQueryID();
+    CancellationToken token = startNewEpoch();
     runThread(&SQLSearch::searchEnglishThread,
               searchTerm.normalized(QString::NormalizationForm_C),
-              queryID);
+              token);
 }
 
 void SQLSearch::searchAutoDetect(const QString &searchTerm)
 {
-    unsigned long long queryId = generateAndSetQueryID();
+    CancellationToken token = startNewEpoch();
     runThread(&SQLSearch::searchAutoDetectThread,
               searchTerm.normalized(QString::NormalizationForm_C),
-              queryId);
+              token);
 }
 
 void SQLSearch::searchByUnique(const QString &simplified,
@@ -339,53 +348,74 @@ void SQLSearch::searchByUnique(const QString &simplified,
         return;
     }
 
-    unsigned long long queryID = generateAndSetQueryID();
-    QFutureWatcher<void> *watcher = new QFutureWatcher<void>();
-    QObject::connect(watcher,
-                     &QFutureWatcher<void>::finished,
-                     watcher,
-                     [this, watcher]() {
-                         {
-                             std::lock_guard lock(_watchers.mut);
-                             _watchers.set.erase(watcher);
-                         }
-                         delete watcher;
-                     });
-    {
-        std::lock_guard lock(_watchers.mut);
-        _watchers.set.emplace(watcher);
-    }
-    watcher->setFuture(
+    CancellationToken token = startNewEpoch();
+    watchThread(
         QtConcurrent::run(&SQLSearch::searchByUniqueThread,
                           this,
                           simplified.normalized(QString::NormalizationForm_C),
                           traditional.normalized(QString::NormalizationForm_C),
                           jyutping.normalized(QString::NormalizationForm_C),
                           pinyin.normalized(QString::NormalizationForm_C),
-                          queryID));
+                          token));
 }
 
 void SQLSearch::searchTraditionalSentences(const QString &searchTerm)
 {
-    unsigned long long queryID = generateAndSetQueryID();
+    CancellationToken token = startNewEpoch();
     runThread(&SQLSearch::searchTraditionalSentencesThread,
               searchTerm.normalized(QString::NormalizationForm_C),
-              queryID);
+              token);
 }
 
-void SQLSearch::runThread(void (SQLSearch::*threadFunction)(const QString &searchTerm, const unsigned long long queryID),
-                          const QString &searchTerm, const unsigned long long queryID)
+void SQLSearch::runThread(void (SQLSearch::*threadFunction)(const QString &searchTerm,
+                                                            const SearchConfig &config,
+                                                            const CancellationToken &token),
+                          const QString &searchTerm,
+                          const CancellationToken &token)
 {
-    if (searchTerm.isEmpty()) {
-        notifyObserversOfEmptySet(true, queryID);
+    if (!canRunThread(searchTerm, token)) {
+        return;
+    }
+
+    watchThread(QtConcurrent::run(threadFunction,
+                                  this,
+                                  searchTerm,
+                                  *SearchConfigUtils::getSearchConfig(),
+                                  token));
+}
+
+void SQLSearch::runThread(void (SQLSearch::*threadFunction)(const QString &searchTerm,
+                                                            const CancellationToken &token),
+                          const QString &searchTerm,
+                          const CancellationToken &token)
+{
+    if (!canRunThread(searchTerm, token)) {
         return;
     }
 
+    watchThread(QtConcurrent::run(threadFunction, this, searchTerm, token));
+}
+
+bool SQLSearch::canRunThread(const QString &searchTerm,
+                             const CancellationToken &token)
+{
+    if (searchTerm.isEmpty()) {
+        notifyObserversOfEmptySet(true, token);
+        return false;
+    }
+
     if (!_manager) {
         std::cout << "No database specified!" << std::endl;
-        return;
+        return false;
     }
 
+    return true;
+}
+
+// The watcher is kept until the thread finishes, so that the destructor
+// can wait for every search that is still running.
+void SQLSearch::watchThread(QFuture<void> future)
+{
     QFutureWatcher<void> *watcher = new QFutureWatcher<void>();
     QObject::connect(watcher,
                      &QFutureWatcher<void>::finished,
@@ -401,8 +431,7 @@ void SQLSearch::runThread(void (SQLSearch::*threadFunction)(const QString &searc
         std::lock_guard lock(_watchers.mut);
         _watchers.set.emplace(watcher);
     }
-    watcher->setFuture(
-        QtConcurrent::run(threadFunction, this, searchTerm, queryID));
+    watcher->setFuture(future);
 }
 
 // NOTE: If you are modifying these functions, you may also want to modify
@@ -411,7 +440,7 @@ void SQLSearch::runThread(void (SQLSearch::*threadFunction)(const QString &searc
 // For searching simplified and traditional, we use GLOB, so that wildcard
 // characters like * and ? can be used.
 void SQLSearch::searchSimplifiedThread(const QString &searchTerm,
-                                       const unsigned long long queryID)
+                                       const CancellationToken &token)
 {
     // When the search term is surrounded by quotes, search for only term
     // inside quotes (not the quotes themselves)
@@ -441,22 +470,29 @@ void SQLSearch::searchSimplifiedThread(const QString &searchTerm,
         query.addBindValue(searchTerm + "*");
     }
     query.setForwardOnly(true);
+    // A query cannot be interrupted once it is running, so don't start one
+    // that has already been superseded
+    if (token.isCancelled()) {
+        return;
+    }
     query.exec();
 
     // Do not parse results if new query has been made
-    if (!checkQueryIDCurrent(queryID)) {
+    if (token.isCancelled()) {
         return;
     }
-    results = QueryParseUtils::parseEntries(query);
+    results = QueryParseUtils::parseEntries(query,
+                                            /*parseDefinitions=*/true,
+                                            token);
 
-    if (!checkQueryIDCurrent(queryID)) {
+    if (token.isCancelled()) {
         return;
     }
-    notifyObserversIfQueryIdCurrent(results, /*emptyQuery=*/false, queryID);
+    notifyObserversIfCurrent(results, /*emptyQuery=*/false, token);
 }
 
 void SQLSearch::searchTraditionalThread(const QString &searchTerm,
-                                        const unsigned long long queryID)
+                                        const CancellationToken &token)
 {
     bool searchExactMatch
         = ((searchTerm.startsWith("\"") && searchTerm.endsWith("\""))
@@ -484,16 +520,23 @@ void SQLSearch::searchTraditionalThread(const QString &searchTerm,
         query.addBindValue(searchTerm + "*");
     }
     query.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return;
+    }
     query.exec();
 
     // Do not parse results if new query has been made
-    if (!checkQueryIDCurrent(queryID)) {
+    if (token.isCancelled()) {
         return;
     }
-    results = QueryParseUtils::parseEntries(query);
+    results = QueryParseUtils::parseEntries(query,
+                                            /*parseDefinitions=*/true,
+                                            token);
 
-    if (!checkQueryIDCurrent(queryID)) { return; }
-    notifyObserversIfQueryIdCurrent(results, /*emptyQuery=*/false, queryID);
+    if (token.isCancelled()) {
+        return;
+    }
+    notifyObserversIfCurrent(results, /*emptyQuery=*/false, token);
 }
 
 // For searching Jyutping and Pinyin, we use GLOB, so that wildcard characters
@@ -503,68 +546,86 @@ void SQLSearch::searchTraditionalThread(const QString &searchTerm,
 // surrounds the bound value with single quotes, i.e. "'". There is no need
 // to add another set of quotes around placeholder values.
 void SQLSearch::searchJyutpingThread(const QString &searchTerm,
-                                     const unsigned long long queryID)
+                                     const SearchConfig &config,
+                                     const CancellationToken &token)
 {
     std::vector<Entry> results;
 
     QSqlQuery query{_manager->getDatabase()};
 
-    bool fuzzyJyutping
-        = _settings->value("Search/fuzzyJyutping", QVariant{true}).toBool();
-    bool unsafeFuzzyJyutping = _settings
-                                   ->value("Search/dangerousFuzzyJyutping",
-                                           QVariant{false})
-                                   .toBool();
-
-    query.prepare(QString{SEARCH_JYUTPING_QUERY}.arg(fuzzyJyutping ? REGEXP_STR
-                                                                   : GLOB_STR));
+    query.prepare(QString{SEARCH_JYUTPING_QUERY}.arg(
+        config.fuzzyJyutping ? REGEXP_STR : GLOB_STR));
 
     QString globTerm;
-    prepareJyutpingBindValues(searchTerm,
-                              globTerm,
-                              fuzzyJyutping,
-                              unsafeFuzzyJyutping);
+    if (!prepareJyutpingBindValues(searchTerm,
+                                   globTerm,
+                                   config.fuzzyJyutping,
+                                   config.dangerousFuzzyJyutping,
+                                   token)) {
+        return;
+    }
     query.addBindValue(globTerm);
     query.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return;
+    }
     query.exec();
 
     // Do not parse results if new query has been made
-    if (!checkQueryIDCurrent(queryID)) { return; }
-    results = QueryParseUtils::parseEntries(query);
+    if (token.isCancelled()) {
+        return;
+    }
+    results = QueryParseUtils::parseEntries(query,
+                                            /*parseDefinitions=*/true,
+                                            token);
 
-    if (!checkQueryIDCurrent(queryID)) { return; }
-    notifyObserversIfQueryIdCurrent(results, /*emptyQuery=*/false, queryID);
+    if (token.isCancelled()) {
+        return;
+    }
+    notifyObserversIfCurrent(results, /*emptyQuery=*/false, token);
 }
 
 void SQLSearch::searchPinyinThread(const QString &searchTerm,
-                                   const unsigned long long queryID)
+                                   const SearchConfig &config,
+                                   const CancellationToken &token)
 {
     std::vector<Entry> results;
 
     QSqlQuery query{_manager->getDatabase()};
 
-    bool fuzzyPinyin
-        = _settings->value("Search/fuzzyPinyin", QVariant{true}).toBool();
-
-    query.prepare(
-        QString{SEARCH_PINYIN_QUERY}.arg(fuzzyPinyin ? REGEXP_STR : GLOB_STR));
+    query.prepare(QString{SEARCH_PINYIN_QUERY}.arg(
+        config.fuzzyPinyin ? REGEXP_STR : GLOB_STR));
 
     QString globTerm;
-    preparePinyinBindValues(searchTerm, globTerm, fuzzyPinyin);
+    if (!preparePinyinBindValues(searchTerm,
+                                 globTerm,
+                                 config.fuzzyPinyin,
+                                 token)) {
+        return;
+    }
     query.addBindValue(globTerm);
     query.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return;
+    }
     query.exec();
 
     // Do not parse results if new query has been made
-    if (!checkQueryIDCurrent(queryID)) { return; }
-    results = QueryParseUtils::parseEntries(query);
+    if (token.isCancelled()) {
+        return;
+    }
+    results = QueryParseUtils::parseEntries(query,
+                                            /*parseDefinitions=*/true,
+                                            token);
 
-    if (!checkQueryIDCurrent(queryID)) { return; }
-    notifyObserversIfQueryIdCurrent(results, /*emptyQuery=*/false, queryID);
+    if (token.isCancelled()) {
+        return;
+    }
+    notifyObserversIfCurrent(results, /*emptyQuery=*/false, token);
 }
 
 void SQLSearch::searchEnglishThread(const QString &searchTerm,
-                                    const unsigned long long queryID)
+                                    const CancellationToken &token)
 {
     bool searchExactMatch = searchTerm.startsWith("\"")
                             && searchTerm.endsWith("\"")
@@ -586,93 +647,128 @@ void SQLSearch::searchEnglishThread(const QString &searchTerm,
         query.addBindValue("%" + searchTerm + "%");
     }
     query.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return;
+    }
     query.exec();
 
     // Do not parse results if new query has been made
-    if (!checkQueryIDCurrent(queryID)) {
+    if (token.isCancelled()) {
         return;
     }
-    results = QueryParseUtils::parseEntries(query);
+    results = QueryParseUtils::parseEntries(query,
+                                            /*parseDefinitions=*/true,
+                                            token);
 
-    if (!checkQueryIDCurrent(queryID)) {
+    if (token.isCancelled()) {
         return;
     }
-    notifyObserversIfQueryIdCurrent(results, /*emptyQuery=*/false, queryID);
+    notifyObserversIfCurrent(results, /*emptyQuery=*/false, token);
 }
 
 void SQLSearch::searchAutoDetectThread(const QString &searchTerm,
-                                       const unsigned long long queryID)
+                                       const SearchConfig &config,
+                                       const CancellationToken &token)
 {
     ScriptDetector sd{searchTerm};
     if (sd.containsSimplifiedChinese()) {
-        notifyObserversIfQueryIdCurrent(SearchParameters::SIMPLIFIED, queryID);
-        searchSimplifiedThread(searchTerm, queryID);
+        notifyObserversIfCurrent(SearchParameters::SIMPLIFIED, token);
+        searchSimplifiedThread(searchTerm, token);
         return;
     }
     if (sd.containsTraditionalChinese() || sd.containsChinese()) {
-        notifyObserversIfQueryIdCurrent(SearchParameters::TRADITIONAL, queryID);
-        searchTraditionalThread(searchTerm, queryID);
+        notifyObserversIfCurrent(SearchParameters::TRADITIONAL, token);
+        searchTraditionalThread(searchTerm, token);
+        return;
+    }
+    if (token.isCancelled()) {
         return;
     }
-
-    bool fuzzyJyutping
-        = _settings->value("Search/fuzzyJyutping", QVariant{true}).toBool();
-    bool unsafeFuzzyJyutping = _settings
-                                   ->value("Search/unsafeFuzzyJyutping",
-                                           QVariant{false})
-                                   .toBool();
-    bool fuzzyPinyin
-        = _settings->value("Search/fuzzyPinyin", QVariant{true}).toBool();
 
     QSqlQuery jyutpingQuery{_manager->getDatabase()};
     jyutpingQuery.prepare(QString{SEARCH_JYUTPING_EXISTS_QUERY}.arg(
-        fuzzyJyutping ? REGEXP_STR : GLOB_STR));
+        config.fuzzyJyutping ? REGEXP_STR : GLOB_STR));
     QString jyutpingSearchTerm;
-    prepareJyutpingBindValues(searchTerm,
-                              jyutpingSearchTerm,
-                              fuzzyJyutping,
-                              unsafeFuzzyJyutping);
+    if (!prepareJyutpingBindValues(searchTerm,
+                                   jyutpingSearchTerm,
+                                   config.fuzzyJyutping,
+                                   config.dangerousFuzzyJyutping,
+                                   token)) {
+        return;
+    }
     jyutpingQuery.addBindValue(jyutpingSearchTerm);
     jyutpingQuery.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return;
+    }
     jyutpingQuery.exec();
     bool jyutpingExists = QueryParseUtils::parseExistence(jyutpingQuery);
+    if (token.isCancelled()) {
+        return;
+    }
 
     if (jyutpingExists) {
-        notifyObserversIfQueryIdCurrent(SearchParameters::JYUTPING, queryID);
-        searchJyutpingThread(searchTerm, queryID);
+        notifyObserversIfCurrent(SearchParameters::JYUTPING, token);
+        searchJyutpingThread(searchTerm, config, token);
         return;
     }
 
     QSqlQuery pinyinQuery{_manager->getDatabase()};
     pinyinQuery.prepare(QString{SEARCH_PINYIN_EXISTS_QUERY}.arg(
-        fuzzyPinyin ? REGEXP_STR : GLOB_STR));
+        config.fuzzyPinyin ? REGEXP_STR : GLOB_STR));
     QString pinyinSearchTerm;
-    preparePinyinBindValues(searchTerm, pinyinSearchTerm, fuzzyPinyin);
+    if (!preparePinyinBindValues(searchTerm,
+                                 pinyinSearchTerm,
+                                 config.fuzzyPinyin,
+                                 token)) {
+        return;
+    }
     pinyinQuery.addBindValue(pinyinSearchTerm);
     pinyinQuery.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return;
+    }
     pinyinQuery.exec();
     bool pinyinExists = QueryParseUtils::parseExistence(pinyinQuery);
+    if (token.isCancelled()) {
+        return;
+    }
 
     if (pinyinExists) {
-        notifyObserversIfQueryIdCurrent(SearchParameters::PINYIN, queryID);
-        searchPinyinThread(searchTerm, queryID);
+        notifyObserversIfCurrent(SearchParameters::PINYIN, token);
+        searchPinyinThread(searchTerm, config, token);
         return;
     }
 
-    notifyObserversIfQueryIdCurrent(SearchParameters::ENGLISH, queryID);
-    searchEnglishThread(searchTerm, queryID);
+    notifyObserversIfCurrent(SearchParameters::ENGLISH, token);
+    searchEnglishThread(searchTerm, token);
     return;
 }
 
 // To seach by unique, select by all the attributes that we have.
-void SQLSearch::searchByUniqueThread(const QString &simplified,
-                                     const QString &traditional,
-                                     const QString &jyutping,
-                                     const QString &pinyin,
-                                     const unsigned long long queryID)
+std::vector<Entry> SQLSearch::lookUpByUnique(const QString &simplified,
+                                             const QString &traditional,
+                                             const QString &jyutping,
+                                             const QString &pinyin)
 {
-    std::vector<Entry> results;
+    if (!_manager) {
+        std::cout << "No database specified!" << std::endl;
+        return {};
+    }
 
+    return queryByUnique(simplified.normalized(QString::NormalizationForm_C),
+                         traditional.normalized(QString::NormalizationForm_C),
+                         jyutping.normalized(QString::NormalizationForm_C),
+                         pinyin.normalized(QString::NormalizationForm_C),
+                         CancellationToken{});
+}
+
+std::vector<Entry> SQLSearch::queryByUnique(const QString &simplified,
+                                            const QString &traditional,
+                                            const QString &jyutping,
+                                            const QString &pinyin,
+                                            const CancellationToken &token)
+{
     QSqlQuery query{_manager->getDatabase()};
     query.prepare(SEARCH_UNIQUE_QUERY);
     query.addBindValue(simplified);
@@ -680,24 +776,39 @@ void SQLSearch::searchByUniqueThread(const QString &simplified,
     query.addBindValue(jyutping);
     query.addBindValue(pinyin);
     query.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return {};
+    }
     query.exec();
 
     // Do not parse results if new query has been made
-    if (!checkQueryIDCurrent(queryID)) {
-        return;
+    if (token.isCancelled()) {
+        return {};
     }
-    results = QueryParseUtils::parseEntries(query);
+    return QueryParseUtils::parseEntries(query,
+                                         /*parseDefinitions=*/true,
+                                         token);
+}
 
-    if (!checkQueryIDCurrent(queryID)) {
+void SQLSearch::searchByUniqueThread(const QString &simplified,
+                                     const QString &traditional,
+                                     const QString &jyutping,
+                                     const QString &pinyin,
+                                     const CancellationToken &token)
+{
+    std::vector<Entry> results
+        = queryByUnique(simplified, traditional, jyutping, pinyin, token);
+
+    if (token.isCancelled()) {
         return;
     }
-    notifyObserversIfQueryIdCurrent(results, /*emptyQuery=*/false, queryID);
+    notifyObserversIfCurrent(results, /*emptyQuery=*/false, token);
 }
 
 // To search for sentences, use the sentence_links table to JOIN
 // between the chinese and non_chinese_sentences tables.
 void SQLSearch::searchTraditionalSentencesThread(const QString &searchTerm,
-                                                 const unsigned long long queryID)
+                                                 const CancellationToken &token)
 {
     std::vector<SourceSentence> results;
 
@@ -705,13 +816,18 @@ void SQLSearch::searchTraditionalSentencesThread(const QString &searchTerm,
     query.prepare(SEARCH_TRADITIONAL_SENTENCES_QUERY);
     query.addBindValue("%" + searchTerm + "%");
     query.setForwardOnly(true);
+    if (token.isCancelled()) {
+        return;
+    }
     query.exec();
 
-    if (!checkQueryIDCurrent(queryID)) {
+    if (token.isCancelled()) {
         return;
     }
-    results = QueryParseUtils::parseSentences(query);
+    results = QueryParseUtils::parseSentences(query, token);
 
-    if (!checkQueryIDCurrent(queryID)) { return; }
-    notifyObserversIfQueryIdCurrent(results, /*emptyQuery=*/false, queryID);
+    if (token.isCancelled()) {
+        return;
+    }
+    notifyObserversIfCurrent(results, /*emptyQuery=*/false, token);
 }
@@ -3,8 +3,10 @@
 
 #include "logic/database/sqldatabasemanager.h"
 #include "logic/entry/entry.h"
+#include "logic/search/cancellationtoken.h"
 #include "logic/search/isearch.h"
 #include "logic/search/isearchobservable.h"
+#include "logic/search/searchconfig.h"
 
 #include <QList>
 #include <QtSql>
@@ -13,7 +15,6 @@
 #include <list>
 #include <memory>
 #include <mutex>
-#include <random>
 #include <vector>
 
 // SQLSearch searches the database provided by SQLDatabaseManager.
@@ -52,6 +53,15 @@ public:
                         const QString &jyutping,
                         const QString &pinyin) override;
 
+    // Unlike searchByUnique(), this looks up the entry on the calling thread
+    // and returns it instead of notifying observers. It is meant for callers
+    // that only keep the headwords and romanization of an entry, like
+    // ResultListModel, and need the full entry back.
+    std::vector<Entry> lookUpByUnique(const QString &simplified,
+                                      const QString &traditional,
+                                      const QString &jyutping,
+                                      const QString &pinyin);
+
     void searchTraditionalSentences(const QString &searchTerm);
 
 private:
@@ -60,53 +70,66 @@ private:
     void notifyObservers(const std::vector<SourceSentence> &results,
                          bool emptyQuery) override;
     void notifyObserversOfEmptySet(bool emptyQuery,
-                                   const unsigned long long queryID);
-    void notifyObserversIfQueryIdCurrent(SearchParameters params,
-                                         const unsigned long long queryID);
-    void notifyObserversIfQueryIdCurrent(const std::vector<Entry> &results,
-                                         bool emptyQuery,
-                                         const unsigned long long queryID);
-    void notifyObserversIfQueryIdCurrent(const std::vector<SourceSentence> &results,
-                                         bool emptyQuery,
-                                         const unsigned long long queryID);
-
-    unsigned long long generateAndSetQueryID(void);
-    bool checkQueryIDCurrent(const unsigned long long queryID) const;
+                                   const CancellationToken &token);
+    void notifyObserversIfCurrent(SearchParameters params,
+                                  const CancellationToken &token);
+    void notifyObserversIfCurrent(const std::vector<Entry> &results,
+                                  bool emptyQuery,
+                                  const CancellationToken &token);
+    void notifyObserversIfCurrent(const std::vector<SourceSentence> &results,
+                                  bool emptyQuery,
+                                  const CancellationToken &token);
+
+    CancellationToken startNewEpoch(void);
 
     void runThread(void (SQLSearch::*threadFunction)(const QString &searchTerm,
-                                                     const unsigned long long queryID),
-                   const QString &searchTerm, const unsigned long long queryID);
+                                                     const SearchConfig &config,
+                                                     const CancellationToken &token),
+                   const QString &searchTerm,
+                   const CancellationToken &token);
+    void runThread(void (SQLSearch::*threadFunction)(const QString &searchTerm,
+                                                     const CancellationToken &token),
+                   const QString &searchTerm,
+                   const CancellationToken &token);
+    bool canRunThread(const QString &searchTerm, const CancellationToken &token);
+    void watchThread(QFuture<void> future);
+
     void searchSimplifiedThread(const QString &searchTerm,
-                                const unsigned long long queryID);
+                                const CancellationToken &token);
     void searchTraditionalThread(const QString &searchTerm,
-                                 const unsigned long long queryID);
+                                 const CancellationToken &token);
     void searchJyutpingThread(const QString &searchTerm,
-                              const unsigned long long queryID);
+                              const SearchConfig &config,
+                              const CancellationToken &token);
     void searchPinyinThread(const QString &searchTerm,
-                            const unsigned long long queryID);
+                            const SearchConfig &config,
+                            const CancellationToken &token);
     void searchEnglishThread(const QString &searchTerm,
-                             const unsigned long long queryID);
+                             const CancellationToken &token);
     void searchAutoDetectThread(const QString &searchTerm,
-                                const unsigned long long queryID);
-
+                                const SearchConfig &config,
+                                const CancellationToken &token);
+
+    std::vector<Entry> queryByUnique(const QString &simplified,
+                                     const QString &traditional,
+                                     const QString &jyutping,
+                                     const QString &pinyin,
+                                     const CancellationToken &token);
     void searchByUniqueThread(const QString &simplified,
                               const QString &traditional,
                               const QString &jyutping,
                               const QString &pinyin,
-                              const unsigned long long queryID);
+                              const CancellationToken &token);
 
     void searchTraditionalSentencesThread(const QString &searchTerm,
-                                          const unsigned long long queryID);
+                                          const CancellationToken &token);
 
     std::mutex _notifyMutex;
     std::list<ISearchObserver *> _observers;
 
     std::shared_ptr<SQLDatabaseManager> _manager;
-    std::unique_ptr<QSettings> _settings;
-
-    std::atomic<unsigned long long> _queryID;
-    std::mt19937_64 _generator;
-    std::uniform_int_distribution<unsigned long long> _dist;
+    // Incremented every time a search is started; see CancellationToken.
+    std::atomic<unsigned long long> _queryEpoch{0};
 
     FutureList _watchers;
 };
@@ -1,7 +1,11 @@
+#include "logic/database/queryparseutils.h"
 #include "logic/database/sqldatabasemanager.h"
 #include "logic/database/sqldatabaseutils.h"
 #include "logic/entry/entry.h"
+#include "logic/search/cancellationtoken.h"
 #include "logic/search/isearchobserver.h"
+#include "logic/search/searchconfig.h"
+#include "logic/search/searchqueries.h"
 #include "logic/search/sqlsearch.h"
 
 #include <QSqlDatabase>
@@ -21,15 +25,14 @@ public:
         _sentences = sentences;
     }
 
-    void callback(const std::vector<Entry> &entries, bool emptyQuery) override
+    void callback(const std::vector<Entry> &entries, bool) override
     {
         if (entries != _entries) {
             testFailed = true;
         }
         resultsReady.notify_one();
     }
-    void callback(const std::vector<SourceSentence> &sentences,
-                  bool emptyQuery) override
+    void callback(const std::vector<SourceSentence> &sentences, bool) override
     {
         if (sentences != _sentences) {
             testFailed = true;
@@ -45,6 +48,45 @@ private:
     std::vector<Entry> _entries;
     std::vector<SourceSentence> _sentences;
 };
+
+// Holds up the first search that reports its detected language, until
+// release() is called, and records every result set it is given.
+class BlockingObserver : public ISearchObserver
+{
+public:
+    void detectedLanguage(SearchParameters) override
+    {
+        std::unique_lock lock{mutex};
+        blocked = true;
+        changed.notify_all();
+        changed.wait(lock, [this]() { return released; });
+    }
+
+    void callback(const std::vector<Entry> &entries, bool) override
+    {
+        std::lock_guard lock{mutex};
+        results.push_back(entries);
+    }
+
+    void waitUntilBlocked(void)
+    {
+        std::unique_lock lock{mutex};
+        changed.wait(lock, [this]() { return blocked; });
+    }
+
+    void release(void)
+    {
+        std::lock_guard lock{mutex};
+        released = true;
+        changed.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool blocked = false;
+    bool released = false;
+    std::vector<std::vector<Entry>> results;
+};
 } // namespace
 
 class TestSqlSearch : public QObject
@@ -64,6 +106,7 @@ private slots:
 
     void searchJyutping();
     void searchJyutpingNoResults();
+    void searchJyutpingUsesSearchConfig();
 
     void searchPinyin();
     void searchPinyinNoResults();
@@ -75,8 +118,12 @@ private slots:
     void searchAutoDetectNoResults();
 
     void searchUnique();
+    void lookUpUnique();
     void searchTraditionalSentences();
 
+    void parseEntriesStopsWhenCancelled();
+    void searchDoesNotNotifyWhenSuperseded();
+
 private:
     void createV3Database(const QString &dbPath);
 
@@ -749,6 +796,62 @@ void TestSqlSearch::searchJyutpingNoResults()
     }
 }
 
+void TestSqlSearch::searchJyutpingUsesSearchConfig()
+{
+    TestObserver observer;
+    SQLSearch search{_manager};
+
+    search.registerObserver(&observer);
+
+    SearchConfig originalConfig = *SearchConfigUtils::getSearchConfig();
+    SearchConfig config = originalConfig;
+    config.fuzzyJyutping = false;
+    SearchConfigUtils::setSearchConfig(config);
+
+    // Without fuzzy Jyutping, the search term is not autocorrected
+    std::vector<Entry> expected;
+    observer.setExpected(expected);
+    search.searchJyutping("yuetshow");
+    {
+        std::unique_lock lock{observer.mutex};
+        observer.resultsReady.wait(lock);
+        QCOMPARE(observer.testFailed, false);
+    }
+
+    std::vector<Sentence::TargetSentence> translations = {
+        {"How long does it take to walk from here to Yuexiu Park?", "eng", true},
+    };
+    std::vector<SentenceSet> translationSets = {
+        {"Wiktionary", translations},
+    };
+    std::vector<SourceSentence> sentences = {
+        {"cmn",
+         "从这里走路去越秀公园要多久？",
+         "從這裡走路去越秀公園要多久？",
+         "cung4 ze2 leoi5 zau2 lou6 heoi3 jyut6 sau3 gung1 jyun2 jiu3 do1 "
+         "gau2 ？",
+         "cong2 zhe4 li3 zou3 lu4 qu4 yue4 xiu4 gong1 yuan2 yao4 duo1 jiu3 ？",
+         translationSets},
+    };
+    std::vector<DefinitionsSet> definitions = {
+        {"Wiktionary", {{"Yuexiu (a district)", "name", sentences}}},
+    };
+    expected = {
+        {"越秀", "越秀", "jyut6 sau3", "yue4 xiu4", definitions},
+    };
+    observer.setExpected(expected);
+    config.fuzzyJyutping = true;
+    SearchConfigUtils::setSearchConfig(config);
+    search.searchJyutping("yuetshow");
+    {
+        std::unique_lock lock{observer.mutex};
+        observer.resultsReady.wait(lock);
+        QCOMPARE(observer.testFailed, false);
+    }
+
+    SearchConfigUtils::setSearchConfig(originalConfig);
+}
+
 void TestSqlSearch::searchPinyin()
 {
     TestObserver observer;
@@ -1314,6 +1417,48 @@ void TestSqlSearch::searchUnique()
     }
 }
 
+void TestSqlSearch::lookUpUnique()
+{
+    TestObserver observer;
+    SQLSearch search{_manager};
+
+    // The lookup returns its results instead of notifying observers, so an
+    // observer that expects nothing fails the test if it is notified
+    search.registerObserver(&observer);
+    observer.setExpected(std::vector<Entry>{});
+
+    std::vector<DefinitionsSet> definitions = {
+        {"CC-CANTO", {{"Baiyun Mountain", "noun", {}}}},
+    };
+    std::vector<Entry> expected = {
+        {"白云山", "白雲山", "baak6 wan4 saan1", "bai2 yun2 shan1", definitions},
+    };
+    QCOMPARE(search.lookUpByUnique("白云山",
+                                   "白雲山",
+                                   "baak6 wan4 saan1",
+                                   "bai2 yun2 shan1"),
+             expected);
+
+    QCOMPARE(search.lookUpByUnique("白雲山",
+                                   "白雲山",
+                                   "baak6 wan4 saan1",
+                                   "bai2 yun2 shan1"),
+             std::vector<Entry>{});
+
+    definitions = {
+        {"CC-CANTO", {{"more", "adverb", {}}}},
+    };
+    expected = {
+        {"更", "更", "gang3", "geng4", definitions},
+    };
+    // As with searchByUnique, the string being looked up is U+F901, but the
+    // one in the dictionary is U+66F4
+    QCOMPARE(search.lookUpByUnique("更", "更", "gang3", "geng4"), expected);
+
+    search.deregisterObserver(&observer);
+    QCOMPARE(observer.testFailed, false);
+}
+
 void TestSqlSearch::searchTraditionalSentences()
 {
     TestObserver observer;
@@ -1354,6 +1499,58 @@ void TestSqlSearch::searchTraditionalSentences()
     }
 }
 
+void TestSqlSearch::parseEntriesStopsWhenCancelled()
+{
+    QSqlQuery query{_manager->getDatabase()};
+    query.prepare(SEARCH_SIMPLIFIED_QUERY);
+    query.addBindValue("*");
+    query.setForwardOnly(true);
+    query.exec();
+
+    // A token from an earlier epoch is cancelled, so parsing should stop at
+    // the first row instead of reading the rest of the result set
+    std::atomic<unsigned long long> epoch{1};
+    std::vector<Entry> entries
+        = QueryParseUtils::parseEntries(query,
+                                        /*parseDefinitions=*/true,
+                                        CancellationToken{&epoch, 0});
+    QCOMPARE(entries.empty(), true);
+    QCOMPARE(query.at(), 0);
+
+    query.exec();
+    entries = QueryParseUtils::parseEntries(query,
+                                            /*parseDefinitions=*/true,
+                                            CancellationToken{&epoch, 1});
+    QCOMPARE(entries.size() > 1, true);
+}
+
+void TestSqlSearch::searchDoesNotNotifyWhenSuperseded()
+{
+    BlockingObserver observer;
+    {
+        SQLSearch search{_manager};
+        search.registerObserver(&observer);
+
+        // The first search is held up while it reports its language, and a
+        // second search is started in the meantime
+        search.searchAutoDetect("越秀");
+        observer.waitUntilBlocked();
+        search.searchTraditional("白雲山");
+        observer.release();
+
+        // Destroying the search waits for both threads to finish
+    }
+
+    std::vector<DefinitionsSet> definitions = {
+        {"CC-CANTO", {{"Baiyun Mountain", "noun", {}}}},
+    };
+    std::vector<Entry> expected = {
+        {"白云山", "白雲山", "baak6 wan4 saan1", "bai2 yun2 shan1", definitions},
+    };
+    QCOMPARE(observer.results.size(), size_t{1});
+    QCOMPARE(observer.results.front() == expected, true);
+}
+
 QTEST_MAIN(TestSqlSearch)
 
 #include "tst_sqlsearch.moc"
@@ -2,17 +2,19 @@
 
 #include "logic/dictionary/dictionarysource.h"
 
-SentenceSet::SentenceSet(const std::string &source)
+SentenceSet::SentenceSet(InternedString source)
     : _source{source}
-    , _sourceShortString{DictionarySourceUtils::getSourceShortString(source)}
+    , _sourceShortString{
+          DictionarySourceUtils::getSourceShortString(_source.str())}
 {
 }
 
-SentenceSet::SentenceSet(const std::string &source,
-                         const std::vector<Sentence::TargetSentence> &sentences)
+SentenceSet::SentenceSet(InternedString source,
+                         std::vector<Sentence::TargetSentence> sentences)
     : _source{source}
-    , _sourceShortString{DictionarySourceUtils::getSourceShortString(source)}
-    , _sentences{sentences}
+    , _sourceShortString{
+          DictionarySourceUtils::getSourceShortString(_source.str())}
+    , _sentences{std::move(sentences)}
 {
 }
 
@@ -33,31 +35,36 @@ bool SentenceSet::isEmpty(void) const
            || std::all_of(_sentences.begin(),
                           _sentences.end(),
                           [](const Sentence::TargetSentence &sentence) {
-                              return sentence.sentence == ""
-                                     && sentence.language == ""
+                              return sentence.sentence.empty()
+                                     && sentence.language.empty()
                                      && sentence.directTarget == false;
                           });
 }
 
-bool SentenceSet::pushSentence(const Sentence::TargetSentence &sentence)
+bool SentenceSet::pushSentence(Sentence::TargetSentence sentence)
 {
-    _sentences.push_back(sentence);
+    _sentences.push_back(std::move(sentence));
     return true;
 }
 
-const std::string &SentenceSet::getSource(void) const
+InternedString SentenceSet::getInternedSource(void) const
 {
     return _source;
 }
 
+const std::string &SentenceSet::getSource(void) const
+{
+    return _source.str();
+}
+
 const std::string &SentenceSet::getSourceLongString(void) const
 {
-    return _source;
+    return _source.str();
 }
 
 const std::string &SentenceSet::getSourceShortString(void) const
 {
-    return _sourceShortString;
+    return _sourceShortString.str();
 }
 
 std::span<const Sentence::TargetSentence> SentenceSet::getSentenceSnippet(
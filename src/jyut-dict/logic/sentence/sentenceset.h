@@ -1,6 +1,8 @@
 #ifndef SENTENCESET_H
 #define SENTENCESET_H
 
+#include "logic/utils/internedstring.h"
+
 #include <ostream>
 #include <span>
 #include <string>
@@ -17,14 +19,15 @@ namespace Sentence {
 struct TargetSentence
 {
     std::string sentence;
-    std::string language;
+    InternedString language;
     bool directTarget;
 
-    TargetSentence(const std::string &sentence,
-                   const std::string &language, bool directTarget):
-        sentence{sentence},
-        language{language},
-        directTarget(directTarget)
+    TargetSentence(std::string sentence,
+                   InternedString language,
+                   bool directTarget)
+        : sentence{std::move(sentence)}
+        , language{language}
+        , directTarget(directTarget)
     {}
 
     bool operator==(const TargetSentence &other) const
@@ -39,9 +42,9 @@ struct TargetSentence
 class SentenceSet
 {
 public:
-    SentenceSet(const std::string &source);
-    SentenceSet(const std::string &source,
-                const std::vector<Sentence::TargetSentence> &sentences);
+    SentenceSet(InternedString source);
+    SentenceSet(InternedString source,
+                std::vector<Sentence::TargetSentence> sentences);
     friend std::ostream &operator<<(std::ostream &out,
                                     const SentenceSet &sentence);
     bool operator==(const SentenceSet &other) const
@@ -51,8 +54,9 @@ public:
 
     bool isEmpty(void) const;
 
-    bool pushSentence(const Sentence::TargetSentence &sentence);
+    bool pushSentence(Sentence::TargetSentence sentence);
 
+    InternedString getInternedSource(void) const;
     const std::string &getSource(void) const;
     const std::string &getSourceLongString(void) const;
     const std::string &getSourceShortString(void) const;
@@ -60,8 +64,8 @@ public:
     std::span<const Sentence::TargetSentence> getSentences(void) const;
 
 private:
-    std::string _source;
-    std::string _sourceShortString;
+    InternedString _source;
+    InternedString _sourceShortString;
     mutable std::vector<Sentence::TargetSentence> _snippet;
     std::vector<Sentence::TargetSentence> _sentences;
 };
@@ -7,18 +7,18 @@ SourceSentence::SourceSentence()
 {
 }
 
-SourceSentence::SourceSentence(const std::string &sourceLanguage,
-                               const std::string &simplified,
-                               const std::string &traditional,
-                               const std::string &jyutping,
-                               const std::string &pinyin,
-                               const std::vector<SentenceSet> &sentences)
-    : _sourceLanguage{sourceLanguage}
-    , _simplified{simplified}
-    , _traditional{traditional}
-    , _jyutping{jyutping}
-    , _pinyin{pinyin}
-    , _sentences{sentences}
+SourceSentence::SourceSentence(std::string sourceLanguage,
+                               std::string simplified,
+                               std::string traditional,
+                               std::string jyutping,
+                               std::string pinyin,
+                               std::vector<SentenceSet> sentences)
+    : _sourceLanguage{std::move(sourceLanguage)}
+    , _simplified{std::move(simplified)}
+    , _traditional{std::move(traditional)}
+    , _jyutping{std::move(jyutping)}
+    , _pinyin{std::move(pinyin)}
+    , _sentences{std::move(sentences)}
 {
 }
 
@@ -259,7 +259,7 @@ std::string SourceSentence::getSentenceSnippetLanguage(void) const
         return "";
     }
 
-    return snippets.at(0).language;
+    return snippets.at(0).language.str();
 }
 
 void SourceSentence::setIsWelcome(const bool isWelcome)
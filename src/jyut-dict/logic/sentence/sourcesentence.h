@@ -15,12 +15,12 @@ class SourceSentence
 {
 public:
     SourceSentence();
-    SourceSentence(const std::string &sourceLanguage,
-                   const std::string &simplified,
-                   const std::string &traditional,
-                   const std::string &jyutping,
-                   const std::string &pinyin,
-                   const std::vector<SentenceSet> &sentences);
+    SourceSentence(std::string sourceLanguage,
+                   std::string simplified,
+                   std::string traditional,
+                   std::string jyutping,
+                   std::string pinyin,
+                   std::vector<SentenceSet> sentences);
 
     friend std::ostream &operator<<(std::ostream &out,
                                     const SourceSentence &sourceSentence);
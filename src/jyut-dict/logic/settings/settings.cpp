@@ -20,6 +20,8 @@ namespace Settings {
         DEFAULT_PINYIN_TONE_5,
     };
 
+    uint32_t toneColoursVersion = 0;
+
     const std::vector<std::string> defaultJyutpingToneColours = {
         DEFAULT_JYUTPING_TONE_0,
         DEFAULT_JYUTPING_TONE_1,
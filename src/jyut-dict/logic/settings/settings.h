@@ -14,6 +14,10 @@ namespace Settings {
 extern std::vector<std::string> jyutpingToneColours;
 extern std::vector<std::string> pinyinToneColours;
 
+// Increment this whenever either set of tone colours changes, so that
+// entries know to regenerate their coloured strings
+extern uint32_t toneColoursVersion;
+
 const extern std::vector<std::string> defaultJyutpingToneColours;
 const extern std::vector<std::string> defaultPinyinToneColours;
 
@@ -1,7 +1,11 @@
 #include "cantoneseutils.h"
 
+#include "logic/utils/chineseutils.h"
+#include "logic/utils/syllabletable.h"
 #include "logic/utils/utils.h"
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <regex>
 #include <sstream>
@@ -16,11 +20,11 @@ std::unordered_set<std::string> specialCharacters
 
 std::unordered_set<std::string> regexCharacters = {"!", "(", ")", "|"};
 
-std::unordered_set<std::string> initials = {"b",  "p", "m",  "f",  "d",
-                                            "t",  "n", "l",  "g",  "k",
-                                            "ng", "h", "gw", "kw", "w",
-                                            "z",  "c", "s",  "j",  "m"};
-std::unordered_set<std::string> finals
+std::unordered_set<std::string_view> initials = {"b",  "p", "m",  "f",  "d",
+                                                 "t",  "n", "l",  "g",  "k",
+                                                 "ng", "h", "gw", "kw", "w",
+                                                 "z",  "c", "s",  "j",  "m"};
+std::unordered_set<std::string_view> finals
     = {"a",   "aa",   "aai", "aau", "aam", "aan", "aang", "aap", "aat", "aak",
        "ai",  "au",   "am",  "an",  "ang", "ap",  "at",   "ak",  "e",   "ei",
        "eu",  "em",   "en",  "eng", "ep",  "ek",  "i",    "iu",  "im",  "in",
@@ -167,10 +171,15 @@ bool unfoldJyutpingRegex(const QString &string, std::vector<QString> &out)
 
 std::string convertYaleInitial(const std::string &syllable)
 {
+    // Compiling a regex costs much more than running it, so only do it once
+    static const std::regex j_regex{"jy?"};
+    static const std::regex z_regex{"z"};
+    static const std::regex c_regex{"c"};
+
     std::string yale_syllable{syllable};
-    yale_syllable = std::regex_replace(yale_syllable, std::regex{"jy?"}, "y");
-    yale_syllable = std::regex_replace(yale_syllable, std::regex{"z"}, "j");
-    yale_syllable = std::regex_replace(yale_syllable, std::regex{"c"}, "ch");
+    yale_syllable = std::regex_replace(yale_syllable, j_regex, "y");
+    yale_syllable = std::regex_replace(yale_syllable, z_regex, "j");
+    yale_syllable = std::regex_replace(yale_syllable, c_regex, "ch");
     return yale_syllable;
 }
 
@@ -179,7 +188,8 @@ std::string convertYaleFinal(const std::string &syllable)
     std::string yale_syllable{syllable};
 
     // Attempt to isolate the part of the Jyutping syllable that is the final
-    std::regex final_regex{"([aeiou][aeiou]?[iumngptk]?[g]?)([1-6])"};
+    static const std::regex final_regex{
+        "([aeiou][aeiou]?[iumngptk]?[g]?)([1-6])"};
     std::smatch match;
     auto regex_res = std::regex_search(syllable, match, final_regex);
 
@@ -204,9 +214,8 @@ std::string convertYaleFinal(const std::string &syllable)
     // Insert an "h" before the last consonant cluster for the light tones,
     // as they are indicated in Yale
     if (tone == 4 || tone == 5 || tone == 6) {
-        yale_syllable = std::regex_replace(yale_syllable,
-                                           std::regex{"([ptkmn]?g?)[123456]$"},
-                                           "h$&");
+        static const std::regex coda_regex{"([ptkmn]?g?)[123456]$"};
+        yale_syllable = std::regex_replace(yale_syllable, coda_regex, "h$&");
     }
 
     // Replace the first vowel in the final with its accented version
@@ -227,9 +236,267 @@ std::string convertYaleFinal(const std::string &syllable)
     return yale_syllable;
 }
 
+// The toned syllables that the syllable tables are built from. The syllabic
+// nasals m and ng only form syllables on their own or after h; hm and hng are
+// left out, since there is no Yale conversion for them.
+std::vector<std::string> spellJyutpingSyllables(void)
+{
+    std::unordered_set<std::string_view> nonNasalFinals{finals};
+    nonNasalFinals.erase("m");
+    nonNasalFinals.erase("ng");
+
+    std::initializer_list<std::string_view> tones
+        = {"1", "2", "3", "4", "5", "6"};
+    std::vector<std::string> syllables = spellSyllables(initials,
+                                                        nonNasalFinals,
+                                                        tones);
+    std::vector<std::string> nasals
+        = spellSyllables(std::vector<std::string_view>{},
+                         std::vector<std::string_view>{"m", "ng"},
+                         tones);
+    syllables.insert(syllables.end(), nasals.begin(), nasals.end());
+    return syllables;
+}
+
+// Whether segmentJyutping treats this character as a space
+bool isRemovedCharacter(QChar character,
+                        bool removeSpecialCharacters,
+                        bool removeGlobCharacters,
+                        bool removeRegexCharacters)
+{
+    return (removeSpecialCharacters
+            && ChineseUtils::isRomanisationSpecialCharacter(character))
+           || (removeGlobCharacters && ChineseUtils::isGlobCharacter(character))
+           || (removeRegexCharacters
+               && ChineseUtils::isRegexCharacter(character));
+}
+
+// Where a Rewrite may match, relative to the syllable it is in
+enum class RewriteAnchor {
+    Anywhere,
+    SyllableStart, // At the start of the string, or after a space
+    SyllableEnd,   // Before a space, an apostrophe, or the end of the string
+};
+
+// A Rewrite replaces every non-overlapping occurrence of pattern, scanning
+// left to right, like QString::replace() does.
+struct Rewrite
+{
+    QStringView pattern;
+    QStringView replacement;
+    RewriteAnchor anchor = RewriteAnchor::Anywhere;
+    // Skip occurrences that are followed by one of these characters
+    QStringView notFollowedBy = {};
+};
+
+// A ClusterCase decides how a cluster is rewritten based on the character
+// before it (skipping a closing parenthesis left by an earlier rewrite).
+struct ClusterCase
+{
+    // The case applies if the preceding character is one of these; if this
+    // is empty, the case applies to any preceding character.
+    QStringView initials;
+    // Used if the cluster is followed by an initial, and otherwise
+    QStringView beforeInitial;
+    QStringView otherwise;
+};
+
+bool isRewriteAnchored(QStringView string,
+                       qsizetype idx,
+                       const Rewrite &rewrite)
+{
+    qsizetype after = idx + rewrite.pattern.size();
+    switch (rewrite.anchor) {
+    case RewriteAnchor::SyllableStart: {
+        if (idx != 0 && string.at(idx - 1) != ' ') {
+            return false;
+        }
+        break;
+    }
+    case RewriteAnchor::SyllableEnd: {
+        if (after != string.size() && string.at(after) != ' '
+            && string.at(after) != '\'') {
+            return false;
+        }
+        break;
+    }
+    case RewriteAnchor::Anywhere: {
+        break;
+    }
+    }
+
+    return after == string.size()
+           || !rewrite.notFollowedBy.contains(string.at(after));
+}
+
+// Applies rewrite to string in a single pass, using scratch as the output
+// buffer. The two are swapped afterwards, so that their capacity is reused
+// by every rewrite that follows.
+void applyRewrite(QString &string, QString &scratch, const Rewrite &rewrite)
+{
+    qsizetype idx = QStringView{string}.indexOf(rewrite.pattern);
+    if (idx == -1) {
+        return;
+    }
+
+    scratch.resize(0);
+    qsizetype copiedUntil = 0;
+    while (idx != -1) {
+        if (!isRewriteAnchored(string, idx, rewrite)) {
+            idx = QStringView{string}.indexOf(rewrite.pattern, idx + 1);
+            continue;
+        }
+        scratch.append(QStringView{string}.sliced(copiedUntil,
+                                                  idx - copiedUntil));
+        scratch.append(rewrite.replacement);
+        copiedUntil = idx + rewrite.pattern.size();
+        idx = QStringView{string}.indexOf(rewrite.pattern, copiedUntil);
+    }
+
+    if (!copiedUntil) {
+        return;
+    }
+    scratch.append(QStringView{string}.sliced(copiedUntil));
+    string.swap(scratch);
+}
+
+// Whether a Jyutping initial (or "y") starts at idx. Unlike segmentation,
+// this is case-sensitive.
+bool isInitialAt(QStringView string, qsizetype idx)
+{
+    for (qsizetype initial_len = 2; initial_len > 0; initial_len--) {
+        QStringView view = ChineseUtils::midView(string, idx, initial_len);
+        std::array<char, 2> buffer;
+        bool isAscii = true;
+        for (qsizetype i = 0; i < view.size(); ++i) {
+            isAscii = isAscii && view.at(i).unicode() <= 0x7F;
+            buffer[static_cast<size_t>(i)] = static_cast<char>(
+                view.at(i).unicode());
+        }
+        std::string_view candidate{buffer.data(),
+                                   static_cast<size_t>(view.size())};
+        if (isAscii && !candidate.empty()
+            && (initials.contains(candidate) || candidate == "y")) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Rewrites each occurrence of cluster depending on the initial before it;
+// the first case in cases that matches the initial is used. Clusters at the
+// start of the string become atStart, and clusters with no matching case
+// are left as they are.
+void applyClusterRewrite(QString &string,
+                         QString &scratch,
+                         QStringView cluster,
+                         QStringView atStart,
+                         std::initializer_list<ClusterCase> cases)
+{
+    qsizetype idx = QStringView{string}.indexOf(cluster);
+    if (idx == -1) {
+        return;
+    }
+
+    scratch.resize(0);
+    qsizetype copiedUntil = 0;
+    while (idx != -1) {
+        // Everything before the cluster has been rewritten already, so look
+        // back at the output rather than at the original string
+        scratch.append(QStringView{string}.sliced(copiedUntil,
+                                                  idx - copiedUntil));
+        copiedUntil = idx;
+
+        QStringView replacement;
+        if (scratch.isEmpty()) {
+            replacement = atStart;
+        } else {
+            qsizetype initialIdx = scratch.size() - 1;
+            if (scratch.size() >= 2 && scratch.at(initialIdx) == ')') {
+                initialIdx = scratch.size() - 2;
+            }
+            QChar initial = scratch.at(initialIdx);
+
+            auto result = std::find_if(cases.begin(),
+                                       cases.end(),
+                                       [&](const ClusterCase &c) {
+                                           return c.initials.isEmpty()
+                                                  || c.initials.contains(
+                                                      initial);
+                                       });
+            if (result != cases.end()) {
+                replacement = isInitialAt(string, idx + cluster.size())
+                                  ? result->beforeInitial
+                                  : result->otherwise;
+            }
+        }
+
+        if (replacement.isNull()) {
+            idx = QStringView{string}.indexOf(cluster, idx + 1);
+            continue;
+        }
+        scratch.append(replacement);
+        copiedUntil = idx + cluster.size();
+        idx = QStringView{string}.indexOf(cluster, copiedUntil);
+    }
+
+    scratch.append(QStringView{string}.sliced(copiedUntil));
+    string.swap(scratch);
+}
+
+// Changes any "y" that is not followed by a "u" (possibly with a "!" or ")"
+// in between) to "(j)"
+void replaceUnfollowedY(QString &string, QString &scratch)
+{
+    if (!string.contains(u'y')) {
+        return;
+    }
+
+    scratch.resize(0);
+    for (qsizetype idx = 0; idx < string.size(); ++idx) {
+        QStringView rest = QStringView{string}.sliced(idx);
+        if (rest.front() != 'y' || rest.startsWith(u"yu")
+            || rest.startsWith(u"y!u") || rest.startsWith(u"y)u")) {
+            scratch.append(rest.front());
+            continue;
+        }
+        scratch.append(u"(j)");
+    }
+    string.swap(scratch);
+}
+
 } // namespace
 
 namespace CantoneseUtils {
+
+// Converts a single toned Jyutping syllable to Yale
+std::string convertJyutpingSyllableToYale(const std::string &syllable)
+{
+    // Handle special-case syllables
+    std::string syllable_without_tone = syllable.substr(0,
+                                                        syllable.length() - 1);
+    int tone = std::stoi(syllable.substr(syllable.find_first_of("123456"), 1));
+    auto search = jyutpingToYaleSpecialSyllables.find(syllable_without_tone);
+    if (search != jyutpingToYaleSpecialSyllables.end()) {
+        return search->second.at(static_cast<size_t>(tone) - 1);
+    }
+
+    std::string yale_syllable{syllable};
+
+    yale_syllable = convertYaleFinal(yale_syllable);
+    yale_syllable = convertYaleInitial(yale_syllable);
+    return yale_syllable;
+}
+
+// Built on first use rather than at startup, since converting every syllable
+// takes a while and most runs (and tests) never show Yale
+static const SyllableTable<std::string> &jyutpingToYaleTable(void)
+{
+    static const SyllableTable<std::string>
+        table{spellJyutpingSyllables(), convertJyutpingSyllableToYale};
+    return table;
+}
+
 // Note that the majority of this function and the convertToIPA function
 // is derivative of Wiktionary's conversion code, contained in the module
 // "yue-pron" (https://en.wiktionary.org/wiki/Module:yue-pron)
@@ -295,23 +562,9 @@ std::string convertJyutpingToYale(const std::string &jyutping,
             continue;
         }
 
-        // Handle special-case syllables
-        std::string syllable_without_tone
-            = syllable.substr(0, syllable.length() - 1);
-        int tone = std::stoi(
-            syllable.substr(syllable.find_first_of("123456"), 1));
-        auto search = jyutpingToYaleSpecialSyllables.find(syllable_without_tone);
-        if (search != jyutpingToYaleSpecialSyllables.end()) {
-            yale_syllables.emplace_back(
-                search->second.at(static_cast<size_t>(tone) - 1));
-            continue;
-        }
-
-        std::string yale_syllable{syllable};
-
-        yale_syllable = convertYaleFinal(yale_syllable);
-        yale_syllable = convertYaleInitial(yale_syllable);
-        yale_syllables.emplace_back(yale_syllable);
+        yale_syllables.emplace_back(
+            jyutpingToYaleTable().lookup(syllable,
+                                         convertJyutpingSyllableToYale));
     }
 
     std::ostringstream yale;
@@ -333,8 +586,9 @@ std::string convertIPACantoneseSyllable(const std::string &syllable)
     std::string coda;
     std::string tone;
 
-    std::regex syllable_regex{"([bcdfghjklmnpqrstvwxyz]?[bcdfghjklmnpqrstvwxyz]"
-                              "?)([a@e>i|o~u^y][eo]?)([iuymngptk]?g?)([1-9])"};
+    static const std::regex syllable_regex{
+        "([bcdfghjklmnpqrstvwxyz]?[bcdfghjklmnpqrstvwxyz]"
+        "?)([a@e>i|o~u^y][eo]?)([iuymngptk]?g?)([1-9])"};
     std::smatch match;
 
     auto regex_res = std::regex_match(syllable, match, syllable_regex);
@@ -387,6 +641,74 @@ std::string convertIPACantoneseSyllable(const std::string &syllable)
     return ipa_syllable;
 }
 
+// Converts a single toned Jyutping syllable to IPA
+std::string convertJyutpingSyllableToIPA(const std::string &syllable)
+{
+    // Compiling a regex costs much more than running it, so only do it once
+    static const std::regex zcs_yu_regex{"([zcs])yu"};
+    static const std::regex zc_oe_regex{"([zc])oe"};
+    static const std::regex zc_eo_regex{"([zc])eo"};
+    static const std::regex syllabic_nasal_regex{"^(h?)([mn]g?)([1-6])$"};
+    static const std::regex m_regex{"m"};
+    static const std::regex ng_regex{"ng"};
+    static const std::regex tone_regex{"[1-6]"};
+    static const std::regex checked_tone_regex{"([ptk])([136])"};
+    static const std::vector<std::pair<std::regex, std::string>>
+        special_syllables = [] {
+            std::vector<std::pair<std::regex, std::string>> regexes;
+            for (const auto &pair : cantoneseIPASpecialSyllables) {
+                regexes.emplace_back(std::regex{pair.first}, pair.second);
+            }
+            return regexes;
+        }();
+
+    // Do some pre-processing
+    std::string ipa_syllable{syllable};
+    ipa_syllable = std::regex_replace(ipa_syllable, zcs_yu_regex, "$1hyu");
+    ipa_syllable = std::regex_replace(ipa_syllable, zc_oe_regex, "$1hoe");
+    ipa_syllable = std::regex_replace(ipa_syllable, zc_eo_regex, "$1heo");
+
+    // Convert special syllables
+    std::smatch match;
+    if (std::regex_match(ipa_syllable, match, syllabic_nasal_regex)) {
+        int tone = std::stoi(match[3]);
+        ipa_syllable = std::regex_replace(ipa_syllable, m_regex, "m̩");
+        ipa_syllable = std::regex_replace(ipa_syllable, ng_regex, "ŋ̍");
+        ipa_syllable = std::regex_replace(
+            ipa_syllable,
+            tone_regex,
+#if defined(Q_OS_MAC)
+            // Only macOS needs this space to fix weird kerning
+            " " +
+#endif
+                jyutpingToIPATones.at(static_cast<size_t>(tone - 1)));
+    }
+
+    // Replace checked tones
+    if (std::regex_search(ipa_syllable, match, checked_tone_regex)) {
+        std::replace(ipa_syllable.begin(), ipa_syllable.end(), '1', '7');
+        std::replace(ipa_syllable.begin(), ipa_syllable.end(), '3', '8');
+        std::replace(ipa_syllable.begin(), ipa_syllable.end(), '6', '9');
+    }
+
+    // Do some more preprocessing
+    for (const auto &pair : special_syllables) {
+        ipa_syllable = std::regex_replace(ipa_syllable,
+                                          pair.first,
+                                          pair.second);
+    }
+
+    return convertIPACantoneseSyllable(ipa_syllable);
+}
+
+// Built on first use, like jyutpingToYaleTable()
+static const SyllableTable<std::string> &jyutpingToIPATable(void)
+{
+    static const SyllableTable<std::string>
+        table{spellJyutpingSyllables(), convertJyutpingSyllableToIPA};
+    return table;
+}
+
 std::string convertJyutpingToIPA(const std::string &jyutping,
                                  bool useSpacesToSegment)
 {
@@ -448,57 +770,9 @@ std::string convertJyutpingToIPA(const std::string &jyutping,
             continue;
         }
 
-        // Do some pre-processing
-        std::string ipa_syllable{syllable};
-        ipa_syllable = std::regex_replace(ipa_syllable,
-                                          std::regex{"([zcs])yu"},
-                                          "$1hyu");
-        ipa_syllable = std::regex_replace(ipa_syllable,
-                                          std::regex{"([zc])oe"},
-                                          "$1hoe");
-        ipa_syllable = std::regex_replace(ipa_syllable,
-                                          std::regex{"([zc])eo"},
-                                          "$1heo");
-
-        // Convert special syllables
-        std::smatch match;
-        if (std::regex_match(ipa_syllable,
-                             match,
-                             std::regex{"^(h?)([mn]g?)([1-6])$"})) {
-            int tone = std::stoi(match[3]);
-            ipa_syllable = std::regex_replace(ipa_syllable,
-                                              std::regex{"m"},
-                                              "m̩");
-            ipa_syllable = std::regex_replace(ipa_syllable,
-                                              std::regex{"ng"},
-                                              "ŋ̍");
-            ipa_syllable = std::regex_replace(
-                ipa_syllable,
-                std::regex{"[1-6]"},
-#if defined(Q_OS_MAC)
-                // Only macOS needs this space to fix weird kerning
-                " " +
-#endif
-                    jyutpingToIPATones.at(static_cast<size_t>(tone - 1)));
-        }
-
-        // Replace checked tones
-        if (std::regex_search(ipa_syllable,
-                              match,
-                              std::regex{"([ptk])([136])"})) {
-            std::replace(ipa_syllable.begin(), ipa_syllable.end(), '1', '7');
-            std::replace(ipa_syllable.begin(), ipa_syllable.end(), '3', '8');
-            std::replace(ipa_syllable.begin(), ipa_syllable.end(), '6', '9');
-        }
-
-        // Do some more preprocessing
-        for (const auto &pair : cantoneseIPASpecialSyllables) {
-            ipa_syllable = std::regex_replace(ipa_syllable,
-                                              std::regex{pair.first},
-                                              pair.second);
-        }
-
-        ipa_syllables.emplace_back(convertIPACantoneseSyllable(ipa_syllable));
+        ipa_syllables.emplace_back(
+            jyutpingToIPATable().lookup(syllable,
+                                        convertJyutpingSyllableToIPA));
     }
 
     std::ostringstream ipa;
@@ -518,80 +792,76 @@ bool jyutpingAutocorrect(const QString &in,
                          QString &out,
                          bool unsafeSubstitutions)
 {
-    out = in;
+    // Every rewrite below is a single pass from corrected into scratch, after
+    // which the two are swapped; reserve enough for most inputs up front so
+    // that neither has to grow.
+    QString corrected;
+    corrected.reserve(in.size() * 2 + 16);
+    corrected.append(in);
+    QString scratch;
+    scratch.reserve(corrected.capacity());
+
+    auto apply = [&](const Rewrite &rewrite) {
+        applyRewrite(corrected, scratch, rewrite);
+    };
 
     // This is for some romanizations like "shui" for 水
     // And needs to happen before the "sh" -> "s" conversion
-    out.replace("hui", "heoi");
+    apply({u"hui", u"heoi"});
 
     // The initial + nucleus "cu-" never appears in Jyutping, so the user
     // probably intended to make the IPA [kʰɐ] sound
     // Surround the k with capturing group to prevent replacement with (g|k)
     // if sound changes are enabled
-    out.replace("cu", "(k)u");
+    apply({u"cu", u"(k)u"});
 
     // "x" never appears in Jyutping, the user might be more familiar
     // with Pinyin and assume that it's an "s" sound
-    out.replace("x", "s");
+    apply({u"x", u"s"});
 
-    out.replace("ch", "c").replace("sh", "s").replace("zh", "z");
+    apply({u"ch", u"c"});
+    apply({u"sh", u"s"});
+    apply({u"zh", u"z"});
 
     // Change "eung", "erng", "eong" -> "oeng"
-    out.replace("eung", "oeng").replace("erng", "oeng");
+    apply({u"eung", u"oeng"});
+    apply({u"erng", u"oeng"});
 
-    out.replace("eui", "eoi");
-    out.replace("euk", "oek");
-    out.replace("eun", "(eo|yu)n");
-    out.replace("eut", "(eo|yu)t");
-    out.replace("eu", "(e|y)u");
-    out.replace("ern", "eon");
+    apply({u"eui", u"eoi"});
+    apply({u"euk", u"oek"});
+    apply({u"eun", u"(eo|yu)n"});
+    apply({u"eut", u"(eo|yu)t"});
+    apply({u"eu", u"(e|y)u"});
+    apply({u"ern", u"eon"});
 
     // Change "-oen" -> "-eon"
-    int idx = out.indexOf("oen");
-    while (idx != -1) {
-        if (QStringView{out.constBegin() + idx, 4} == QString{"oeng"}) {
-            idx = out.indexOf("oen", idx + 1);
-            continue;
-        }
-        out.replace(idx, 3, "eon");
-        idx = out.indexOf("oen", idx + 1);
-    }
-    out.replace("oei", "eoi");
-    out.replace("oet", "eot");
-
-    out.replace("eong ", "oeng ");
-    out.replace("eong'", "oeng'");
-    if (out.endsWith("eong")) {
-        idx = out.lastIndexOf(("eong"));
-        out.replace(idx, 4, "oeng");
-    }
+    apply({u"oen", u"eon", RewriteAnchor::Anywhere, u"g"});
+    apply({u"oei", u"eoi"});
+    apply({u"oet", u"eot"});
+
+    apply({u"eong", u"oeng", RewriteAnchor::SyllableEnd});
     if (unsafeSubstitutions) {
-        out.replace("eong", "oeng"); // unsafe because of zeon6 gun2
+        apply({u"eong", u"oeng"}); // unsafe because of zeon6 gun2
     }
-    out.replace("eok", "oek");
+    apply({u"eok", u"oek"});
 
-    out.replace("ao ", "au ");
-    out.replace("ao'", "au'");
-    if (out.endsWith("ao")) {
-        idx = out.lastIndexOf(("ao"));
-        out.replace(idx, 2, "au");
-    }
+    apply({u"ao", u"au", RewriteAnchor::SyllableEnd});
     if (unsafeSubstitutions) {
-        out.replace("ao", "au"); // unsafe because of maa5 on1
+        apply({u"ao", u"au"}); // unsafe because of maa5 on1
     }
 
-    out.replace("ar", "aa");      // like in "char siu"
-    out.replace("ee", "i");       // like in "lai see"
-    out.replace("ay", "ei");      // like in "gong hay fat choy"
-    out.replace("oy", "oi");      // like in "choy sum"
-    out.replace("oo", "(y!u)");   // like in "soot goh"
-    out.replace("ong", "(o|u)ng");
-    out.replace("young", "jung"); // like in "foo young"
+    apply({u"ar", u"aa"});      // like in "char siu"
+    apply({u"ee", u"i"});       // like in "lai see"
+    apply({u"ay", u"ei"});      // like in "gong hay fat choy"
+    apply({u"oy", u"oi"});      // like in "choy sum"
+    apply({u"oo", u"(y!u)"});   // like in "soot goh"
+    apply({u"ong", u"(o|u)ng"});
+    apply({u"young", u"jung"}); // like in "foo young"
 
-    out.replace("yue", "(j)yu"); // like "yuet yue" (粵語)
-    out.replace("ue", "(yu)"); // like "tsuen wan" (轉彎)
-    out.replace("tsz", "zi");  // like "tsat tsz mui" (七姊妹)
-    out.replace("ck", "k");    // like "back" (白)
+    apply({u"yue", u"(j)yu"}); // like "yuet yue" (粵語)
+    apply({u"ue", u"(yu)"});   // like "tsuen wan" (轉彎)
+    apply({u"tsz", u"zi"});    // like "tsat tsz mui" (七姊妹)
+    apply({u"ck", u"k"});      // like "back" (白)
 
     // The following changes may be unsafe because it is ambiguous whether
     // they are final + initial or a "misspelling" of a final
@@ -599,466 +869,121 @@ bool jyutpingAutocorrect(const QString &in,
     // syllable, or it is the end of the string
 
     // Check if the user intends to write an [-ɔː h-] or [-ou̯] cluster
-    {
-        out.replace("oh ", "ou ").replace("oh'", "ou'");
-        if (out.endsWith("oh")) {
-            out.replace(out.length() - 2, 2, "ou");
-        }
-
-        // Initials for which <initial> + "-ou" exist in Jyutping
-        std::unordered_set<QChar> closeBackVowelCluster = {'n', 'j'};
-        // Initials for which both "-ou" and "-o h-" exist in Jyutping
-        std::unordered_set<QChar> ambiguousVowelCluster
-            = {'b', 'p', 'm', 'f', 'd', 't', 'l', 'g', 'h', 'w', 'z', 'c', 's'};
-
-        int replacementIdx = out.indexOf("oh");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 2, "ou");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeBackVowelCluster.find(out.at(initialIdx))
-                    != closeBackVowelCluster.end()) {
-                    out.replace(replacementIdx, 2, "ou");
-                } else if (ambiguousVowelCluster.find(out.at(initialIdx))
-                           != ambiguousVowelCluster.end()) {
-                    // The [h-] cluster can only occur if what follows is not an initial
-                    bool initialFound = false;
-                    for (int initial_len = 2; initial_len > 0; initial_len--) {
-                        QString s{out.constBegin() + replacementIdx + 2,
-                                  initial_len};
-                        if (initials.find(s.toStdString()) != initials.end()
-                            || s.toStdString() == "y") {
-                            initialFound = true;
-                        }
-                    }
-                    if (initialFound) {
-                        out.replace(replacementIdx, 2, "ou");
-                    } else {
-                        out.replace(replacementIdx, 2, "o h");
-                    }
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("oh", replacementIdx + 1);
-        }
-    }
+    // <initial> + "-ou" exists in Jyutping for n and j; both "-ou" and
+    // "-o h-" exist for the rest.
+    apply({u"oh", u"ou", RewriteAnchor::SyllableEnd});
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"oh",
+                        u"ou",
+                        {{u"nj", u"ou", u"ou"},
+                         {u"bpmfdtlghwzcs", u"ou", u"o h"}});
 
     // Check if the user intends to write an [-ɔː w-] or [-auː] cluster
-    {
-        out.replace("ow ", "au ").replace("ow'", "au'");
-        if (out.endsWith("ow")) {
-            out.replace(out.length() - 2, 2, "au");
-        }
-
-        // Initials for which <initial> + "-(a)au" exist in Jyutping
-        std::unordered_set<QChar> closeBackVowelCluster = {'b', 'm', 'k', 's'};
-        // Initials for which both exist in Jyutping
-        std::unordered_set<QChar> ambiguousVowelCluster
-            = {'p', 'm', 'f', 'd', 't', 'n', 'l', 'g', 'h', 'z', 'c', 's'};
-        int replacementIdx = out.indexOf("ow");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 2, "au");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeBackVowelCluster.find(out.at(initialIdx))
-                    != closeBackVowelCluster.end()) {
-                    out.replace(replacementIdx, 2, "au");
-                } else if (ambiguousVowelCluster.find(out.at(initialIdx))
-                           != ambiguousVowelCluster.end()) {
-                    // The [w-] cluster can only occur if what follows is not an initial
-                    bool initialFound = false;
-                    for (int initial_len = 2; initial_len > 0; initial_len--) {
-                        QString s{out.constBegin() + replacementIdx + 2,
-                                  initial_len};
-                        if (initials.find(s.toStdString()) != initials.end()
-                            || s.toStdString() == "y") {
-                            initialFound = true;
-                        }
-                    }
-                    if (initialFound) {
-                        out.replace(replacementIdx, 2, "au");
-                    } else {
-                        out.replace(replacementIdx, 2, "o w");
-                    }
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("ow", replacementIdx + 1);
-        }
-    }
+    // <initial> + "-(a)au" exists in Jyutping for b, m, k and s; both exist
+    // for the rest.
+    apply({u"ow", u"au", RewriteAnchor::SyllableEnd});
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"ow",
+                        u"au",
+                        {{u"bmks", u"au", u"au"},
+                         {u"pmfdtnlghzcs", u"au", u"o w"}});
 
     // Check if the user intends to write an [ɐm] or [-uː  m-] cluster
-    {
-        out.replace("um ", "am ").replace("um'", "am'");
-        if (out.endsWith("um")) {
-            out.replace(out.length() - 2, 2, "am");
-        }
-
-        // Initials for which <initial> + "am" exist in Jyutping
-        std::unordered_set<QChar> openMidCentralVowelCluster
-            = {'b', 'p', 'm', 'd', 't', 'n', 'l', 'k', 'h', 'z', 'c', 's', 'j'};
-        // Initials for which <initial> + "-u m-" exist in Jyutping
-        std::unordered_set<QChar> closeBackVowelCluster
-            = {'f', 'w', 'a', 'e', 'i', 'o'};
-
-        int replacementIdx = out.indexOf("um");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 2, "am");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (openMidCentralVowelCluster.find(out.at(initialIdx))
-                    != openMidCentralVowelCluster.end()) {
-                    out.replace(replacementIdx, 2, "am");
-                } else if (closeBackVowelCluster.find(out.at(initialIdx))
-                           != closeBackVowelCluster.end()) {
-                    (void) 0; // Do nothing
-                } else if (out.at(initialIdx) == "g") {
-                    // The [m-] cluster can only occur if what follows is not an initial
-                    bool initialFound = false;
-                    for (int initial_len = 2; initial_len > 0; initial_len--) {
-                        QString s{out.constBegin() + replacementIdx + 2,
-                                  initial_len};
-                        if (initials.find(s.toStdString()) != initials.end()
-                            || s.toStdString() == "y") {
-                            initialFound = true;
-                        }
-                    }
-                    if (initialFound) {
-                        out.replace(replacementIdx, 2, "am");
-                    } else {
-                        out.replace(replacementIdx, 2, "u m");
-                    }
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("um", replacementIdx + 1);
-        }
-    }
+    // <initial> + "am" exists in Jyutping for the first set, and
+    // <initial> + "-u m-" for the second.
+    apply({u"um", u"am", RewriteAnchor::SyllableEnd});
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"um",
+                        u"am",
+                        {{u"bpmdtnlkhzcsj", u"am", u"am"},
+                         {u"fwaeio", u"um", u"um"},
+                         {u"g", u"am", u"u m"}});
 
     // Check if the user intends to write an [-ɛː j-] or [-ei̯] cluster
-    {
-        out.replace("ey ", "ei ").replace("ey'", "ei'");
-        if (out.endsWith("ey")) {
-            out.replace(out.length() - 2, 2, "ei");
-        }
-
-        // Initials for which <initial> + "-ei" exist in Jyutping
-        std::unordered_set<QChar> closeFrontVowelCluster
-            = {'p', 'f', 'd', 'n', 'l', 'h', 'w'};
-        // Initials for which <initial> + "-e j-" exist in Jyutping
-        std::unordered_set<QChar> openMidFrontVowelCluster = {'c', 'j', 'y'};
-        // Initials for which both exist in Jyutping
-        std::unordered_set<QChar> ambiguousVowelCluster
-            = {'b', 'm', 'g', 'k', 'z', 's'};
-
-        int replacementIdx = out.indexOf("ey");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 2, "ei");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeFrontVowelCluster.find(out.at(initialIdx))
-                    != closeFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 2, "ei");
-                } else if (openMidFrontVowelCluster.find(out.at(initialIdx))
-                           != openMidFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 2, "e (j)");
-                } else if (ambiguousVowelCluster.find(out.at(initialIdx))
-                           != ambiguousVowelCluster.end()) {
-                    // The [j-] cluster can only occur if what follows is not an initial
-                    bool initialFound = false;
-                    for (int initial_len = 2; initial_len > 0; initial_len--) {
-                        QString s{out.constBegin() + replacementIdx + 2,
-                                  initial_len};
-                        if (initials.find(s.toStdString()) != initials.end()
-                            || s.toStdString() == "y") {
-                            initialFound = true;
-                        }
-                    }
-                    if (initialFound) {
-                        out.replace(replacementIdx, 2, "ei");
-                    } else {
-                        out.replace(replacementIdx, 2, "e (j)");
-                    }
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("ey", replacementIdx + 1);
-        }
-    }
+    // <initial> + "-ei" exists in Jyutping for the first set, <initial> +
+    // "-e j-" for the second, and both for the third.
+    apply({u"ey", u"ei", RewriteAnchor::SyllableEnd});
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"ey",
+                        u"ei",
+                        {{u"pfdnlhw", u"ei", u"ei"},
+                         {u"cjy", u"e (j)", u"e (j)"},
+                         {u"bmgkzs", u"ei", u"e (j)"}});
 
     // Check if the user intends to write an [-yː j-] or [-ɐm] cluster
-    {
-        // Initials for which <initial> + "-yu m-" exist in Jyutping
-        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 'c', 's', 'j'};
-        int replacementIdx = out.indexOf("yum");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 3, "(j)am");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeFrontVowelCluster.find(out.at(initialIdx))
-                    != closeFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 3, "yu m");
-                } else {
-                    out.replace(replacementIdx, 3, "(j)am");
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("yum", replacementIdx + 1);
-        }
-    }
+    // <initial> + "-yu m-" exists in Jyutping for z, c, s and j.
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"yum",
+                        u"(j)am",
+                        {{u"zcsj", u"yu m", u"yu m"},
+                         {{}, u"(j)am", u"(j)am"}});
 
     // Check if the user intends to write an [-yː p-] or [-ɐp] cluster
-    {
-        // Initials for which <initial> + "-yu p-" exist in Jyutping
-        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'j'};
-
-        int replacementIdx = out.indexOf("yup");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 3, "(j)ap");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeFrontVowelCluster.find(out.at(initialIdx))
-                    != closeFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 3, "yu p");
-                } else {
-                    out.replace(replacementIdx, 3, "(j)ap");
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("yup", replacementIdx + 1);
-        }
-    }
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"yup",
+                        u"(j)ap",
+                        {{u"zsj", u"yu p", u"yu p"},
+                         {{}, u"(j)ap", u"(j)ap"}});
 
     // Check if the user intends to write an [-yː k-] or [jʊk] cluster
-    {
-        // Initials for which <initial> + "-yu k-" exist in Jyutping
-        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
-
-        int replacementIdx = out.indexOf("yuk");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 3, "(j)uk");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeFrontVowelCluster.find(out.at(initialIdx))
-                    != closeFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 3, "yu k");
-                } else {
-                    out.replace(replacementIdx, 3, "(j)uk");
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("yuk", replacementIdx + 1);
-        }
-    }
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"yuk",
+                        u"(j)uk",
+                        {{u"zscj", u"yu k", u"yu k"},
+                         {{}, u"(j)uk", u"(j)uk"}});
 
     // Check if the user intends to write an [-yn g-] or [jʊŋ] cluster
-    {
-        // Initials for which <initial> + "-yun g-" exist in Jyutping
-        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
-
-        int replacementIdx = out.indexOf("yung");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 4, "(j)ung");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeFrontVowelCluster.find(out.at(initialIdx))
-                    != closeFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 4, "(yu)n g");
-                } else {
-                    out.replace(replacementIdx, 4, "(j)ung");
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("yung", replacementIdx + 1);
-        }
-    }
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"yung",
+                        u"(j)ung",
+                        {{u"zscj", u"(yu)n g", u"(yu)n g"},
+                         {{}, u"(j)ung", u"(j)ung"}});
 
     // Check if the user intends to write an [-yn] or [jɐn], [jyn], [yn] cluster
-    {
-        // Initials for which <initial> + "-yu n-" exist in Jyutping
-        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
-
-        int replacementIdx = out.indexOf("yun");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 3, "(j)(a|yu)n");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeFrontVowelCluster.find(out.at(initialIdx))
-                    != closeFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 3, "yun");
-                } else {
-                    out.replace(replacementIdx, 3, "(ja|jyu|yu)n");
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("yun", replacementIdx + 1);
-        }
-    }
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"yun",
+                        u"(j)(a|yu)n",
+                        {{u"zscj", u"yun", u"yun"},
+                         {{}, u"(ja|jyu|yu)n", u"(ja|jyu|yu)n"}});
 
     // Check if the user intends to write an [-yt] or [jɐt], [jyt], [yt] cluster
-    {
-        // Initials for which <initial> + "-yu t-" exist in Jyutping
-        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
-
-        int replacementIdx = out.indexOf("yut");
-        while (replacementIdx != -1) {
-            switch (replacementIdx) {
-            case 0: {
-                out.replace(replacementIdx, 3, "(j)(a|yu)t");
-                break;
-            }
-            default: {
-                int initialIdx = replacementIdx - 1;
-                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
-                    initialIdx = replacementIdx - 2;
-                }
-
-                if (closeFrontVowelCluster.find(out.at(initialIdx))
-                    != closeFrontVowelCluster.end()) {
-                    out.replace(replacementIdx, 3, "(yu)t");
-                } else {
-                    out.replace(replacementIdx, 3, "(ja|jyu|yu)t");
-                }
-                break;
-            }
-            }
-            replacementIdx = out.indexOf("yut", replacementIdx + 1);
-        }
-    }
+    applyClusterRewrite(corrected,
+                        scratch,
+                        u"yut",
+                        u"(j)(a|yu)t",
+                        {{u"zscj", u"(yu)t", u"(yu)t"},
+                         {{}, u"(ja|jyu|yu)t", u"(ja|jyu|yu)t"}});
 
     // Unsafe because it is ambiguous whether these are final + initial
     // or a "misspelling" of an initial
     // But unambiguous if they are at the start of a syllable
-    if (out.startsWith("ts")) {
-        out.replace(0, 2, "c");
-    }
-    out.replace(" ts", " c");
-    if (out.startsWith("kwu")) {
-        out.replace(0, 3, "(g|k)w!u");
-    }
-    out.replace(" kwu", " (g|k)w!u");
+    apply({u"ts", u"c", RewriteAnchor::SyllableStart});
+    apply({u"kwu", u"(g|k)w!u", RewriteAnchor::SyllableStart});
     if (unsafeSubstitutions) {
-        out.replace("ts", "c");         // unsafe because of kat1 sau3
-        out.replace("kwu", "(g|k)w!u"); // unsafe because of baak6 wun2
+        apply({u"ts", u"c"});         // unsafe because of kat1 sau3
+        apply({u"kwu", u"(g|k)w!u"}); // unsafe because of baak6 wun2
     }
 
     // Change any "y" that is not followed by a "u" to "j"
     // This needs to happen before the final replacements
-    idx = out.indexOf("y");
-    while (idx != -1) {
-        if (QStringView{out.constBegin() + idx, 2} == QString{"yu"}
-            || QStringView{out.constBegin() + idx, 3} == QString{"y!u"}
-            || QStringView{out.constBegin() + idx, 3} == QString{"y)u"}) {
-            idx = out.indexOf("y", idx + 1);
-            continue;
-        }
-        out.replace(idx, 1, "(j)");
-        idx = out.indexOf("y", idx + 1);
-    }
+    replaceUnfollowedY(corrected, scratch);
 
-    out.replace("ui", "(eo|u)i");
-    out.replace("un", "(y!u|a|eo)n");
-    out.replace("ut", "(a|y!u)t");
+    apply({u"ui", u"(eo|u)i"});
+    apply({u"un", u"(y!u|a|eo)n"});
+    apply({u"ut", u"(a|y!u)t"});
 
-    out.replace("o ", "(ou!) ");
-    out.replace("o'", "(ou!)'");
-    if (out.endsWith("o")) {
-        out.replace(out.size() - 1, 1, "(ou!)");
-    }
-    idx = out.indexOf("o");
-    while (idx != -1) {
-        if (out.at(idx + 1) != 'k' && out.at(idx + 1) != 't'
-            && out.at(idx + 1) != 'e' && out.at(idx + 1) != 'i'
-            && out.at(idx + 1) != 'u' && out.at(idx + 1) != 'n'
-            && out.at(idx + 1) != ')' && out.at(idx + 1) != '|') {
-            out.replace(idx, 1, "(ou!)");
-            idx = out.indexOf("o", idx + 1);
-            continue;
-        }
-        idx = out.indexOf("o", idx + 1);
-    }
+    apply({u"o", u"(ou!)", RewriteAnchor::Anywhere, u"kteiun)|"});
 
+    out.swap(corrected);
     return 0;
 }
 
@@ -1193,68 +1118,78 @@ bool jyutpingSoundChanges(std::vector<std::string> &inOut)
     return 0;
 }
 
-bool segmentJyutping(const QString &string,
-                     std::vector<std::string> &out,
+bool segmentJyutping(QStringView string,
+                     std::vector<SyllableSpan> &out,
                      bool removeSpecialCharacters,
                      bool removeGlobCharacters,
                      bool removeRegexCharacters)
 {
-    std::vector<std::string> syllables;
+    out.clear();
 
     bool valid_jyutping = true;
     // Keep track of indices for current segmented word; [start_index, end_index)
     // Greedily try to expand end_index by checking for valid sequences
     // of characters
-    int start_idx = 0;
-    int end_idx = 0;
+    qsizetype start_idx = 0;
+    qsizetype end_idx = 0;
     bool initial_found = false;
 
     // Invariant: There are no graphemes in the initial Jyutping string larger
     // than a single byte when encoded using UTF-16.
-    QString processedString{string};
-    if (removeSpecialCharacters) {
-        for (const auto &i : specialCharacters) {
-            int charIdx = processedString.indexOf(i.c_str());
-            while (charIdx != -1) {
-                processedString.replace(charIdx, 1, " ");
-                charIdx = processedString.indexOf(i.c_str());
-            }
-        }
-    }
-    if (removeGlobCharacters) {
-        for (const auto &i : std::unordered_set{"*", "?"}) {
-            int charIdx = processedString.indexOf(i);
-            while (charIdx != -1) {
-                processedString.replace(charIdx, 1, " ");
-                charIdx = processedString.indexOf(i);
-            }
+    //
+    // Characters that are removed are read as spaces, without making a copy
+    // of the string to replace them in.
+    auto charAt = [&](qsizetype idx) {
+        QChar character = string.at(idx);
+        if (isRemovedCharacter(character,
+                               removeSpecialCharacters,
+                               removeGlobCharacters,
+                               removeRegexCharacters)) {
+            return QChar{' '};
         }
-    }
-    if (removeRegexCharacters) {
-        for (const auto &i : regexCharacters) {
-            int charIdx = processedString.indexOf(i.c_str());
-            while (charIdx != -1) {
-                processedString.replace(charIdx, 1, " ");
-                charIdx = processedString.indexOf(i.c_str());
-            }
+        return character;
+    };
+
+    // Removed characters never match an initial or final (and neither do
+    // spaces), so sets can be searched using the original string.
+    auto isIn = [&](const std::unordered_set<std::string_view> &set,
+                    qsizetype idx,
+                    qsizetype len) {
+        QStringView view = ChineseUtils::midView(string, idx, len);
+        if (removeRegexCharacters) {
+            return ChineseUtils::containsLowercase(set, view);
         }
-    }
 
-    // Because Qt uses UTF-16 for its internal representation of chars,
-    // and we maintain the invariant that no graphemes are larger than a
-    // single byte when encoded in UTF-16, it is safe to iterate QChar by
-    // QChar.
-    while (end_idx < processedString.length()) {
+        // Regex characters need to be handled in a special way;
+        // essentially, we need to check every possibility. If at
+        // least one possibility is valid, then the Jyutping can be
+        // considered valid.
+        QString stringToSearch;
+        for (qsizetype i = idx; i < idx + view.size(); ++i) {
+            stringToSearch += charAt(i);
+        }
+        std::vector<QString> stringsToSearch;
+        unfoldJyutpingRegex(stringToSearch.toLower(), stringsToSearch);
+        return std::any_of(stringsToSearch.begin(),
+                           stringsToSearch.end(),
+                           [&](const QString &s) {
+                               return set.contains(s.toStdString());
+                           });
+    };
+
+    auto pushSyllable = [&](qsizetype idx, qsizetype len) {
+        out.push_back({idx, ChineseUtils::midView(string, idx, len).size()});
+    };
+
+    while (end_idx < string.size()) {
         bool component_found = false;
 
-        QString currentString = processedString.mid(end_idx, 1).toLower();
-        bool isSpecialCharacter = (specialCharacters.find(
-                                       currentString.toStdString())
-                                   != specialCharacters.end());
-        bool isGlobCharacter = currentString.trimmed() == "*"
-                               || currentString.trimmed() == "?";
-        if (currentString == " " || currentString == "'" || isSpecialCharacter
-            || isGlobCharacter) {
+        QChar currentCharacter = charAt(end_idx).toLower();
+        bool isSpecial = ChineseUtils::isRomanisationSpecialCharacter(
+            currentCharacter);
+        bool isGlob = ChineseUtils::isGlobCharacter(currentCharacter);
+        if (currentCharacter == ' ' || currentCharacter == '\'' || isSpecial
+            || isGlob) {
             // The presence of a space, apostrophe, special character, or
             // glob character indicates that a syllable is completed.
             if (initial_found) {
@@ -1262,28 +1197,26 @@ bool segmentJyutping(const QString &string,
                 // sequence [initial] + [separator] is only valid Jyutping if the
                 // initial is also a valid final (i.e. [final] + [separator] is
                 // OK, but [initial] + [separator] is not).
-                QString previous_initial = processedString
-                                               .mid(start_idx,
-                                                    end_idx - start_idx)
-                                               .toLower();
-                syllables.push_back(previous_initial.toStdString());
-                if (finals.find(previous_initial.toStdString())
-                    == finals.end()) {
+                pushSyllable(start_idx, end_idx - start_idx);
+                if (!ChineseUtils::containsLowercase(
+                        finals,
+                        ChineseUtils::midView(string,
+                                              start_idx,
+                                              end_idx - start_idx))) {
                     valid_jyutping = false;
                 }
                 start_idx = end_idx;
                 initial_found = false;
             }
-            if (isGlobCharacter) {
+            if (isGlob) {
                 // Similar logic to the block above
                 if (end_idx >= 1 && (end_idx - start_idx >= 1)) {
-                    QString previous_initial = processedString
-                                                   .mid(start_idx,
-                                                        end_idx - start_idx)
-                                                   .toLower();
-                    syllables.push_back(previous_initial.toStdString());
-                    if (finals.find(previous_initial.toStdString())
-                        == finals.end()) {
+                    pushSyllable(start_idx, end_idx - start_idx);
+                    if (!ChineseUtils::containsLowercase(
+                            finals,
+                            ChineseUtils::midView(string,
+                                                  start_idx,
+                                                  end_idx - start_idx))) {
                         valid_jyutping = false;
                     }
                     initial_found = false;
@@ -1292,27 +1225,27 @@ bool segmentJyutping(const QString &string,
                 // Since whitespace matters for glob and regex, consume the
                 // next or previous whitespace if it exists (and was not
                 // already consumed by another glob character).
-                int glob_start_idx = end_idx;
-                int length = 1;
-                if ((end_idx >= 1) && (processedString.at(end_idx - 1) == ' ')
-                    && (!syllables.empty()) && syllables.back().back() != ' ') {
+                qsizetype glob_start_idx = end_idx;
+                qsizetype length = 1;
+                if ((end_idx >= 1) && (charAt(end_idx - 1) == ' ')
+                    && (!out.empty())
+                    && charAt(out.back().start + out.back().length - 1)
+                           != ' ') {
                     // Add preceding whitespace to this word
                     glob_start_idx--;
                     length++;
                 }
-                if ((processedString.length() > end_idx + 1)
-                    && (processedString.at(end_idx + 1) == ' ')) {
+                if ((string.size() > end_idx + 1)
+                    && (charAt(end_idx + 1) == ' ')) {
                     // Add succeeding whitespace to this word
                     length++;
                     end_idx++;
                 }
-                QString glob
-                    = processedString.mid(glob_start_idx, length).toLower();
-                syllables.push_back(glob.toStdString());
+                pushSyllable(glob_start_idx, length);
 
                 start_idx = end_idx;
-            } else if (isSpecialCharacter) {
-                syllables.push_back(currentString.toStdString());
+            } else if (isSpecial) {
+                pushSyllable(end_idx, 1);
             }
             start_idx++;
             end_idx++;
@@ -1323,45 +1256,23 @@ bool segmentJyutping(const QString &string,
         // final-checking code)
         // OR after an initial (that is also a final), like m or ng.
         // This block checks for the latter case.
-        if (currentString.at(0).isDigit()) {
+        if (currentCharacter.isDigit()) {
             if (initial_found) {
-                QString previous_initial = processedString
-                                               .mid(start_idx,
-                                                    end_idx - start_idx)
-                                               .toLower();
-
-                bool isValidFinal = false;
-                if (removeRegexCharacters) {
-                    isValidFinal = finals.find(previous_initial.toStdString())
-                                   != finals.end();
-                } else {
-                    // Regex characters need to be handled in a special way;
-                    // essentially, we need to check every possibility. If at
-                    // least one possibility is a valid final, then the Jyutping
-                    // can be considered valid.
-                    std::vector<QString> stringsToSearch;
-                    QString stringToSearch = previous_initial;
-                    unfoldJyutpingRegex(stringToSearch, stringsToSearch);
-
-                    bool isValidFinal = false;
-                    for (const auto &s : stringsToSearch) {
-                        auto searchResult = finals.find(s.toStdString());
-                        isValidFinal = isValidFinal
-                                       || (searchResult != finals.end());
-                    }
-                }
+                // When regex characters are kept, an initial followed directly
+                // by a digit is left for the initial and final searches below.
+                bool isValidFinal = removeRegexCharacters
+                                    && isIn(finals,
+                                            start_idx,
+                                            end_idx - start_idx);
 
                 if (isValidFinal) {
                     end_idx++;
-                    previous_initial = processedString
-                                           .mid(start_idx, end_idx - start_idx)
-                                           .toLower();
-                    syllables.push_back(previous_initial.toStdString());
+                    pushSyllable(start_idx, end_idx - start_idx);
                     start_idx = end_idx;
                     initial_found = false;
 
-                    if (currentString.at(0).digitValue() < 1
-                        || currentString.at(0).digitValue() > 6) {
+                    if (currentCharacter.digitValue() < 1
+                        || currentCharacter.digitValue() > 6) {
                         valid_jyutping = false;
                     }
 
@@ -1370,7 +1281,7 @@ bool segmentJyutping(const QString &string,
             } else {
                 // If there was no initial found, then the Jyutping isn't valid
                 valid_jyutping = false;
-                syllables.push_back(currentString.toStdString());
+                pushSyllable(end_idx, 1);
                 start_idx++;
                 end_idx++;
                 continue;
@@ -1380,64 +1291,22 @@ bool segmentJyutping(const QString &string,
         // If initial is valid, then extend the end_index for length of initial
         // cluster of consonants.
         // The longest length of an initial with unfolded regex is 16 UTF-16 bytes.
-        for (int initial_len = removeRegexCharacters
-                                   ? 2
-                                   : std::min(16,
-                                              static_cast<int>(
-                                                  processedString.size())
-                                                  - end_idx);
+        for (qsizetype initial_len
+             = removeRegexCharacters
+                   ? 2
+                   : std::min(static_cast<qsizetype>(16),
+                              string.size() - end_idx);
              initial_len > 0;
              initial_len--) {
-            currentString = processedString.mid(end_idx, initial_len).toLower();
-
-            bool isValidInitial = false;
-            if (removeRegexCharacters) {
-                isValidInitial = initials.find(currentString.toStdString())
-                                 != initials.end();
-            } else {
-                std::vector<QString> stringsToSearch;
-                QString stringToSearch = currentString;
-                unfoldJyutpingRegex(stringToSearch, stringsToSearch);
-
-                for (const auto &s : stringsToSearch) {
-                    auto searchResult = initials.find(s.toStdString());
-                    isValidInitial = isValidInitial
-                                     || (searchResult != initials.end());
-                }
-            }
-
-            if (!isValidInitial) {
+            if (!isIn(initials, end_idx, initial_len)) {
                 continue;
             }
 
             if (initial_found) {
                 // Multiple initials in a row are only valid if previous "initial"
                 // was actually a final (like m or ng)
-                QString previousInitial = processedString
-                                              .mid(start_idx,
-                                                   end_idx - start_idx)
-                                              .toLower();
-
-                bool previousInitialIsValidFinal = false;
-                if (removeRegexCharacters) {
-                    previousInitialIsValidFinal
-                        = finals.find(previousInitial.toStdString())
-                          != initials.end();
-                } else {
-                    std::vector<QString> stringsToSearch;
-                    QString stringToSearch = previousInitial;
-                    unfoldJyutpingRegex(stringToSearch, stringsToSearch);
-
-                    for (const auto &s : stringsToSearch) {
-                        auto searchResult = finals.find(s.toStdString());
-                        previousInitialIsValidFinal = previousInitialIsValidFinal
-                                                      || (searchResult
-                                                          != initials.end());
-                    }
-                }
-
-                if (previousInitialIsValidFinal) {
-                    syllables.push_back(previousInitial.toStdString());
+                if (isIn(finals, start_idx, end_idx - start_idx)) {
+                    pushSyllable(start_idx, end_idx - start_idx);
                     start_idx = end_idx;
                 } else {
                     valid_jyutping = false;
@@ -1456,50 +1325,27 @@ bool segmentJyutping(const QString &string,
         // If final is valid, then extend end_index for length of final.
         // Check for number at end of word as well (this represents tone number).
         //
-        // Then add the substring from [start_index, end_index) to vector
+        // Then add the range [start_index, end_index) to the output
         // and reset start_index, so we can start searching after the end_index.
-        for (int final_len = removeRegexCharacters
-                                 ? 4
-                                 : std::min(16,
-                                            static_cast<int>(
-                                                processedString.size())
-                                                - end_idx);
+        for (qsizetype final_len
+             = removeRegexCharacters ? 4
+                                     : std::min(static_cast<qsizetype>(16),
+                                                string.size() - end_idx);
              final_len > 0;
              final_len--) {
-            currentString = processedString.mid(end_idx, final_len).toLower();
-
-            bool isValidFinal = false;
-            if (removeRegexCharacters) {
-                isValidFinal = finals.find(currentString.toStdString())
-                               != finals.end();
-            } else {
-                std::vector<QString> stringsToSearch;
-                QString stringToSearch = currentString;
-                unfoldJyutpingRegex(stringToSearch, stringsToSearch);
-
-                for (const auto &s : stringsToSearch) {
-                    auto searchResult = finals.find(s.toStdString());
-                    isValidFinal = isValidFinal
-                                   || (searchResult != finals.end());
-                }
-            }
-
-            if (isValidFinal) {
+            if (isIn(finals, end_idx, final_len)) {
                 end_idx += final_len;
-                if (end_idx < processedString.length()) {
-                    if (processedString.at(end_idx).isDigit()) {
-                        if (processedString.at(end_idx).digitValue() < 1
-                            || processedString.at(end_idx).digitValue() > 6) {
+                if (end_idx < string.size()) {
+                    QChar tone = charAt(end_idx);
+                    if (tone.isDigit()) {
+                        if (tone.digitValue() < 1 || tone.digitValue() > 6) {
                             valid_jyutping = false;
                         }
 
                         end_idx++;
                     }
                 }
-                QString syllable = processedString
-                                       .mid(start_idx, end_idx - start_idx)
-                                       .toLower();
-                syllables.push_back(syllable.toStdString());
+                pushSyllable(start_idx, end_idx - start_idx);
                 start_idx = end_idx;
                 component_found = true;
                 initial_found = false;
@@ -1517,16 +1363,53 @@ bool segmentJyutping(const QString &string,
     }
 
     // Then add whatever's left in the search term, minus whitespace.
-    QString lastSyllable
-        = string.mid(start_idx, end_idx - start_idx).simplified().toLower();
-    if (!lastSyllable.isEmpty() && lastSyllable != "'") {
-        syllables.push_back(lastSyllable.toStdString());
-        if (finals.find(lastSyllable.toStdString()) == finals.end()) {
+    SyllableSpan lastSyllable = ChineseUtils::trimmedSpan(string,
+                                                          start_idx,
+                                                          end_idx);
+    QStringView lastSyllableView = string.sliced(lastSyllable.start,
+                                                 lastSyllable.length);
+    if (!lastSyllableView.isEmpty() && lastSyllableView != u"'") {
+        out.push_back(lastSyllable);
+        if (!ChineseUtils::containsLowercase(finals, lastSyllableView)) {
             valid_jyutping = false;
         }
     }
 
-    out = syllables;
+    return valid_jyutping;
+}
+
+bool segmentJyutping(const QString &string,
+                     std::vector<std::string> &out,
+                     bool removeSpecialCharacters,
+                     bool removeGlobCharacters,
+                     bool removeRegexCharacters)
+{
+    std::vector<SyllableSpan> syllables;
+    bool valid_jyutping = segmentJyutping(string,
+                                          syllables,
+                                          removeSpecialCharacters,
+                                          removeGlobCharacters,
+                                          removeRegexCharacters);
+
+    out.clear();
+    out.reserve(syllables.size());
+    for (const auto &syllable : syllables) {
+        QString text = string.mid(syllable.start, syllable.length);
+        if (syllable.trailing) {
+            text = text.simplified();
+        } else {
+            for (auto &character : text) {
+                if (isRemovedCharacter(character,
+                                       removeSpecialCharacters,
+                                       removeGlobCharacters,
+                                       removeRegexCharacters)) {
+                    character = ' ';
+                }
+            }
+        }
+        out.emplace_back(text.toLower().toStdString());
+    }
+
     return valid_jyutping;
 }
 
@@ -1,9 +1,13 @@
 #ifndef CANTONESEUTILS_H
 #define CANTONESEUTILS_H
 
+#include "logic/utils/chineseutils.h"
+
 #include <QString>
+#include <QStringView>
 
 #include <string>
+#include <vector>
 
 // The CantoneseUtils namespace contains static functions for working with
 // Jyutping (and other Cantonese romanizations, such as Yale/IPA).
@@ -15,11 +19,23 @@ std::string convertJyutpingToYale(const std::string &jyutping,
 std::string convertJyutpingToIPA(const std::string &jyutping,
                                  bool useSpacesToSegment = false);
 
+// These convert a single toned syllable without looking it up in the syllable
+// tables, which are built from them
+std::string convertJyutpingSyllableToYale(const std::string &syllable);
+std::string convertJyutpingSyllableToIPA(const std::string &syllable);
+
 bool segmentJyutping(const QString &string,
                      std::vector<std::string> &out,
                      bool removeSpecialCharacters = true,
                      bool removeGlobCharacters = true,
                      bool removeRegexCharacters = true);
+// Same as above, but finds syllables as ranges of string instead of copying
+// them out. Reuse out between calls to avoid allocating.
+bool segmentJyutping(QStringView string,
+                     std::vector<SyllableSpan> &out,
+                     bool removeSpecialCharacters = true,
+                     bool removeGlobCharacters = true,
+                     bool removeRegexCharacters = true);
 
 bool jyutpingAutocorrect(const QString &in,
                          QString &out,
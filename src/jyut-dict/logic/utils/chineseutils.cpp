@@ -2,98 +2,217 @@
 
 #include "logic/utils/utils.h"
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
 #include <unordered_set>
 
-namespace ChineseUtils {
+namespace {
 
-const static std::unordered_set<std::string> specialCharacters = {
-    ".",  "。", ",",  "，", "！", "？", "%",  "－", "…",  "⋯",  ".",
-    "·",  "\"", "“",  "”",  "$",  "｜", "：", "１", "２", "３", "４",
-    "５", "６", "７", "８", "９", "０", " ",  "!",  "(",  ")",  "|",
-    "1",  "2",  "3",  "4",  "5",  "6",  "7",  "8",  "9",  "0",
+struct CodepointRange
+{
+    char32_t first;
+    char32_t last;
 };
 
+// Sorted, so that isInRanges can stop at the first range past a codepoint
+constexpr std::array<CodepointRange, 7> ideographRanges{{
+    {0x3400, 0x4DBF},   // CJK Unified Ideographs Extension A
+    {0x4E00, 0x9FFF},   // CJK Unified Ideographs
+    {0x20000, 0x2A6DF}, // CJK Unified Ideographs Extension B
+    {0x2A700, 0x2B73F}, // CJK Unified Ideographs Extension C
+    {0x2B740, 0x2B81F}, // CJK Unified Ideographs Extension D
+    {0x2B820, 0x2CEAF}, // CJK Unified Ideographs Extension E
+    {0x2CEB0, 0x2EBEF}, // CJK Unified Ideographs Extension F
+}};
+
+// None of these change under NFC, have a combining class, or compose with the
+// character before them, so a string made only of them is already in NFC
+constexpr std::array<CodepointRange, 10> normalizedRanges{{
+    {0x0000, 0x02FF},   // Latin, up to the combining diacritics
+    {0x2010, 0x2027},   // General Punctuation (dashes, quotes, ellipses)
+    {0x2030, 0x205E},   // General Punctuation (per mille through dots)
+    {0x3000, 0x3029},   // CJK Symbols and Punctuation
+    {0x3030, 0x303F},   // CJK Symbols and Punctuation, after the tone marks
+    {0x3400, 0x4DBF},   // CJK Unified Ideographs Extension A
+    {0x4E00, 0x9FFF},   // CJK Unified Ideographs
+    {0xFF01, 0xFFEF},   // Halfwidth and Fullwidth Forms
+    {0x20000, 0x2A6DF}, // CJK Unified Ideographs Extension B
+    {0x2A700, 0x2EBEF}, // CJK Unified Ideographs Extensions C-F
+}};
+
+constexpr char32_t invalidCodepoint = 0xFFFFFFFF;
+
+constexpr std::string_view sameCharacter{Utils::SAME_CHARACTER_STRING};
+
+constexpr bool isInRanges(char32_t codepoint,
+                          std::span<const CodepointRange> ranges)
+{
+    for (const auto &range : ranges) {
+        if (codepoint < range.first) {
+            return false;
+        }
+        if (codepoint <= range.last) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Decodes the codepoint that starts at string[offset], and moves offset past
+// it. Malformed sequences decode to invalidCodepoint.
+char32_t decodeUtf8(std::string_view string, size_t &offset)
+{
+    unsigned char lead = static_cast<unsigned char>(string[offset]);
+    if (lead < 0x80) {
+        offset++;
+        return lead;
+    }
+
+    size_t length;
+    char32_t codepoint;
+    char32_t minimum;
+    if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        codepoint = lead & 0x1F;
+        minimum = 0x80;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        codepoint = lead & 0x0F;
+        minimum = 0x800;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        codepoint = lead & 0x07;
+        minimum = 0x10000;
+    } else {
+        offset++;
+        return invalidCodepoint;
+    }
+
+    for (size_t i = 1; i < length; i++) {
+        if (offset + i >= string.size()
+            || (static_cast<unsigned char>(string[offset + i]) & 0xC0)
+                   != 0x80) {
+            offset += i;
+            return invalidCodepoint;
+        }
+        codepoint = (codepoint << 6)
+                    | (static_cast<unsigned char>(string[offset + i]) & 0x3F);
+    }
+    offset += length;
+
+    if (codepoint < minimum || codepoint > 0x10FFFF
+        || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+        return invalidCodepoint;
+    }
+    return codepoint;
+}
+
+// Dictionary text is almost always valid UTF-8 that is already in NFC, so
+// only go through QString to normalize it when we can't tell that it is.
+// Returns either string itself or a view of storage.
+std::string_view normalizedView(std::string_view string, std::string &storage)
+{
+    size_t offset = 0;
+    while (offset < string.size()) {
+        char32_t codepoint = decodeUtf8(string, offset);
+        if (codepoint == invalidCodepoint
+            || !isInRanges(codepoint, normalizedRanges)) {
+            storage = QString::fromUtf8(string.data(),
+                                        static_cast<qsizetype>(string.size()))
+                          .normalized(QString::NormalizationForm_C)
+                          .toStdString();
+            return storage;
+        }
+    }
+    return string;
+}
+
+} // namespace
+
+namespace ChineseUtils {
+
+// Every one of these is a single UTF-16 code unit
+constexpr std::u16string_view romanisationSpecialCharacters{
+    u".。,，！？%－…⋯·\"“”$｜：１２３４５６７８９０"};
+
+// Longer than any initial or final, even with regex characters unfolded
+constexpr qsizetype maxLookupLength = 16;
+
+// Every one of these is a single codepoint
+constexpr std::u32string_view specialCharacters{
+    U".。,，！？%－…⋯·\"“”$｜：１２３４５６７８９０ !()|1234567890"};
+
 std::string applyColours(const std::string original,
                          std::span<const uint8_t> tones,
                          std::span<const std::string> jyutpingToneColours,
                          std::span<const std::string> pinyinToneColours,
                          const EntryColourPhoneticType type)
 {
+    std::string normalized;
+    std::string_view data = normalizedView(original, normalized);
+
+    std::span<const std::string> toneColours
+        = type == EntryColourPhoneticType::MANDARIN ? pinyinToneColours
+                                                    : jyutpingToneColours;
+    size_t longestColour = 0;
+    for (const auto &colour : toneColours) {
+        longestColour = std::max(longestColour, colour.size());
+    }
+
+    // Every ideograph takes at least three bytes, and only ideographs that
+    // have a tone get wrapped in a font tag
     std::string coloured_string;
-    auto data = QString::fromStdString(original)
-                    .normalized(QString::NormalizationForm_C)
-                    .toStdU32String();
+    coloured_string.reserve(
+        data.size()
+        + std::min(data.size() / 3, tones.size())
+              * (std::string_view{"<font color=\"\"></font>"}.size()
+                 + longestColour));
+
     size_t pos = 0;
-    for (const auto codepoint : data) {
-        std::string originalStr
-            = QString::fromStdU32String(std::u32string{codepoint}).toStdString();
+    size_t offset = 0;
+    while (offset < data.size()) {
+        size_t start = offset;
+        char32_t codepoint = decodeUtf8(data, offset);
+        std::string_view character = data.substr(start, offset - start);
 
         // Skip same character string; they have no colour
         // However, increment to the next tone position
         // since they represent characters that are the same between simplified
         // and traditional and therefore have tones
-        if (codepoint
-            == QString::fromStdString(Utils::SAME_CHARACTER_STRING)
-                   .toStdU32String()[0]) {
-            coloured_string += originalStr;
+        if (character == sameCharacter) {
+            coloured_string += character;
             pos++;
             continue;
         }
 
-        // Skip any special characters
+        // Skip any special characters (none of which are ideographs)
         // but do not increment to next tone position,
         // since special characters do not have any tones associated with them
-        auto isSpecialCharacter = specialCharacters.find(originalStr)
-                                  != specialCharacters.end();
-        bool isIdeograph
-            = (codepoint >= 0x4E00
-               && codepoint <= 0x9FFF) // CJK Unified Ideographs
-              || (codepoint >= 0x3400
-                  && codepoint <= 0x4DBF) // CJK Unified Ideographs Extension A
-              || (codepoint >= 0x20000
-                  && codepoint <= 0x2A6DF) // CJK Unified Ideographs Extension B
-              || (codepoint >= 0x2A700
-                  && codepoint <= 0x2B73F) // CJK Unified Ideographs Extension C
-              || (codepoint >= 0x2B740
-                  && codepoint <= 0x2B81F) // CJK Unified Ideographs Extension D
-              || (codepoint >= 0x2B820
-                  && codepoint <= 0x2CEAF) // CJK Unified Ideographs Extension E
-              || (codepoint >= 0x2CEB0
-                  && codepoint <= 0x2EBEF); // CJK Unified Ideographs Extension F
-        if (isSpecialCharacter || !isIdeograph) {
-            coloured_string += originalStr;
+        if (!isInRanges(codepoint, ideographRanges)) {
+            coloured_string += character;
             continue;
         }
 
         // Get the tone...
         if (pos >= tones.size()) {
-            coloured_string += originalStr;
+            coloured_string += character;
             continue;
         }
         size_t tone = tones[pos];
 
         // ... and apply tone colour formatting to the string
         switch (type) {
-        case EntryColourPhoneticType::CANTONESE: {
-            if (tone >= jyutpingToneColours.size()) {
-                coloured_string += originalStr;
-                continue;
-            }
-            coloured_string += "<font color=\""
-                               + jyutpingToneColours[tone]
-                               + "\">";
-            break;
-        }
+        case EntryColourPhoneticType::CANTONESE:
         case EntryColourPhoneticType::MANDARIN: {
-            if (tone >= pinyinToneColours.size()) {
-                coloured_string += originalStr;
+            if (tone >= toneColours.size()) {
+                coloured_string += character;
                 continue;
             }
-            coloured_string += "<font color=\""
-                               + pinyinToneColours[tone]
-                               + "\">";
+            coloured_string += "<font color=\"";
+            coloured_string += toneColours[tone];
+            coloured_string += "\">";
             break;
         }
         case EntryColourPhoneticType::NONE: {
@@ -102,7 +221,7 @@ std::string applyColours(const std::string original,
             break;
         }
         }
-        coloured_string += originalStr;
+        coloured_string += character;
         coloured_string += "</font>";
 
         pos++;
@@ -114,34 +233,39 @@ std::string applyColours(const std::string original,
 std::string compareStrings(const std::string &original,
                            const std::string &comparison)
 {
+    std::string normalizedOriginal;
+    std::string normalizedComparison;
+    std::string_view originalData = normalizedView(original,
+                                                   normalizedOriginal);
+    std::string_view comparisonData = normalizedView(comparison,
+                                                     normalizedComparison);
+
     std::string result;
-    std::u32string convertedOriginal = QString::fromStdString(original)
-                                           .normalized(
-                                               QString::NormalizationForm_C)
-                                           .toStdU32String();
-    std::u32string convertedComparison = QString::fromStdString(comparison)
-                                             .normalized(
-                                                 QString::NormalizationForm_C)
-                                             .toStdU32String();
-
-    if (convertedOriginal.size() != convertedComparison.size()) {
-        return result;
-    }
-
-    for (size_t i = 0; i < convertedOriginal.size(); i++) {
-        std::string currentCharacter
-            = QString::fromStdU32String(std::u32string{convertedComparison[i]})
-                  .toStdString();
-
-        auto isSpecialCharacter = specialCharacters.find(currentCharacter)
-                                  != specialCharacters.end();
-        if (isSpecialCharacter
-            || convertedOriginal[i] != convertedComparison[i]) {
-            result += currentCharacter;
+    result.reserve(comparisonData.size());
+
+    size_t originalOffset = 0;
+    size_t comparisonOffset = 0;
+    while (originalOffset < originalData.size()
+           && comparisonOffset < comparisonData.size()) {
+        char32_t originalCodepoint = decodeUtf8(originalData, originalOffset);
+        size_t start = comparisonOffset;
+        char32_t comparisonCodepoint = decodeUtf8(comparisonData,
+                                                  comparisonOffset);
+
+        if (originalCodepoint != comparisonCodepoint
+            || specialCharacters.find(comparisonCodepoint)
+                   != std::u32string_view::npos) {
+            result += comparisonData.substr(start, comparisonOffset - start);
             continue;
         }
 
-        result += Utils::SAME_CHARACTER_STRING;
+        result += sameCharacter;
+    }
+
+    // Strings with different numbers of characters can't be compared
+    if (originalOffset < originalData.size()
+        || comparisonOffset < comparisonData.size()) {
+        return {};
     }
 
     return result;
@@ -202,4 +326,64 @@ std::string constructRomanisationQuery(std::span<const std::string> words,
     return string.str();
 }
 
+bool isRomanisationSpecialCharacter(QChar character)
+{
+    return romanisationSpecialCharacters.find(character.unicode())
+           != std::u16string_view::npos;
+}
+
+bool isGlobCharacter(QChar character)
+{
+    return character == '*' || character == '?';
+}
+
+bool isRegexCharacter(QChar character)
+{
+    return character == '!' || character == '(' || character == ')'
+           || character == '|';
+}
+
+QStringView midView(QStringView string, qsizetype position, qsizetype length)
+{
+    if (position >= string.size()) {
+        return {};
+    }
+    return string.sliced(position,
+                         std::min(length, string.size() - position));
+}
+
+SyllableSpan trimmedSpan(QStringView string, qsizetype start, qsizetype end)
+{
+    QStringView view = midView(string, start, end - start);
+    qsizetype first = 0;
+    qsizetype last = view.size();
+    while (first < last && view.at(first).isSpace()) {
+        first++;
+    }
+    while (last > first && view.at(last - 1).isSpace()) {
+        last--;
+    }
+    return SyllableSpan{start + first, last - first, /* trailing */ true};
+}
+
+bool containsLowercase(const std::unordered_set<std::string_view> &set,
+                       QStringView string)
+{
+    if (string.isEmpty() || string.size() > maxLookupLength) {
+        return false;
+    }
+
+    std::array<char, maxLookupLength> buffer;
+    for (qsizetype i = 0; i < string.size(); ++i) {
+        char16_t character = string.at(i).toLower().unicode();
+        if (character > 0x7F) {
+            return false;
+        }
+        buffer[static_cast<size_t>(i)] = static_cast<char>(character);
+    }
+
+    return set.contains(
+        std::string_view{buffer.data(), static_cast<size_t>(string.size())});
+}
+
 } // namespace ChineseUtils
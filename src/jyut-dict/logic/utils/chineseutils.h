@@ -7,10 +7,27 @@
 
 #include <span>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 
 // The ChineseUtils namespace contains static functions for working with
 // various romanization schemes and Han characters.
 
+// A SyllableSpan is one syllable found by CantoneseUtils::segmentJyutping or
+// MandarinUtils::segmentPinyin, as an offset and length into the segmented
+// string instead of a copy of it.
+//
+// The syllable's text is that range, lowercased. Characters that were removed
+// by the segmenter (special, glob or regex characters) read as spaces. A
+// trailing span is the unsegmented remainder of the string; its whitespace
+// is simplified (as with QString::simplified()).
+struct SyllableSpan
+{
+    qsizetype start;
+    qsizetype length;
+    bool trailing = false;
+};
+
 namespace ChineseUtils {
 
 std::string applyColours(const std::string original,
@@ -20,16 +37,14 @@ std::string applyColours(const std::string original,
                          const EntryColourPhoneticType type
                          = EntryColourPhoneticType::CANTONESE);
 
-// The function first converts both the simplified and traditional strings into
-// u32strings.
+// The function walks both strings one codepoint at a time.
 //
 // There is no guarantee of byte length per "character" in each string
 // (most Latin characters are one byte, Chinese characters are usually
 // 2-3 bytes due to multibyte encoding schemes of UTF-8 + several entries
-// consist of both latin and chinese character combinations). Converting
-// the string to u32string makes each index correspond to exactly one grapheme,
-// allowing us to iterate through the string grapheme by grapheme by
-// incrementing the index, which is not true of a UTF-8 or UTF-16-encoded string.
+// consist of both latin and chinese character combinations), so the UTF-8
+// is decoded as it goes, rather than compared byte by byte. Strings that
+// are not already in NFC are normalized first.
 //
 // For each string, compare each of the graphemes between the simplified and
 // traditional versions; if graphemes are different, add that grapheme to the
@@ -89,6 +104,24 @@ std::string compareStrings(const std::string &original,
 std::string constructRomanisationQuery(std::span<const std::string> words,
                                        const char *delimiter);
 
+// Helpers shared by the Jyutping and Pinyin segmenters. None of these
+// allocate.
+bool isRomanisationSpecialCharacter(QChar character);
+bool isGlobCharacter(QChar character);
+bool isRegexCharacter(QChar character);
+
+// Same as QString::mid(), but returns a view into string.
+QStringView midView(QStringView string, qsizetype position, qsizetype length);
+
+// Returns the range [start, end) of string (clamped to its size) with
+// leading and trailing whitespace removed, as a trailing SyllableSpan.
+SyllableSpan trimmedSpan(QStringView string, qsizetype start, qsizetype end);
+
+// Returns whether the lowercase form of string is in set. Only ASCII strings
+// can match, since every initial and final is ASCII.
+bool containsLowercase(const std::unordered_set<std::string_view> &set,
+                       QStringView string);
+
 } // namespace ChineseUtils
 
 #endif // CHINESEUTILS_H
@@ -0,0 +1,130 @@
+#include "internedstring.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+
+// Strings are stored in chunks of chunkSize that are never moved or freed,
+// found through a table of chunks that never grows. Reading a string
+// therefore needs no lock; only intern() takes one, to look up and add
+// strings. size is bumped after a string is stored, so a reader that loads
+// it also sees every string stored before.
+constexpr std::size_t chunkBits = 8;
+constexpr std::size_t chunkSize = std::size_t{1} << chunkBits;
+// Room for a million distinct strings, far more than any database has
+constexpr std::size_t maxChunks = 4096;
+
+struct StringPool
+{
+    StringPool(void)
+    {
+        chunks[0].store(new std::string[chunkSize], std::memory_order_release);
+        ids.emplace(std::string_view{}, 0);
+        size.store(1, std::memory_order_release);
+    }
+
+    ~StringPool(void)
+    {
+        for (auto &chunk : chunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::shared_mutex mutex;
+    std::array<std::atomic<std::string *>, maxChunks> chunks{};
+    std::atomic<InternedString::Id> size{0};
+    std::unordered_map<std::string_view, InternedString::Id> ids;
+};
+
+StringPool &getPool(void)
+{
+    static StringPool pool;
+    return pool;
+}
+
+InternedString::Id intern(std::string_view string)
+{
+    if (string.empty()) {
+        return 0;
+    }
+
+    StringPool &pool = getPool();
+    {
+        std::shared_lock lock{pool.mutex};
+        auto result = pool.ids.find(string);
+        if (result != pool.ids.end()) {
+            return result->second;
+        }
+    }
+
+    std::lock_guard lock{pool.mutex};
+    auto result = pool.ids.find(string);
+    if (result != pool.ids.end()) {
+        return result->second;
+    }
+
+    InternedString::Id id = pool.size.load(std::memory_order_relaxed);
+    std::size_t chunk = id >> chunkBits;
+    if (chunk >= maxChunks) {
+        throw std::length_error{"too many interned strings"};
+    }
+    if (!pool.chunks[chunk].load(std::memory_order_relaxed)) {
+        pool.chunks[chunk].store(new std::string[chunkSize],
+                                 std::memory_order_release);
+    }
+
+    std::string *strings = pool.chunks[chunk].load(std::memory_order_relaxed);
+    std::string &stored = strings[id & (chunkSize - 1)];
+    stored = string;
+    pool.ids.emplace(stored, id);
+    pool.size.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+} // namespace
+
+InternedString::InternedString(const char *string)
+    : _id{intern(string ? std::string_view{string} : std::string_view{})}
+{}
+
+InternedString::InternedString(std::string_view string)
+    : _id{intern(string)}
+{}
+
+InternedString::InternedString(const std::string &string)
+    : _id{intern(string)}
+{}
+
+std::ostream &operator<<(std::ostream &out, const InternedString &string)
+{
+    return out << string.str();
+}
+
+InternedString::Id InternedString::getId(void) const
+{
+    return _id;
+}
+
+bool InternedString::empty(void) const
+{
+    return _id == 0;
+}
+
+const std::string &InternedString::str(void) const
+{
+    StringPool &pool = getPool();
+    // Acquiring size makes the strings stored so far visible to this thread
+    pool.size.load(std::memory_order_acquire);
+    return pool.chunks[_id >> chunkBits].load(
+        std::memory_order_acquire)[_id & (chunkSize - 1)];
+}
+
+const char *InternedString::c_str(void) const
+{
+    return str().c_str();
+}
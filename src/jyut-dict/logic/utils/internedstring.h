@@ -0,0 +1,53 @@
+#ifndef INTERNEDSTRING_H
+#define INTERNEDSTRING_H
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+// An InternedString is a small handle to a string stored exactly once in a
+// process-wide pool. Source names, sentence languages and definition labels
+// repeat thousands of times in a single result set, so results hold handles
+// instead of copies, and comparing two of them is an integer comparison.
+//
+// Strings are never removed from the pool; the set of distinct values
+// (sources, languages, labels) is small and bounded by the database.
+
+class InternedString
+{
+public:
+    using Id = std::uint32_t;
+
+    InternedString(void) = default;
+    InternedString(const char *string);
+    InternedString(std::string_view string);
+    InternedString(const std::string &string);
+
+    bool operator==(const InternedString &other) const = default;
+
+    friend std::ostream &operator<<(std::ostream &out,
+                                    const InternedString &string);
+
+    Id getId(void) const;
+    bool empty(void) const;
+
+    const std::string &str(void) const;
+    const char *c_str(void) const;
+
+private:
+    // Id 0 is always the empty string
+    Id _id = 0;
+};
+
+template<>
+struct std::hash<InternedString>
+{
+    std::size_t operator()(const InternedString &string) const noexcept
+    {
+        return std::hash<InternedString::Id>{}(string.getId());
+    }
+};
+
+#endif // INTERNEDSTRING_H
@@ -1,10 +1,13 @@
 #include "mandarinutils.h"
 
+#include "logic/utils/chineseutils.h"
+#include "logic/utils/syllabletable.h"
 #include "logic/utils/utils.h"
 
 #include <iostream>
 #include <regex>
 #include <sstream>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -23,6 +26,15 @@ const static std::unordered_set<std::string> regexCharacters = {
     "|",
 };
 
+const static std::unordered_set<std::string_view> initials
+    = {"b", "p", "m", "f",  "d",  "t",  "n", "l", "g", "k", "h",
+       "j", "q", "x", "zh", "ch", "sh", "r", "z", "c", "s", "y"};
+const static std::unordered_set<std::string_view> finals
+    = {"a",   "e",   "ai",   "ei",   "ao",   "ou", "an", "ang", "en",
+       "ang", "eng", "ong",  "er",   "i",    "ia", "ie", "iao", "iu",
+       "ian", "in",  "iang", "ing",  "iong", "u",  "ua", "uo",  "uai",
+       "ui",  "uan", "un",   "uang", "u",    "u:", "ue", "u:e", "o"};
+
 const static std::unordered_map<std::string, std::vector<std::string>>
     pinyinToneReplacements = {
         {"a", {"ā", "á", "ǎ", "à", "a"}},
@@ -157,6 +169,96 @@ const static std::vector<std::string> mandarinIPATones
     = {"˥˥", "˧˥", "˨˩˦", "˥˩", ""};
 #endif
 
+// Converts a single numbered Pinyin syllable to Pinyin with tone marks
+std::string createPrettySyllable(const std::string &numberedSyllable)
+{
+    std::string syllable{numberedSyllable};
+
+    // Extract the tone from the syllable
+    size_t tone_location = syllable.find_first_of("012345");
+    if (tone_location == std::string::npos) {
+        return syllable;
+    }
+    int tone = syllable.at(tone_location) - '0';
+    // Filter out invalid tone: set to neutral if tone doesn't work
+    if (tone <= 0 || tone > 5) {
+        tone = 5;
+    }
+
+    // Convert u: to ü
+    size_t location = syllable.find("u:");
+    if (location != std::string::npos) {
+        syllable.erase(location, 2);
+        syllable.insert(location, "ü");
+    }
+
+    // The rule for pinyin diacritic location is:
+    // - If a, e, or o exists in the syllable, it takes the diacritic.
+    // - Otherwise, the last u, ü, or i takes it.
+    location = syllable.find_first_of("aeo");
+    size_t character_size = 1;
+
+    if (location == std::string::npos) {
+        location = syllable.find("ü");
+        // ü is stored as two bytes, so change the number of characters that
+        // we need to delete if we find a ü
+        character_size = location == std::string::npos ? 1 : 2;
+    }
+
+    if (location == std::string::npos) {
+        location = syllable.find_last_of("ui");
+    }
+
+    if (location == std::string::npos) {
+        return syllable;
+    }
+
+    // replacementMap maps a character to its replacements with diacritics.
+    auto search = pinyinToneReplacements.find(
+        syllable.substr(location, character_size));
+    if (search != pinyinToneReplacements.end()) {
+        std::string replacement = search->second.at(
+            static_cast<size_t>(tone) - 1);
+        syllable.erase(location, character_size);
+        syllable.insert(location, replacement);
+    } else {
+        return syllable;
+    }
+
+    // Remove the tone from the pinyin
+    tone_location = syllable.find_first_of("012345");
+    syllable.erase(tone_location, 1);
+    return syllable;
+}
+
+// Segmentation doesn't need w as an initial, but the syllable tables need it
+// to spell syllables like wo3
+const static std::unordered_set<std::string_view> syllableInitials = [] {
+    std::unordered_set<std::string_view> set{initials};
+    set.emplace("w");
+    return set;
+}();
+
+// The syllables that the syllable tables are built from
+static std::vector<std::string> spellPinyinSyllables(void)
+{
+    return spellSyllables(syllableInitials, finals, {""});
+}
+
+static std::vector<std::string> spellTonedPinyinSyllables(void)
+{
+    return spellSyllables(syllableInitials, finals, {"1", "2", "3", "4", "5"});
+}
+
+// The syllable tables are built on first use rather than at startup, since
+// converting every syllable takes a while
+static const SyllableTable<std::string> &prettyPinyinTable(void)
+{
+    static const SyllableTable<std::string>
+        table{spellTonedPinyinSyllables(), createPrettySyllable};
+    return table;
+}
+
 std::string createPrettyPinyin(const std::string &pinyin)
 {
     if (pinyin.empty()) {
@@ -179,64 +281,8 @@ std::string createPrettyPinyin(const std::string &pinyin)
             continue;
         }
 
-        // Extract the tone from the syllable
-        size_t tone_location = syllable.find_first_of("012345");
-        if (tone_location == std::string::npos) {
-            result += syllable + " ";
-            continue;
-        }
-        int tone = syllable.at(tone_location) - '0';
-        // Filter out invalid tone: set to neutral if tone doesn't work
-        if (tone <= 0 || tone > 5) {
-            tone = 5;
-        }
-
-        // Convert u: to ü
-        size_t location = syllable.find("u:");
-        if (location != std::string::npos) {
-            syllable.erase(location, 2);
-            syllable.insert(location, "ü");
-        }
-
-        // The rule for pinyin diacritic location is:
-        // - If a, e, or o exists in the syllable, it takes the diacritic.
-        // - Otherwise, the last u, ü, or i takes it.
-        location = syllable.find_first_of("aeo");
-        size_t character_size = 1;
-
-        if (location == std::string::npos) {
-            location = syllable.find("ü");
-            // ü is stored as two bytes, so change the number of characters that
-            // we need to delete if we find a ü
-            character_size = location == std::string::npos ? 1 : 2;
-        }
-
-        if (location == std::string::npos) {
-            location = syllable.find_last_of("ui");
-        }
-
-        if (location == std::string::npos) {
-            result += syllable + " ";
-            continue;
-        }
-
-        // replacementMap maps a character to its replacements with diacritics.
-        auto search = pinyinToneReplacements.find(
-            syllable.substr(location, character_size));
-        if (search != pinyinToneReplacements.end()) {
-            std::string replacement = search->second.at(
-                static_cast<size_t>(tone) - 1);
-            syllable.erase(location, character_size);
-            syllable.insert(location, replacement);
-        } else {
-            result += syllable + " ";
-            continue;
-        }
-
-        // Remove the tone from the pinyin
-        tone_location = syllable.find_first_of("012345");
-        syllable.erase(tone_location, 1);
-        result += syllable + " ";
+        result += prettyPinyinTable().lookup(syllable, createPrettySyllable)
+                  + " ";
     }
 
     // Remove trailing space
@@ -307,6 +353,92 @@ std::string createPinyinWithV(const std::string &pinyin)
     return result;
 }
 
+// Converts a single numbered Pinyin syllable to Zhuyin
+std::string convertPinyinSyllableToZhuyin(const std::string &syllable)
+{
+    auto location = syllable.find_first_of("12345");
+    unsigned long tone = static_cast<unsigned long>(
+        std::stoi(syllable.substr(location, 1)));
+
+    // Compiling a regex costs much more than running it, so only do it once
+    static const std::regex u_colon_regex{"u\\:"};
+    static const std::regex jqx_u_regex{"([jqx])u"};
+    static const std::regex zcs_i_regex{"([zcs]h?)i"};
+    static const std::regex r_i_regex{"([r])i"};
+    static const std::regex ng_regex{"^ng([012345])$"};
+    static const std::regex hm_regex{"^hm([012345])$"};
+    static const std::regex hng_regex{"^hng([012345])$"};
+    static const std::regex er_regex{"^er([012345])$"};
+    static const std::regex pinyin_initial{"^([bpmfdtnlgkhjqxzcsr]?h?)"};
+    static const std::regex pinyin_final{
+        "([aeiouêvyw]?[aeioun]?[aeioung]?[ng]?)(r?)([012345])$"};
+
+    std::string zhuyin_syllable{syllable};
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, u_colon_regex, "v");
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, jqx_u_regex, "$1v");
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, zcs_i_regex, "$1");
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, r_i_regex, "$1");
+
+    // Handle special cases
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, ng_regex, "ㄫ$1");
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, hm_regex, "ㄏㄇ$1");
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, hng_regex, "ㄏㄫ$1");
+    zhuyin_syllable = std::regex_replace(zhuyin_syllable, er_regex, "ㄦ$1");
+
+    // Handle general case
+    // Convert Pinyin initial
+    std::smatch initial_match;
+    if (std::regex_search(zhuyin_syllable, initial_match, pinyin_initial)) {
+        if (initial_match[1].length()) {
+            zhuyin_syllable = std::regex_replace(zhuyin_syllable,
+                                                 pinyin_initial,
+                                                 zhuyinInitials.at(
+                                                     initial_match[1]));
+        }
+    }
+    // Convert Pinyin final
+    std::smatch final_match;
+    if (std::regex_search(zhuyin_syllable, final_match, pinyin_final)) {
+        std::string final;
+        std::string er;
+        if (final_match[1].length()) {
+            auto final_match_pos = zhuyinFinals.find(final_match[1]);
+            if (final_match_pos == zhuyinFinals.end()) {
+                // No final could be converted, give up
+                return syllable;
+            }
+            final = zhuyinFinals.at(final_match[1]);
+        }
+        if (final_match[2].length()) {
+            er = "ㄦ";
+        }
+        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
+                                             pinyin_final,
+                                             final + er);
+    }
+
+    // Add tone to zhuyin syllable
+    if (tone == 5) {
+        zhuyin_syllable = zhuyinTones[tone] + zhuyin_syllable;
+    } else {
+        auto er_pos = zhuyin_syllable.find("ㄦ");
+        if (er_pos != std::string::npos && zhuyin_syllable != "ㄦ") {
+            zhuyin_syllable.insert(er_pos, zhuyinTones[tone]);
+        } else {
+            zhuyin_syllable = zhuyin_syllable + zhuyinTones[tone];
+        }
+    }
+
+    return zhuyin_syllable;
+}
+
+static const SyllableTable<std::string> &zhuyinTable(void)
+{
+    static const SyllableTable<std::string>
+        table{spellTonedPinyinSyllables(), convertPinyinSyllableToZhuyin};
+    return table;
+}
+
 // Note that the majority of this code is derivative of Wiktionary's conversion
 // code, contained in the module cmn-pron
 // (https://en.wiktionary.org/wiki/Module:cmn-pron)
@@ -364,86 +496,9 @@ std::string convertPinyinToZhuyin(const std::string &pinyin,
             zhuyin_syllables.push_back(syllable);
             continue;
         }
-        unsigned long tone = static_cast<unsigned long>(
-            std::stoi(syllable.substr(location, 1)));
-
-        std::string zhuyin_syllable{syllable};
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"u\\:"},
-                                             "v");
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"([jqx])u"},
-                                             "$1v");
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"([zcs]h?)i"},
-                                             "$1");
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"([r])i"},
-                                             "$1");
-
-        // Handle special cases
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"^ng([012345])$"},
-                                             "ㄫ$1");
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"^hm([012345])$"},
-                                             "ㄏㄇ$1");
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"^hng([012345])$"},
-                                             "ㄏㄫ$1");
-        zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                             std::regex{"^er([012345])$"},
-                                             "ㄦ$1");
-
-        // Handle general case
-        // Convert Pinyin initial
-        std::smatch initial_match;
-        std::regex pinyin_initial = std::regex{"^([bpmfdtnlgkhjqxzcsr]?h?)"};
-        if (std::regex_search(zhuyin_syllable, initial_match, pinyin_initial)) {
-            if (initial_match[1].length()) {
-                zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                                     pinyin_initial,
-                                                     zhuyinInitials.at(
-                                                         initial_match[1]));
-            }
-        }
-        // Convert Pinyin final
-        std::smatch final_match;
-        std::regex pinyin_final = std::regex{
-            "([aeiouêvyw]?[aeioun]?[aeioung]?[ng]?)(r?)([012345])$"};
-        if (std::regex_search(zhuyin_syllable, final_match, pinyin_final)) {
-            std::string final;
-            std::string er;
-            if (final_match[1].length()) {
-                auto final_match_pos = zhuyinFinals.find(final_match[1]);
-                if (final_match_pos == zhuyinFinals.end()) {
-                    // No final could be converted, give up
-                    zhuyin_syllables.emplace_back(syllable);
-                    continue;
-                }
-                final = zhuyinFinals.at(final_match[1]);
-            }
-            if (final_match[2].length()) {
-                er = "ㄦ";
-            }
-            zhuyin_syllable = std::regex_replace(zhuyin_syllable,
-                                                 pinyin_final,
-                                                 final + er);
-        }
-
-        // Add tone to zhuyin syllable
-        if (tone == 5) {
-            zhuyin_syllable = zhuyinTones[tone] + zhuyin_syllable;
-        } else {
-            auto er_pos = zhuyin_syllable.find("ㄦ");
-            if (er_pos != std::string::npos && zhuyin_syllable != "ㄦ") {
-                zhuyin_syllable.insert(er_pos, zhuyinTones[tone]);
-            } else {
-                zhuyin_syllable = zhuyin_syllable + zhuyinTones[tone];
-            }
-        }
 
-        zhuyin_syllables.emplace_back(zhuyin_syllable);
+        zhuyin_syllables.emplace_back(
+            zhuyinTable().lookup(syllable, convertPinyinSyllableToZhuyin));
     }
 
     std::ostringstream zhuyin;
@@ -468,7 +523,8 @@ std::tuple<std::string, std::string> convertIPAMandarinSyllable(
     if (syllable == "ng") {
         ipa_final = mandarinIPAFinals.at("ng");
     } else {
-        std::regex initial_final_regex{"^([bcdfghjklmnpqrstxz]?h?)(.+)$"};
+        static const std::regex initial_final_regex{
+            "^([bcdfghjklmnpqrstxz]?h?)(.+)$"};
         std::smatch ipa_match;
 
         auto regex_res = std::regex_match(syllable,
@@ -526,6 +582,45 @@ std::tuple<std::string, std::string> convertIPAMandarinSyllable(
     return std::make_tuple(ipa_initial, ipa_final);
 }
 
+// Converts a single Pinyin syllable without tone to its IPA glottal stop (if
+// any), initial, and final. Tone is handled separately, since tone sandhi
+// depends on the neighbouring syllables.
+std::tuple<std::string, std::string, std::string> convertPinyinSyllableToIPA(
+    const std::string &syllable)
+{
+    std::string ipa_glottal;
+    std::string ipa_initial;
+    std::string ipa_final;
+
+    // Figure out whether this syllable needs a glottal stop
+    if (mandarinIPAGlottal.find(syllable) != mandarinIPAGlottal.end()) {
+        ipa_glottal = "ˀ";
+    }
+
+    // Mark close front rounded vowel with v instead of "u" or "u:"
+    static const std::regex u_colon_regex{"u\\:"};
+    static const std::regex jqx_u_regex{"([jqx])u"};
+    std::string syllable_with_v = std::regex_replace(syllable,
+                                                     u_colon_regex,
+                                                     "v");
+    syllable_with_v = std::regex_replace(syllable_with_v, jqx_u_regex, "$1v");
+
+    // Convert initial and final
+    std::tie(ipa_initial, ipa_final) = convertIPAMandarinSyllable(
+        syllable_with_v);
+
+    return std::make_tuple(ipa_glottal, ipa_initial, ipa_final);
+}
+
+static const SyllableTable<std::tuple<std::string, std::string, std::string>> &
+mandarinIPATable(void)
+{
+    static const SyllableTable<
+        std::tuple<std::string, std::string, std::string>>
+        table{spellPinyinSyllables(), convertPinyinSyllableToIPA};
+    return table;
+}
+
 std::string convertPinyinToIPA(const std::string &pinyin,
                                bool useSpacesToSegment)
 {
@@ -603,23 +698,10 @@ std::string convertPinyinToIPA(const std::string &pinyin,
         std::string syllable_without_tone
             = syllable.substr(0, static_cast<unsigned long>(tone_location));
 
-        // Figure out whether this syllable needs a glottal stop
-        if (mandarinIPAGlottal.find(syllable_without_tone)
-            != mandarinIPAGlottal.end()) {
-            ipa_glottal = "ˀ";
-        }
-
-        // Mark close front rounded vowel with v instead of "u" or "u:"
-        syllable_without_tone = std::regex_replace(syllable_without_tone,
-                                                   std::regex{"u\\:"},
-                                                   "v");
-        syllable_without_tone = std::regex_replace(syllable_without_tone,
-                                                   std::regex{"([jqx])u"},
-                                                   "$1v");
-
-        // Convert initial and final
-        std::tie(ipa_initial, ipa_final) = convertIPAMandarinSyllable(
-            syllable_without_tone);
+        // Convert glottal stop, initial and final
+        std::tie(ipa_glottal, ipa_initial, ipa_final)
+            = mandarinIPATable().lookup(syllable_without_tone,
+                                      convertPinyinSyllableToIPA);
 
         // Convert tones
         int tone = syllable_tones[i].first;
@@ -784,61 +866,65 @@ bool pinyinSoundChanges(std::vector<std::string> &inOut)
     return false;
 }
 
-bool segmentPinyin(const QString &string,
-                   std::vector<std::string> &out,
+bool segmentPinyin(QStringView string,
+                   std::vector<SyllableSpan> &out,
                    bool removeSpecialCharacters,
                    bool removeGlobCharacters)
 {
-    std::vector<std::string> syllables;
-
-    std::unordered_set<std::string> initials = {"b", "p", "m",  "f",  "d",  "t",
-                                                "n", "l", "g",  "k",  "h",  "j",
-                                                "q", "x", "zh", "ch", "sh", "r",
-                                                "z", "c", "s",  "y"};
-    std::unordered_set<std::string> finals
-        = {"a",   "e",   "ai",   "ei",   "ao",   "ou", "an", "ang", "en",
-           "ang", "eng", "ong",  "er",   "i",    "ia", "ie", "iao", "iu",
-           "ian", "in",  "iang", "ing",  "iong", "u",  "ua", "uo",  "uai",
-           "ui",  "uan", "un",   "uang", "u",    "u:", "ue", "u:e", "o"};
+    out.clear();
 
     bool valid_pinyin = true;
     // Keep track of indices for current segmented word; [start_index, end_index)
     // Greedily try to expand end_index by checking for valid sequences
     // of characters
-    int start_idx = 0;
-    int end_idx = 0;
+    qsizetype start_idx = 0;
+    qsizetype end_idx = 0;
     bool initial_found = false;
 
-    while (end_idx < string.length()) {
+    // Like QString::mid(), a component that runs past the end of the string
+    // is cut short. It then can't match, since it is shorter than requested.
+    auto isIn = [&](const std::unordered_set<std::string_view> &set,
+                    qsizetype idx,
+                    qsizetype len) {
+        QStringView view = ChineseUtils::midView(string, idx, len);
+        return view.size() == len
+               && ChineseUtils::containsLowercase(set, view);
+    };
+
+    auto pushSyllable = [&](qsizetype idx, qsizetype len) {
+        out.push_back({idx, ChineseUtils::midView(string, idx, len).size()});
+    };
+
+    while (end_idx < string.size()) {
         bool next_iteration = false;
         // Ignore separation characters; these are special.
-        QString currentString = string.mid(end_idx, 1).toLower();
-        bool isSpecialCharacter = (specialCharacters.find(
-                                       currentString.toStdString())
-                                   != specialCharacters.end());
-        bool isGlobCharacter = currentString.trimmed() == "*"
-                               || currentString.trimmed() == "?";
-        if (currentString == " " || currentString == "'" || isSpecialCharacter
-            || isGlobCharacter) {
+        QChar currentCharacter = string.at(end_idx).toLower();
+        bool isSpecial = ChineseUtils::isRomanisationSpecialCharacter(
+            currentCharacter);
+        bool isGlob = ChineseUtils::isGlobCharacter(currentCharacter);
+        if (currentCharacter == ' ' || currentCharacter == '\'' || isSpecial
+            || isGlob) {
             if (initial_found) { // Add any incomplete word to the vector
-                QString previous_initial
-                    = string.mid(start_idx, end_idx - start_idx).toLower();
-                syllables.push_back(previous_initial.toStdString());
-                if (finals.find(previous_initial.toStdString())
-                    == finals.end()) {
+                pushSyllable(start_idx, end_idx - start_idx);
+                if (!ChineseUtils::containsLowercase(
+                        finals,
+                        ChineseUtils::midView(string,
+                                              start_idx,
+                                              end_idx - start_idx))) {
                     valid_pinyin = false;
                 }
                 start_idx = end_idx;
                 initial_found = false;
             }
-            if (!removeGlobCharacters && isGlobCharacter) {
+            if (!removeGlobCharacters && isGlob) {
                 // Add anything before the current glob character
                 if (end_idx >= 1 && (end_idx - start_idx >= 1)) {
-                    QString previous_initial
-                        = string.mid(start_idx, end_idx - start_idx).toLower();
-                    syllables.push_back(previous_initial.toStdString());
-                    if (finals.find(previous_initial.toStdString())
-                        == finals.end()) {
+                    pushSyllable(start_idx, end_idx - start_idx);
+                    if (!ChineseUtils::containsLowercase(
+                            finals,
+                            ChineseUtils::midView(string,
+                                                  start_idx,
+                                                  end_idx - start_idx))) {
                         valid_pinyin = false;
                     }
                     initial_found = false;
@@ -847,26 +933,27 @@ bool segmentPinyin(const QString &string,
                 // Since whitespace matters for glob characters, consume the
                 // next or previous whitespace if it exists (and was not
                 // already consumed by another glob character).
-                int new_end_index = end_idx;
-                int length = 1;
+                qsizetype new_end_index = end_idx;
+                qsizetype length = 1;
                 if ((end_idx >= 1) && (string.at(end_idx - 1) == ' ')
-                    && syllables.back().back() != ' ') {
+                    && !out.empty()
+                    && string.at(out.back().start + out.back().length - 1)
+                           != ' ') {
                     // Add preceding whitespace to this word
                     new_end_index--;
                     length++;
                 }
-                if ((string.length() > end_idx + 1)
+                if ((string.size() > end_idx + 1)
                     && (string.at(end_idx + 1) == ' ')) {
                     // Add succeeding whitespace to this word
                     length++;
                     end_idx++;
                 }
-                QString glob = string.mid(new_end_index, length).toLower();
-                syllables.push_back(glob.toStdString());
+                pushSyllable(new_end_index, length);
 
                 start_idx = end_idx;
-            } else if (!removeSpecialCharacters && isSpecialCharacter) {
-                syllables.push_back(currentString.toStdString());
+            } else if (!removeSpecialCharacters && isSpecial) {
+                pushSyllable(end_idx, 1);
             }
 
             start_idx++;
@@ -877,11 +964,8 @@ bool segmentPinyin(const QString &string,
         // First, check for initials
         // If initial is valid, then extend the end_index for length of initial
         // cluster of consonants.
-        for (int initial_len = 2; initial_len > 0; initial_len--) {
-            currentString = string.mid(end_idx, initial_len).toLower();
-            auto searchResult = initials.find(currentString.toStdString());
-            if (searchResult != initials.end()
-                && currentString.length() == initial_len) {
+        for (qsizetype initial_len = 2; initial_len > 0; initial_len--) {
+            if (isIn(initials, end_idx, initial_len)) {
                 if (initial_found) {
                     // Two initials in a row are invalid Pinyin.
                     valid_pinyin = false;
@@ -901,20 +985,17 @@ bool segmentPinyin(const QString &string,
         // If final is valid, then extend end_index for length of final.
         // Check for number at end of word as well (this represents tone number).
         //
-        // Then add the substring from [start_index, end_index) to vector
+        // Then add the range [start_index, end_index) to the output
         // and reset start_index, so we can start searching after the end_index.
-        for (int final_len = 4; final_len > 0; final_len--) {
-            currentString = string.mid(end_idx, final_len).toLower();
-            auto searchResult = finals.find(currentString.toStdString());
-            if (searchResult != finals.end()
-                && currentString.length() == final_len) {
+        for (qsizetype final_len = 4; final_len > 0; final_len--) {
+            if (isIn(finals, end_idx, final_len)) {
                 end_idx += final_len;
 
                 // Append erhua "r" and tone digit to the syllable
-                if (end_idx < string.length() && string.at(end_idx) == 'r') {
+                if (end_idx < string.size() && string.at(end_idx) == 'r') {
                     end_idx++;
                 }
-                if (end_idx < string.length() && string.at(end_idx).isDigit()) {
+                if (end_idx < string.size() && string.at(end_idx).isDigit()) {
                     if (string.at(end_idx).digitValue() < 1
                         || string.at(end_idx).digitValue() > 5) {
                         valid_pinyin = false;
@@ -922,9 +1003,7 @@ bool segmentPinyin(const QString &string,
                     end_idx++;
                 }
 
-                QString syllable
-                    = string.mid(start_idx, end_idx - start_idx).toLower();
-                syllables.push_back(syllable.toStdString());
+                pushSyllable(start_idx, end_idx - start_idx);
                 start_idx = end_idx;
                 next_iteration = true;
                 initial_found = false;
@@ -940,16 +1019,42 @@ bool segmentPinyin(const QString &string,
     }
 
     // Then add whatever's left in the search term, minus whitespace.
-    QString lastSyllable
-        = string.mid(start_idx, end_idx - start_idx).simplified().toLower();
-    if (!lastSyllable.isEmpty() && lastSyllable != "'") {
-        syllables.push_back(lastSyllable.toStdString());
-        if (finals.find(lastSyllable.toStdString()) == finals.end()) {
+    SyllableSpan lastSyllable = ChineseUtils::trimmedSpan(string,
+                                                          start_idx,
+                                                          end_idx);
+    QStringView lastSyllableView = string.sliced(lastSyllable.start,
+                                                 lastSyllable.length);
+    if (!lastSyllableView.isEmpty() && lastSyllableView != u"'") {
+        out.push_back(lastSyllable);
+        if (!ChineseUtils::containsLowercase(finals, lastSyllableView)) {
             valid_pinyin = false;
         }
     }
 
-    out = syllables;
+    return valid_pinyin;
+}
+
+bool segmentPinyin(const QString &string,
+                   std::vector<std::string> &out,
+                   bool removeSpecialCharacters,
+                   bool removeGlobCharacters)
+{
+    std::vector<SyllableSpan> syllables;
+    bool valid_pinyin = segmentPinyin(string,
+                                      syllables,
+                                      removeSpecialCharacters,
+                                      removeGlobCharacters);
+
+    out.clear();
+    out.reserve(syllables.size());
+    for (const auto &syllable : syllables) {
+        QString text = string.mid(syllable.start, syllable.length);
+        if (syllable.trailing) {
+            text = text.simplified();
+        }
+        out.emplace_back(text.toLower().toStdString());
+    }
+
     return valid_pinyin;
 }
 
@@ -2,10 +2,14 @@
 #define MANDARINUTILS_H
 
 #include "logic/entry/entryphoneticoptions.h"
+#include "logic/utils/chineseutils.h"
 
 #include <QString>
+#include <QStringView>
 
 #include <string>
+#include <tuple>
+#include <vector>
 
 // The MandarinUtils namespace contains static functions for working with
 // Mandarin romanizations.
@@ -21,10 +25,23 @@ std::string convertPinyinToZhuyin(const std::string &pinyin,
 std::string convertPinyinToIPA(const std::string &pinyin,
                                bool useSpacesToSegment = false);
 
+// These convert a single syllable without looking it up in the syllable
+// tables, which are built from them
+std::string createPrettySyllable(const std::string &numberedSyllable);
+std::string convertPinyinSyllableToZhuyin(const std::string &syllable);
+std::tuple<std::string, std::string, std::string> convertPinyinSyllableToIPA(
+    const std::string &syllable);
+
 bool segmentPinyin(const QString &string,
                    std::vector<std::string> &out,
                    bool removeSpecialCharacters = true,
                    bool removeGlobCharacters = true);
+// Same as above, but finds syllables as ranges of string instead of copying
+// them out. Reuse out between calls to avoid allocating.
+bool segmentPinyin(QStringView string,
+                   std::vector<SyllableSpan> &out,
+                   bool removeSpecialCharacters = true,
+                   bool removeGlobCharacters = true);
 bool pinyinSoundChanges(std::vector<std::string> &inOut);
 } // namespace MandarinUtils
 
@@ -3,884 +3,954 @@
 #include "logic/utils/cantoneseutils.h"
 #include "logic/utils/mandarinutils.h"
 
-#include <QList>
-#include <QRegularExpression>
+#include <QChar>
 #include <QString>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
 // These are characters that 100% only exist in simplified form
-const static QList<QString> SIMPLIFIED_CHINESE_CHARS = {
-    "\u343d", "\u3447", "\u3448", "\u3454", "\u3469", "\u34e5", "\u3509",
-    "\u358a", "\u359e", "\u360e", "\u36af", "\u36c0", "\u36df", "\u36e0",
-    "\u36e3", "\u36e4", "\u36ff", "\u37c6", "\u37dc", "\u3918", "\u39cf",
-    "\u39d0", "\u39d1", "\u39df", "\u39f0", "\u3a2b", "\u3b4e", "\u3b4f",
-    "\u3b63", "\u3b64", "\u3b74", "\u3c69", "\u3c6e", "\u3cbf", "\u3cd4",
-    "\u3cd5", "\u3ce0", "\u3ce1", "\u3ce2", "\u3d89", "\u3db6", "\u3dbd",
-    "\u3e8d", "\u3ec5", "\u3ecf", "\u3ed8", "\u4025", "\u4056", "\u40b5",
-    "\u4149", "\u416a", "\u41f2", "\u4264", "\u4336", "\u4337", "\u4338",
-    "\u4339", "\u433a", "\u433b", "\u433c", "\u433d", "\u433e", "\u4340",
-    "\u4341", "\u44d5", "\u45d6", "\u461b", "\u461e", "\u464a", "\u464c",
-    "\u4653", "\u4723", "\u4725", "\u4727", "\u4729", "\u4759", "\u478c",
-    "\u478d", "\u478e", "\u4790", "\u47e2", "\u4880", "\u4881", "\u4882",
-    "\u497a", "\u497d", "\u497e", "\u497f", "\u4980", "\u4981", "\u4982",
-    "\u4983", "\u4985", "\u49b6", "\u49b7", "\u4b6a", "\u4bc3", "\u4bc4",
-    "\u4bc5", "\u4c9d", "\u4c9e", "\u4c9f", "\u4ca0", "\u4ca1", "\u4ca2",
-    "\u4ca3", "\u4d13", "\u4d14", "\u4d15", "\u4d16", "\u4d17", "\u4d18",
-    "\u4d19", "\u4dae", "\u4e0e", "\u4e13", "\u4e1a", "\u4e1b", "\u4e1c",
-    "\u4e1d", "\u4e25", "\u4e27", "\u4e34", "\u4e3a", "\u4e3d", "\u4e3e",
-    "\u4e4c", "\u4e54", "\u4e60", "\u4e61", "\u4e66", "\u4e70", "\u4e9a",
-    "\u4ea7", "\u4ea9", "\u4eb2", "\u4eb5", "\u4eb8", "\u4ebf", "\u4ed1",
-    "\u4ed3", "\u4eec", "\u4f1b", "\u4f1e", "\u4f1f", "\u4f20", "\u4f21",
-    "\u4f23", "\u4f24", "\u4f25", "\u4f26", "\u4f27", "\u4f2a", "\u4f2b",
-    "\u4f65", "\u4fa0", "\u4fa3", "\u4fa5", "\u4fa6", "\u4fa7", "\u4fa8",
-    "\u4faa", "\u4fac", "\u4fe3", "\u4fe6", "\u4fe8", "\u4fe9", "\u4fea",
-    "\u4feb", "\u4fed", "\u503a", "\u503e", "\u507b", "\u507e", "\u507f",
-    "\u50a5", "\u50a7", "\u50a8", "\u50a9", "\u5156", "\u5170", "\u5173",
-    "\u5174", "\u5179", "\u517b", "\u517d", "\u5181", "\u5188", "\u5199",
-    "\u519b", "\u519c", "\u51af", "\u51b3", "\u51bb", "\u51c0", "\u51db",
-    "\u51eb", "\u51ef", "\u51fb", "\u51ff", "\u520d", "\u5219", "\u521a",
-    "\u521b", "\u522c", "\u522d", "\u523d", "\u523e", "\u523f", "\u5240",
-    "\u5242", "\u5250", "\u5251", "\u5265", "\u5267", "\u529d", "\u52a1",
-    "\u52a2", "\u52a8", "\u52b1", "\u52b2", "\u52cb", "\u52da", "\u5326",
-    "\u532e", "\u533a", "\u534e", "\u534f", "\u5356", "\u5362", "\u5364",
-    "\u536b", "\u5374", "\u5385", "\u5386", "\u5389", "\u538b", "\u538c",
-    "\u538d", "\u5390", "\u5395", "\u53a2", "\u53a3", "\u53bf", "\u53c1",
-    "\u53d1", "\u53d8", "\u53f9", "\u53fd", "\u5415", "\u5417", "\u5423",
-    "\u5428", "\u542f", "\u5450", "\u5452", "\u5453", "\u5455", "\u5456",
-    "\u5457", "\u5458", "\u5459", "\u545b", "\u545c", "\u5499", "\u549b",
-    "\u549d", "\u54d1", "\u54d2", "\u54d3", "\u54d4", "\u54d5", "\u54d7",
-    "\u54d9", "\u54dc", "\u54dd", "\u54df", "\u551b", "\u551d", "\u5520",
-    "\u5521", "\u5522", "\u5524", "\u5567", "\u556c", "\u556d", "\u556e",
-    "\u556f", "\u5570", "\u5574", "\u5578", "\u55b7", "\u55be", "\u55bd",
-    "\u55eb", "\u55f3", "\u5618", "\u5624", "\u565c", "\u56a3", "\u56e2",
-    "\u56f1", "\u56f4", "\u56f5", "\u56fd", "\u56fe", "\u5706", "\u5723",
-    "\u5739", "\u573a", "\u5757", "\u575a", "\u575b", "\u575c", "\u575d",
-    "\u575e", "\u575f", "\u5760", "\u5784", "\u5785", "\u5786", "\u5792",
-    "\u57a6", "\u57a9", "\u57ab", "\u57ad", "\u57b1", "\u57b2", "\u57b4",
-    "\u57d8", "\u57d9", "\u57da", "\u57ef", "\u5811", "\u5899", "\u58f6",
-    "\u58f8", "\u5904", "\u5907", "\u5934", "\u5939", "\u593a", "\u5941",
-    "\u5942", "\u594b", "\u5956", "\u5965", "\u5986", "\u5987", "\u5988",
-    "\u59a9", "\u59aa", "\u59ab", "\u5a04", "\u5a05", "\u5a06", "\u5a07",
-    "\u5a08", "\u5a32", "\u5a34", "\u5a73", "\u5a74", "\u5a75", "\u5a76",
-    "\u5aaa", "\u5ad2", "\u5ad4", "\u5af1", "\u5b37", "\u5b59", "\u5b66",
-    "\u5b6a", "\u5ba0", "\u5ba1", "\u5baa", "\u5bab", "\u5bbd", "\u5bbe",
-    "\u5bdd", "\u5bfb", "\u5bfc", "\u5c06", "\u5c18", "\u5c1d", "\u5c27",
-    "\u5c34", "\u5c42", "\u5c43", "\u5c49", "\u5c61", "\u5c66", "\u5c7f",
-    "\u5c81", "\u5c82", "\u5c96", "\u5c97", "\u5c98", "\u5c99", "\u5c9a",
-    "\u5c9b", "\u5cad", "\u5cbd", "\u5cbf", "\u5cc4", "\u5ce1", "\u5ce3",
-    "\u5ce4", "\u5ce5", "\u5c36", "\u5d02", "\u5d03", "\u5d04", "\u5d2d",
-    "\u5d58", "\u5d5a", "\u5d5d", "\u5dc5", "\u5de9", "\u5def", "\u5e01",
-    "\u5e05", "\u5e08", "\u5e0f", "\u5e10", "\u5e1c", "\u5e26", "\u5e27",
-    "\u5e2e", "\u5e31", "\u5e3b", "\u5e3c", "\u5e86", "\u5e90", "\u5e91",
-    "\u5e93", "\u5e9e", "\u5e9f", "\u5eea", "\u5f02", "\u5f11", "\u5f20",
-    "\u5f25", "\u5f2a", "\u5f2f", "\u5f55", "\u5f5d", "\u5f68", "\u5f7b",
-    "\u5f84", "\u5f95", "\u5fc6", "\u5fcf", "\u5fe7", "\u5ffe", "\u6001",
-    "\u6002", "\u6003", "\u6004", "\u6005", "\u6006", "\u603b", "\u603c",
-    "\u603f", "\u6073", "\u6076", "\u6078", "\u6079", "\u607a", "\u607b",
-    "\u607c", "\u607d", "\u60a6", "\u60ab", "\u60ac", "\u60ad", "\u60ae",
-    "\u60af", "\u60ca", "\u60e8", "\u60e9", "\u60eb", "\u60ec", "\u60ed",
-    "\u60ee", "\u60ef", "\u6124", "\u6126", "\u6151", "\u61d1", "\u61d2",
-    "\u61d4", "\u6206", "\u620b", "\u620f", "\u6217", "\u6218", "\u622c",
-    "\u622f", "\u6269", "\u626a", "\u626b", "\u626c", "\u6270", "\u629a",
-    "\u629f", "\u62a0", "\u62a1", "\u62a2", "\u62a4", "\u62df", "\u62e2",
-    "\u62e3", "\u62e5", "\u62e6", "\u62e7", "\u62e8", "\u62e9", "\u631a",
-    "\u631b", "\u631c", "\u631d", "\u631e", "\u631f", "\u6320", "\u6321",
-    "\u6322", "\u6323", "\u6324", "\u6325", "\u6326", "\u635d", "\u635e",
-    "\u635f", "\u6361", "\u6362", "\u6363", "\u63b3", "\u63b4", "\u63b7",
-    "\u63b8", "\u63ba", "\u63bc", "\u63fd", "\u63ff", "\u6400", "\u6401",
-    "\u6402", "\u6405", "\u6444", "\u6445", "\u6446", "\u6447", "\u6448",
-    "\u644a", "\u6484", "\u64b5", "\u64b7", "\u64b8", "\u64ba", "\u64de",
-    "\u6512", "\u654c", "\u655b", "\u6569", "\u6593", "\u65a9", "\u65e7",
-    "\u65f7", "\u65f8", "\u6619", "\u663c", "\u663d", "\u663e", "\u6653",
-    "\u6654", "\u6655", "\u6656", "\u6682", "\u66a7", "\u6740", "\u6742",
-    "\u6743", "\u6761", "\u6765", "\u6768", "\u6769", "\u679e", "\u67a2",
-    "\u67a3", "\u67a5", "\u67a7", "\u67a8", "\u67aa", "\u67ab", "\u67ad",
-    "\u67e0", "\u67fd", "\u6800", "\u6805", "\u6807", "\u6808", "\u6809",
-    "\u680a", "\u680b", "\u680c", "\u680e", "\u680f", "\u6811", "\u6837",
-    "\u6860", "\u6861", "\u6862", "\u6863", "\u6864", "\u6865", "\u6866",
-    "\u6867", "\u6868", "\u6869", "\u68bc", "\u68be", "\u68bf", "\u68c0",
-    "\u68c1", "\u68c2", "\u6901", "\u691f", "\u6920", "\u6922", "\u6924",
-    "\u692b", "\u692d", "\u697c", "\u6984", "\u6985", "\u6987", "\u6988",
-    "\u6989", "\u69da", "\u69db", "\u69df", "\u69e0", "\u6a2a", "\u6a2f",
-    "\u6a31", "\u6a65", "\u6a71", "\u6a79", "\u6a7c", "\u6aa9", "\u6b24",
-    "\u6b27", "\u6b7c", "\u6b81", "\u6b87", "\u6b8b", "\u6b92", "\u6b93",
-    "\u6b9a", "\u6ba1", "\u6bb4", "\u6bc1", "\u6bc2", "\u6bd5", "\u6bd9",
-    "\u6bf5", "\u6caa", "\u6c07", "\u6c22", "\u6c29", "\u6c32", "\u6c47",
-    "\u6c49", "\u6c64", "\u6c9f", "\u6ca3", "\u6ca4", "\u6ca5", "\u6ca6",
-    "\u6ca7", "\u6ca8", "\u6ca9", "\u6cde", "\u6cf6", "\u6cf7", "\u6cf8",
-    "\u6cfa", "\u6cfb", "\u6cfc", "\u6cfd", "\u6cfe", "\u6d01", "\u6d43",
-    "\u6d45", "\u6d46", "\u6d47", "\u6d48", "\u6d4a", "\u6d4b", "\u6d4d",
-    "\u6d4e", "\u6d4f", "\u6d50", "\u6d51", "\u6d52", "\u6d53", "\u6d54",
-    "\u6d55", "\u6d9b", "\u6d9d", "\u6d9e", "\u6d9f", "\u6da0", "\u6da1",
-    "\u6da2", "\u6da3", "\u6da4", "\u6da6", "\u6da7", "\u6da8", "\u6da9",
-    "\u6e0a", "\u6e0c", "\u6e0d", "\u6e0e", "\u6e10", "\u6e11", "\u6e14",
-    "\u6e17", "\u6e7e", "\u6e7f", "\u6e83", "\u6e85", "\u6e86", "\u6e87",
-    "\u6ed7", "\u6eda", "\u6ede", "\u6edf", "\u6ee0", "\u6ee1", "\u6ee2",
-    "\u6ee4", "\u6ee5", "\u6ee6", "\u6ee8", "\u6ee9", "\u6eea", "\u6f46",
-    "\u6f47", "\u6f4b", "\u6f4d", "\u6f5c", "\u6f74", "\u6f9b", "\u6f9c",
-    "\u6fd1", "\u6fd2", "\u704f", "\u706d", "\u7075", "\u707f", "\u7080",
-    "\u7089", "\u709c", "\u709d", "\u70b9", "\u70bc", "\u70bd", "\u70c1",
-    "\u70c2", "\u70c3", "\u70db", "\u70e6", "\u70e7", "\u70e8", "\u70e9",
-    "\u70eb", "\u70ec", "\u70ed", "\u7115", "\u7116", "\u7118", "\u7174",
-    "\u7231", "\u7237", "\u724d", "\u7266", "\u7275", "\u727a", "\u728a",
-    "\u72b6", "\u72b7", "\u72b8", "\u72c8", "\u72dd", "\u72de", "\u72ec",
-    "\u72ed", "\u72ee", "\u72ef", "\u72f0", "\u72f1", "\u72f2", "\u7303",
-    "\u730e", "\u7315", "\u7321", "\u732c", "\u736d", "\u7391", "\u739a",
-    "\u739b", "\u73ae", "\u73b0", "\u73b1", "\u73ba", "\u73d0", "\u73d1",
-    "\u73f0", "\u73f2", "\u740f", "\u7410", "\u743c", "\u7476", "\u7477",
-    "\u748e", "\u74d2", "\u74ef", "\u7545", "\u7574", "\u7596", "\u7597",
-    "\u759f", "\u75a0", "\u75a1", "\u75ac", "\u75ad", "\u75ae", "\u75af",
-    "\u75c8", "\u75c9", "\u75d6", "\u75e8", "\u75ea", "\u75eb", "\u7605",
-    "\u7606", "\u7617", "\u7618", "\u762a", "\u762b", "\u763e", "\u763f",
-    "\u765e", "\u7663", "\u766b", "\u7691", "\u76b1", "\u76b2", "\u76cf",
-    "\u76d0", "\u76d1", "\u76d7", "\u76d8", "\u770d", "\u772c", "\u7741",
-    "\u7750", "\u7751", "\u7786", "\u7792", "\u77a9", "\u77eb", "\u77f6",
-    "\u77fe", "\u77ff", "\u7800", "\u7801", "\u7816", "\u7817", "\u781a",
-    "\u781c", "\u783a", "\u783b", "\u783e", "\u7840", "\u7841", "\u7855",
-    "\u7856", "\u7857", "\u7859", "\u785a", "\u7875", "\u7877", "\u789b",
-    "\u789c", "\u7943", "\u794e", "\u796f", "\u7977", "\u7978", "\u7984",
-    "\u7985", "\u79bb", "\u79c3", "\u79ef", "\u79fd", "\u79fe", "\u7a06",
-    "\u7a0e", "\u7a23", "\u7a33", "\u7a51", "\u7a77", "\u7a83", "\u7a8d",
-    "\u7a8e", "\u7a91", "\u7a9c", "\u7a9d", "\u7aa5", "\u7aa6", "\u7aad",
-    "\u7ad6", "\u7ade", "\u7b03", "\u7b15", "\u7b3a", "\u7b3c", "\u7b3e",
-    "\u7b5a", "\u7b5b", "\u7b5c", "\u7b5d", "\u7b79", "\u7b7c", "\u7b7e",
-    "\u7b80", "\u7b93", "\u7ba6", "\u7ba7", "\u7ba8", "\u7ba9", "\u7baa",
-    "\u7bab", "\u7bd1", "\u7bd3", "\u7bee", "\u7bef", "\u7bf1", "\u7c16",
-    "\u7c41", "\u7c74", "\u7c7b", "\u7c7c", "\u7c9d", "\u7ca4", "\u7caa",
-    "\u7cc1", "\u7cc7", "\u7d27", "\u7d77", "\u7e9f", "\u7ea0", "\u7ea1",
-    "\u7ea2", "\u7ea3", "\u7ea4", "\u7ea5", "\u7ea6", "\u7ea7", "\u7ea8",
-    "\u7ea9", "\u7eaa", "\u7eab", "\u7eac", "\u7ead", "\u7eae", "\u7eaf",
-    "\u7eb0", "\u7eb1", "\u7eb2", "\u7eb3", "\u7eb4", "\u7eb5", "\u7eb6",
-    "\u7eb7", "\u7eb8", "\u7eb9", "\u7eba", "\u7ebb", "\u7ebc", "\u7ebd",
-    "\u7ebe", "\u7ebf", "\u7ec0", "\u7ec1", "\u7ec2", "\u7ec3", "\u7ec4",
-    "\u7ec5", "\u7ec6", "\u7ec7", "\u7ec8", "\u7ec9", "\u7eca", "\u7ecb",
-    "\u7ecc", "\u7ecd", "\u7ece", "\u7ecf", "\u7ed0", "\u7ed1", "\u7ed2",
-    "\u7ed3", "\u7ed4", "\u7ed5", "\u7ed6", "\u7ed7", "\u7ed8", "\u7ed9",
-    "\u7eda", "\u7edb", "\u7edc", "\u7edd", "\u7ede", "\u7edf", "\u7ee0",
-    "\u7ee1", "\u7ee2", "\u7ee3", "\u7ee4", "\u7ee5", "\u7ee6", "\u7ee7",
-    "\u7ee8", "\u7ee9", "\u7eea", "\u7eeb", "\u7eec", "\u7eed", "\u7eee",
-    "\u7eef", "\u7ef0", "\u7ef1", "\u7ef2", "\u7ef3", "\u7ef4", "\u7ef5",
-    "\u7ef6", "\u7ef7", "\u7ef8", "\u7ef9", "\u7efa", "\u7efb", "\u7efc",
-    "\u7efd", "\u7efe", "\u7eff", "\u7f00", "\u7f01", "\u7f02", "\u7f03",
-    "\u7f04", "\u7f05", "\u7f06", "\u7f07", "\u7f08", "\u7f09", "\u7f0a",
-    "\u7f0b", "\u7f0c", "\u7f0d", "\u7f0e", "\u7f0f", "\u7f11", "\u7f12",
-    "\u7f13", "\u7f14", "\u7f15", "\u7f16", "\u7f17", "\u7f18", "\u7f19",
-    "\u7f1a", "\u7f1b", "\u7f1c", "\u7f1d", "\u7f1e", "\u7f1f", "\u7f20",
-    "\u7f21", "\u7f22", "\u7f23", "\u7f24", "\u7f25", "\u7f26", "\u7f27",
-    "\u7f28", "\u7f29", "\u7f2a", "\u7f2b", "\u7f2c", "\u7f2d", "\u7f2e",
-    "\u7f2f", "\u7f30", "\u7f31", "\u7f32", "\u7f33", "\u7f34", "\u7f35",
-    "\u7f42", "\u7f5a", "\u7f74", "\u7f81", "\u7f9f", "\u7fd8", "\u7fd9",
-    "\u7fda", "\u8022", "\u8027", "\u8038", "\u8042", "\u804b", "\u804c",
-    "\u804d", "\u8069", "\u806a", "\u8083", "\u80a0", "\u80a4", "\u80be",
-    "\u80bf", "\u80c0", "\u80c1", "\u80e7", "\u80e8", "\u80ea", "\u80eb",
-    "\u80f6", "\u810d", "\u810f", "\u8110", "\u8111", "\u8113", "\u8114",
-    "\u8131", "\u8136", "\u8138", "\u8158", "\u817b", "\u817d", "\u817e",
-    "\u8191", "\u81dc", "\u8206", "\u8223", "\u8230", "\u8231", "\u823b",
-    "\u8270", "\u8273", "\u827a", "\u8282", "\u8288", "\u8297", "\u829c",
-    "\u82c1", "\u82c7", "\u82c8", "\u82cb", "\u82cc", "\u82cd", "\u82ce",
-    "\u82cf", "\u82e7", "\u830e", "\u830f", "\u8311", "\u8314", "\u8315",
-    "\u8327", "\u8359", "\u835a", "\u835b", "\u835c", "\u835d", "\u835e",
-    "\u835f", "\u8360", "\u8361", "\u8364", "\u8365", "\u8366", "\u8367",
-    "\u8368", "\u8369", "\u836a", "\u836b", "\u836c", "\u836d", "\u836e",
-    "\u836f", "\u83b1", "\u83b2", "\u83b3", "\u83b4", "\u83b6", "\u83b7",
-    "\u83b8", "\u83b9", "\u83ba", "\u83bc", "\u841d", "\u8424", "\u8425",
-    "\u8426", "\u8427", "\u8428", "\u8487", "\u8489", "\u848b", "\u848c",
-    "\u84dd", "\u84df", "\u84e0", "\u84e3", "\u84e5", "\u84e6", "\u8537",
-    "\u8539", "\u853a", "\u853c", "\u8570", "\u8572", "\u8574", "\u85ae",
-    "\u85d3", "\u864f", "\u8651", "\u865a", "\u866e", "\u867d", "\u867e",
-    "\u867f", "\u8680", "\u8681", "\u8682", "\u8683", "\u86ac", "\u86ca",
-    "\u86ce", "\u86cf", "\u86f0", "\u86f1", "\u86f2", "\u86f3", "\u86f4",
-    "\u8715", "\u8717", "\u8747", "\u8748", "\u8749", "\u877c", "\u877e",
-    "\u8780", "\u87a8", "\u87cf", "\u8854", "\u8865", "\u886c", "\u8884",
-    "\u8885", "\u8886", "\u88ad", "\u88af", "\u88c5", "\u88c6", "\u88c8",
-    "\u88e2", "\u88e3", "\u88e4", "\u88e5", "\u891b", "\u8934", "\u8955",
-    "\u89c1", "\u89c2", "\u89c3", "\u89c4", "\u89c5", "\u89c6", "\u89c7",
-    "\u89c8", "\u89c9", "\u89ca", "\u89cb", "\u89cc", "\u89cd", "\u89ce",
-    "\u89cf", "\u89d0", "\u89d1", "\u89de", "\u89e6", "\u89ef", "\u8a1a",
-    "\u8a5f", "\u8a89", "\u8a8a", "\u8ba0", "\u8ba1", "\u8ba2", "\u8ba3",
-    "\u8ba4", "\u8ba5", "\u8ba6", "\u8ba7", "\u8ba8", "\u8ba9", "\u8baa",
-    "\u8bab", "\u8bac", "\u8bad", "\u8bae", "\u8baf", "\u8bb0", "\u8bb1",
-    "\u8bb2", "\u8bb3", "\u8bb4", "\u8bb5", "\u8bb6", "\u8bb7", "\u8bb8",
-    "\u8bb9", "\u8bba", "\u8bbb", "\u8bbc", "\u8bbd", "\u8bbe", "\u8bbf",
-    "\u8bc0", "\u8bc1", "\u8bc2", "\u8bc3", "\u8bc4", "\u8bc5", "\u8bc6",
-    "\u8bc7", "\u8bc8", "\u8bc9", "\u8bca", "\u8bcb", "\u8bcc", "\u8bcd",
-    "\u8bce", "\u8bcf", "\u8bd0", "\u8bd1", "\u8bd2", "\u8bd3", "\u8bd4",
-    "\u8bd5", "\u8bd6", "\u8bd7", "\u8bd8", "\u8bd9", "\u8bda", "\u8bdb",
-    "\u8bdc", "\u8bdd", "\u8bde", "\u8bdf", "\u8be0", "\u8be1", "\u8be2",
-    "\u8be3", "\u8be4", "\u8be5", "\u8be6", "\u8be7", "\u8be8", "\u8be9",
-    "\u8bea", "\u8beb", "\u8bec", "\u8bed", "\u8bee", "\u8bef", "\u8bf0",
-    "\u8bf1", "\u8bf2", "\u8bf3", "\u8bf4", "\u8bf5", "\u8bf6", "\u8bf7",
-    "\u8bf8", "\u8bf9", "\u8bfa", "\u8bfb", "\u8bfc", "\u8bfd", "\u8bfe",
-    "\u8bff", "\u8c00", "\u8c01", "\u8c02", "\u8c03", "\u8c04", "\u8c05",
-    "\u8c06", "\u8c07", "\u8c08", "\u8c0a", "\u8c0b", "\u8c0c", "\u8c0d",
-    "\u8c0e", "\u8c0f", "\u8c10", "\u8c11", "\u8c12", "\u8c13", "\u8c14",
-    "\u8c15", "\u8c16", "\u8c17", "\u8c18", "\u8c19", "\u8c1a", "\u8c1b",
-    "\u8c1c", "\u8c1d", "\u8c1e", "\u8c1f", "\u8c20", "\u8c21", "\u8c22",
-    "\u8c23", "\u8c24", "\u8c25", "\u8c26", "\u8c27", "\u8c28", "\u8c29",
-    "\u8c2a", "\u8c2b", "\u8c2c", "\u8c2d", "\u8c2e", "\u8c2f", "\u8c30",
-    "\u8c31", "\u8c32", "\u8c33", "\u8c34", "\u8c35", "\u8c36", "\u8c6e",
-    "\u8d1d", "\u8d1e", "\u8d1f", "\u8d20", "\u8d21", "\u8d22", "\u8d23",
-    "\u8d24", "\u8d25", "\u8d26", "\u8d27", "\u8d28", "\u8d29", "\u8d2a",
-    "\u8d2b", "\u8d2c", "\u8d2d", "\u8d2e", "\u8d2f", "\u8d30", "\u8d31",
-    "\u8d32", "\u8d33", "\u8d34", "\u8d35", "\u8d36", "\u8d37", "\u8d38",
-    "\u8d39", "\u8d3a", "\u8d3b", "\u8d3c", "\u8d3d", "\u8d3e", "\u8d3f",
-    "\u8d40", "\u8d41", "\u8d42", "\u8d43", "\u8d44", "\u8d45", "\u8d46",
-    "\u8d47", "\u8d48", "\u8d49", "\u8d4a", "\u8d4b", "\u8d4c", "\u8d4d",
-    "\u8d4e", "\u8d4f", "\u8d50", "\u8d51", "\u8d52", "\u8d53", "\u8d54",
-    "\u8d55", "\u8d56", "\u8d57", "\u8d58", "\u8d59", "\u8d5a", "\u8d5b",
-    "\u8d5c", "\u8d5d", "\u8d5e", "\u8d5f", "\u8d60", "\u8d61", "\u8d62",
-    "\u8d63", "\u8d6a", "\u8d75", "\u8d8b", "\u8db1", "\u8db8", "\u8dc3",
-    "\u8dc4", "\u8dde", "\u8df5", "\u8df6", "\u8df7", "\u8df8", "\u8df9",
-    "\u8dfb", "\u8e0c", "\u8e2c", "\u8e2f", "\u8e51", "\u8e52", "\u8e7f",
-    "\u8e8f", "\u8e9c", "\u8eaf", "\u8f66", "\u8f67", "\u8f68", "\u8f69",
-    "\u8f6a", "\u8f6b", "\u8f6c", "\u8f6d", "\u8f6e", "\u8f6f", "\u8f70",
-    "\u8f71", "\u8f72", "\u8f73", "\u8f74", "\u8f75", "\u8f76", "\u8f77",
-    "\u8f78", "\u8f79", "\u8f7a", "\u8f7b", "\u8f7c", "\u8f7d", "\u8f7e",
-    "\u8f7f", "\u8f80", "\u8f81", "\u8f82", "\u8f83", "\u8f84", "\u8f85",
-    "\u8f86", "\u8f87", "\u8f88", "\u8f89", "\u8f8a", "\u8f8b", "\u8f8c",
-    "\u8f8d", "\u8f8e", "\u8f8f", "\u8f90", "\u8f91", "\u8f92", "\u8f93",
-    "\u8f94", "\u8f95", "\u8f96", "\u8f97", "\u8f98", "\u8f99", "\u8f9a",
-    "\u8fa9", "\u8fab", "\u8fbd", "\u8fbe", "\u8fc8", "\u8fd0", "\u8fdb",
-    "\u8fdd", "\u8fde", "\u8fdf", "\u8ff3", "\u900a", "\u9026", "\u903b",
-    "\u9057", "\u9065", "\u9093", "\u909d", "\u90ac", "\u90ae", "\u90b9",
-    "\u90ba", "\u90bb", "\u90cf", "\u90d0", "\u90d1", "\u90d3", "\u90e6",
-    "\u90e7", "\u90f8", "\u9142", "\u915d", "\u9166", "\u9171", "\u917d",
-    "\u917e", "\u917f", "\u91ca", "\u9274", "\u92ae", "\u933e", "\u9485",
-    "\u9486", "\u9487", "\u9488", "\u9489", "\u948a", "\u948b", "\u948c",
-    "\u948d", "\u948e", "\u948f", "\u9490", "\u9491", "\u9492", "\u9493",
-    "\u9494", "\u9495", "\u9496", "\u9497", "\u9498", "\u9499", "\u949a",
-    "\u949b", "\u949c", "\u949d", "\u949e", "\u949f", "\u94a0", "\u94a1",
-    "\u94a2", "\u94a3", "\u94a4", "\u94a5", "\u94a6", "\u94a7", "\u94a8",
-    "\u94a9", "\u94aa", "\u94ab", "\u94ac", "\u94ad", "\u94ae", "\u94af",
-    "\u94b0", "\u94b1", "\u94b2", "\u94b3", "\u94b4", "\u94b5", "\u94b6",
-    "\u94b7", "\u94b8", "\u94b9", "\u94ba", "\u94bb", "\u94bc", "\u94bd",
-    "\u94be", "\u94bf", "\u94c0", "\u94c1", "\u94c2", "\u94c3", "\u94c4",
-    "\u94c5", "\u94c6", "\u94c7", "\u94c8", "\u94c9", "\u94ca", "\u94cb",
-    "\u94cc", "\u94cd", "\u94ce", "\u94cf", "\u94d0", "\u94d1", "\u94d2",
-    "\u94d3", "\u94d4", "\u94d5", "\u94d6", "\u94d7", "\u94d8", "\u94d9",
-    "\u94da", "\u94db", "\u94dc", "\u94dd", "\u94de", "\u94df", "\u94e0",
-    "\u94e1", "\u94e2", "\u94e3", "\u94e4", "\u94e5", "\u94e6", "\u94e7",
-    "\u94e8", "\u94e9", "\u94ea", "\u94eb", "\u94ec", "\u94ed", "\u94ee",
-    "\u94ef", "\u94f0", "\u94f1", "\u94f2", "\u94f3", "\u94f4", "\u94f5",
-    "\u94f6", "\u94f7", "\u94f8", "\u94f9", "\u94fa", "\u94fb", "\u94fc",
-    "\u94fd", "\u94fe", "\u94ff", "\u9500", "\u9501", "\u9502", "\u9503",
-    "\u9504", "\u9505", "\u9506", "\u9507", "\u9508", "\u9509", "\u950a",
-    "\u950b", "\u950c", "\u950d", "\u950e", "\u950f", "\u9510", "\u9511",
-    "\u9512", "\u9513", "\u9514", "\u9515", "\u9516", "\u9517", "\u9518",
-    "\u9519", "\u951a", "\u951b", "\u951c", "\u951d", "\u951e", "\u951f",
-    "\u9520", "\u9521", "\u9522", "\u9523", "\u9524", "\u9525", "\u9526",
-    "\u9527", "\u9528", "\u9529", "\u952a", "\u952b", "\u952c", "\u952d",
-    "\u952e", "\u952f", "\u9530", "\u9531", "\u9532", "\u9533", "\u9534",
-    "\u9535", "\u9536", "\u9537", "\u9538", "\u9539", "\u953a", "\u953b",
-    "\u953c", "\u953d", "\u953e", "\u953f", "\u9540", "\u9541", "\u9542",
-    "\u9543", "\u9544", "\u9545", "\u9546", "\u9547", "\u9548", "\u9549",
-    "\u954a", "\u954b", "\u954c", "\u954d", "\u954e", "\u954f", "\u9550",
-    "\u9551", "\u9552", "\u9553", "\u9554", "\u9555", "\u9556", "\u9557",
-    "\u9558", "\u9559", "\u955a", "\u955b", "\u955c", "\u955d", "\u955e",
-    "\u955f", "\u9560", "\u9561", "\u9562", "\u9563", "\u9564", "\u9565",
-    "\u9566", "\u9567", "\u9568", "\u9569", "\u956a", "\u956b", "\u956c",
-    "\u956d", "\u956e", "\u956f", "\u9570", "\u9571", "\u9572", "\u9573",
-    "\u9574", "\u9575", "\u9576", "\u957f", "\u95e8", "\u95e9", "\u95ea",
-    "\u95eb", "\u95ec", "\u95ed", "\u95ee", "\u95ef", "\u95f0", "\u95f1",
-    "\u95f2", "\u95f3", "\u95f4", "\u95f5", "\u95f6", "\u95f7", "\u95f8",
-    "\u95f9", "\u95fa", "\u95fb", "\u95fc", "\u95fd", "\u95fe", "\u95ff",
-    "\u9600", "\u9601", "\u9602", "\u9603", "\u9604", "\u9605", "\u9606",
-    "\u9607", "\u9608", "\u9609", "\u960a", "\u960b", "\u960c", "\u960d",
-    "\u960e", "\u960f", "\u9610", "\u9611", "\u9612", "\u9613", "\u9614",
-    "\u9615", "\u9616", "\u9617", "\u9618", "\u9619", "\u961a", "\u961b",
-    "\u961f", "\u9633", "\u9634", "\u9635", "\u9636", "\u9645", "\u9646",
-    "\u9647", "\u9648", "\u9649", "\u9655", "\u9667", "\u9668", "\u9669",
-    "\u968f", "\u96cf", "\u96e0", "\u96f3", "\u96fe", "\u9701", "\u9721",
-    "\u972d", "\u9753", "\u9765", "\u9791", "\u9792", "\u97af", "\u97e6",
-    "\u97e7", "\u97e8", "\u97e9", "\u97ea", "\u97eb", "\u97ec", "\u9875",
-    "\u9876", "\u9877", "\u9878", "\u9879", "\u987a", "\u987b", "\u987c",
-    "\u987d", "\u987e", "\u987f", "\u9880", "\u9881", "\u9882", "\u9883",
-    "\u9884", "\u9885", "\u9886", "\u9887", "\u9888", "\u9889", "\u988a",
-    "\u988b", "\u988c", "\u988d", "\u988e", "\u988f", "\u9890", "\u9891",
-    "\u9892", "\u9893", "\u9894", "\u9895", "\u9896", "\u9897", "\u9898",
-    "\u9899", "\u989a", "\u989b", "\u989c", "\u989d", "\u989e", "\u989f",
-    "\u98a0", "\u98a1", "\u98a2", "\u98a3", "\u98a4", "\u98a5", "\u98a6",
-    "\u98a7", "\u98ce", "\u98cf", "\u98d0", "\u98d1", "\u98d2", "\u98d3",
-    "\u98d4", "\u98d5", "\u98d6", "\u98d7", "\u98d8", "\u98d9", "\u98da",
-    "\u98de", "\u98e8", "\u990d", "\u9963", "\u9964", "\u9965", "\u9966",
-    "\u9967", "\u9968", "\u9969", "\u996a", "\u996b", "\u996c", "\u996d",
-    "\u996e", "\u996f", "\u9970", "\u9971", "\u9972", "\u9973", "\u9974",
-    "\u9975", "\u9976", "\u9977", "\u9978", "\u9979", "\u997a", "\u997b",
-    "\u997c", "\u997d", "\u997e", "\u997f", "\u9980", "\u9981", "\u9982",
-    "\u9983", "\u9984", "\u9985", "\u9986", "\u9987", "\u9988", "\u9989",
-    "\u998a", "\u998b", "\u998c", "\u998d", "\u998e", "\u998f", "\u9990",
-    "\u9991", "\u9992", "\u9993", "\u9994", "\u9995", "\u9a6c", "\u9a6d",
-    "\u9a6e", "\u9a6f", "\u9a70", "\u9a71", "\u9a72", "\u9a73", "\u9a74",
-    "\u9a75", "\u9a76", "\u9a77", "\u9a78", "\u9a79", "\u9a7a", "\u9a7b",
-    "\u9a7c", "\u9a7d", "\u9a7e", "\u9a7f", "\u9a80", "\u9a81", "\u9a82",
-    "\u9a83", "\u9a84", "\u9a85", "\u9a86", "\u9a87", "\u9a88", "\u9a89",
-    "\u9a8a", "\u9a8b", "\u9a8c", "\u9a8d", "\u9a8e", "\u9a8f", "\u9a90",
-    "\u9a91", "\u9a92", "\u9a93", "\u9a94", "\u9a95", "\u9a96", "\u9a97",
-    "\u9a98", "\u9a99", "\u9a9a", "\u9a9b", "\u9a9c", "\u9a9d", "\u9a9e",
-    "\u9a9f", "\u9aa0", "\u9aa1", "\u9aa2", "\u9aa3", "\u9aa4", "\u9aa5",
-    "\u9aa6", "\u9aa7", "\u9ac5", "\u9acb", "\u9acc", "\u9b13", "\u9b47",
-    "\u9b49", "\u9c7c", "\u9c7d", "\u9c7e", "\u9c7f", "\u9c80", "\u9c81",
-    "\u9c82", "\u9c83", "\u9c84", "\u9c85", "\u9c86", "\u9c88", "\u9c89",
-    "\u9c8a", "\u9c8b", "\u9c8c", "\u9c8d", "\u9c8e", "\u9c8f", "\u9c90",
-    "\u9c91", "\u9c92", "\u9c93", "\u9c94", "\u9c95", "\u9c96", "\u9c97",
-    "\u9c98", "\u9c99", "\u9c9a", "\u9c9b", "\u9c9c", "\u9c9d", "\u9c9e",
-    "\u9c9f", "\u9ca0", "\u9ca1", "\u9ca2", "\u9ca3", "\u9ca4", "\u9ca5",
-    "\u9ca6", "\u9ca7", "\u9ca8", "\u9ca9", "\u9caa", "\u9cab", "\u9cac",
-    "\u9cad", "\u9cae", "\u9caf", "\u9cb0", "\u9cb1", "\u9cb2", "\u9cb3",
-    "\u9cb4", "\u9cb5", "\u9cb7", "\u9cb8", "\u9cb9", "\u9cba", "\u9cbb",
-    "\u9cbc", "\u9cbd", "\u9cbe", "\u9cbf", "\u9cc0", "\u9cc1", "\u9cc2",
-    "\u9cc3", "\u9cc4", "\u9cc5", "\u9cc6", "\u9cc7", "\u9cc8", "\u9cc9",
-    "\u9cca", "\u9ccb", "\u9ccc", "\u9ccd", "\u9cce", "\u9ccf", "\u9cd0",
-    "\u9cd1", "\u9cd2", "\u9cd3", "\u9cd4", "\u9cd5", "\u9cd6", "\u9cd7",
-    "\u9cd8", "\u9cd9", "\u9cda", "\u9cdb", "\u9cdc", "\u9cdd", "\u9cde",
-    "\u9cdf", "\u9ce0", "\u9ce1", "\u9ce2", "\u9ce3", "\u9e1f", "\u9e20",
-    "\u9e21", "\u9e22", "\u9e23", "\u9e24", "\u9e25", "\u9e26", "\u9e27",
-    "\u9e28", "\u9e29", "\u9e2a", "\u9e2b", "\u9e2c", "\u9e2d", "\u9e2e",
-    "\u9e2f", "\u9e30", "\u9e31", "\u9e32", "\u9e33", "\u9e34", "\u9e35",
-    "\u9e36", "\u9e37", "\u9e38", "\u9e39", "\u9e3a", "\u9e3b", "\u9e3c",
-    "\u9e3d", "\u9e3e", "\u9e3f", "\u9e40", "\u9e41", "\u9e42", "\u9e43",
-    "\u9e44", "\u9e45", "\u9e46", "\u9e47", "\u9e48", "\u9e49", "\u9e4a",
-    "\u9e4b", "\u9e4c", "\u9e4d", "\u9e4e", "\u9e4f", "\u9e50", "\u9e51",
-    "\u9e52", "\u9e53", "\u9e54", "\u9e55", "\u9e56", "\u9e57", "\u9e58",
-    "\u9e59", "\u9e5a", "\u9e5b", "\u9e5c", "\u9e5d", "\u9e5e", "\u9e5f",
-    "\u9e60", "\u9e61", "\u9e62", "\u9e63", "\u9e64", "\u9e65", "\u9e66",
-    "\u9e67", "\u9e68", "\u9e69", "\u9e6a", "\u9e6b", "\u9e6c", "\u9e6d",
-    "\u9e6e", "\u9e6f", "\u9e70", "\u9e71", "\u9e72", "\u9e73", "\u9e74",
-    "\u9e7e", "\u9eb8", "\u9ec9", "\u9ee1", "\u9ee9", "\u9eea", "\u9f0b",
-    "\u9f0d", "\u9f50", "\u9f51", "\u9f7f", "\u9f80", "\u9f81", "\u9f82",
-    "\u9f83", "\u9f84", "\u9f85", "\u9f86", "\u9f87", "\u9f88", "\u9f89",
-    "\u9f8a", "\u9f8b", "\u9f8c", "\u9f99", "\u9f9a", "\u9f9b", "\u9f9f",
+constexpr char16_t SIMPLIFIED_CHINESE_CHARS[] = {
+    u'\u343d', u'\u3447', u'\u3448', u'\u3454', u'\u3469', u'\u34e5', u'\u3509',
+    u'\u358a', u'\u359e', u'\u360e', u'\u36af', u'\u36c0', u'\u36df', u'\u36e0',
+    u'\u36e3', u'\u36e4', u'\u36ff', u'\u37c6', u'\u37dc', u'\u3918', u'\u39cf',
+    u'\u39d0', u'\u39d1', u'\u39df', u'\u39f0', u'\u3a2b', u'\u3b4e', u'\u3b4f',
+    u'\u3b63', u'\u3b64', u'\u3b74', u'\u3c69', u'\u3c6e', u'\u3cbf', u'\u3cd4',
+    u'\u3cd5', u'\u3ce0', u'\u3ce1', u'\u3ce2', u'\u3d89', u'\u3db6', u'\u3dbd',
+    u'\u3e8d', u'\u3ec5', u'\u3ecf', u'\u3ed8', u'\u4025', u'\u4056', u'\u40b5',
+    u'\u4149', u'\u416a', u'\u41f2', u'\u4264', u'\u4336', u'\u4337', u'\u4338',
+    u'\u4339', u'\u433a', u'\u433b', u'\u433c', u'\u433d', u'\u433e', u'\u4340',
+    u'\u4341', u'\u44d5', u'\u45d6', u'\u461b', u'\u461e', u'\u464a', u'\u464c',
+    u'\u4653', u'\u4723', u'\u4725', u'\u4727', u'\u4729', u'\u4759', u'\u478c',
+    u'\u478d', u'\u478e', u'\u4790', u'\u47e2', u'\u4880', u'\u4881', u'\u4882',
+    u'\u497a', u'\u497d', u'\u497e', u'\u497f', u'\u4980', u'\u4981', u'\u4982',
+    u'\u4983', u'\u4985', u'\u49b6', u'\u49b7', u'\u4b6a', u'\u4bc3', u'\u4bc4',
+    u'\u4bc5', u'\u4c9d', u'\u4c9e', u'\u4c9f', u'\u4ca0', u'\u4ca1', u'\u4ca2',
+    u'\u4ca3', u'\u4d13', u'\u4d14', u'\u4d15', u'\u4d16', u'\u4d17', u'\u4d18',
+    u'\u4d19', u'\u4dae', u'\u4e0e', u'\u4e13', u'\u4e1a', u'\u4e1b', u'\u4e1c',
+    u'\u4e1d', u'\u4e25', u'\u4e27', u'\u4e34', u'\u4e3a', u'\u4e3d', u'\u4e3e',
+    u'\u4e4c', u'\u4e54', u'\u4e60', u'\u4e61', u'\u4e66', u'\u4e70', u'\u4e9a',
+    u'\u4ea7', u'\u4ea9', u'\u4eb2', u'\u4eb5', u'\u4eb8', u'\u4ebf', u'\u4ed1',
+    u'\u4ed3', u'\u4eec', u'\u4f1b', u'\u4f1e', u'\u4f1f', u'\u4f20', u'\u4f21',
+    u'\u4f23', u'\u4f24', u'\u4f25', u'\u4f26', u'\u4f27', u'\u4f2a', u'\u4f2b',
+    u'\u4f65', u'\u4fa0', u'\u4fa3', u'\u4fa5', u'\u4fa6', u'\u4fa7', u'\u4fa8',
+    u'\u4faa', u'\u4fac', u'\u4fe3', u'\u4fe6', u'\u4fe8', u'\u4fe9', u'\u4fea',
+    u'\u4feb', u'\u4fed', u'\u503a', u'\u503e', u'\u507b', u'\u507e', u'\u507f',
+    u'\u50a5', u'\u50a7', u'\u50a8', u'\u50a9', u'\u5156', u'\u5170', u'\u5173',
+    u'\u5174', u'\u5179', u'\u517b', u'\u517d', u'\u5181', u'\u5188', u'\u5199',
+    u'\u519b', u'\u519c', u'\u51af', u'\u51b3', u'\u51bb', u'\u51c0', u'\u51db',
+    u'\u51eb', u'\u51ef', u'\u51fb', u'\u51ff', u'\u520d', u'\u5219', u'\u521a',
+    u'\u521b', u'\u522c', u'\u522d', u'\u523d', u'\u523e', u'\u523f', u'\u5240',
+    u'\u5242', u'\u5250', u'\u5251', u'\u5265', u'\u5267', u'\u529d', u'\u52a1',
+    u'\u52a2', u'\u52a8', u'\u52b1', u'\u52b2', u'\u52cb', u'\u52da', u'\u5326',
+    u'\u532e', u'\u533a', u'\u534e', u'\u534f', u'\u5356', u'\u5362', u'\u5364',
+    u'\u536b', u'\u5374', u'\u5385', u'\u5386', u'\u5389', u'\u538b', u'\u538c',
+    u'\u538d', u'\u5390', u'\u5395', u'\u53a2', u'\u53a3', u'\u53bf', u'\u53c1',
+    u'\u53d1', u'\u53d8', u'\u53f9', u'\u53fd', u'\u5415', u'\u5417', u'\u5423',
+    u'\u5428', u'\u542f', u'\u5450', u'\u5452', u'\u5453', u'\u5455', u'\u5456',
+    u'\u5457', u'\u5458', u'\u5459', u'\u545b', u'\u545c', u'\u5499', u'\u549b',
+    u'\u549d', u'\u54d1', u'\u54d2', u'\u54d3', u'\u54d4', u'\u54d5', u'\u54d7',
+    u'\u54d9', u'\u54dc', u'\u54dd', u'\u54df', u'\u551b', u'\u551d', u'\u5520',
+    u'\u5521', u'\u5522', u'\u5524', u'\u5567', u'\u556c', u'\u556d', u'\u556e',
+    u'\u556f', u'\u5570', u'\u5574', u'\u5578', u'\u55b7', u'\u55be', u'\u55bd',
+    u'\u55eb', u'\u55f3', u'\u5618', u'\u5624', u'\u565c', u'\u56a3', u'\u56e2',
+    u'\u56f1', u'\u56f4', u'\u56f5', u'\u56fd', u'\u56fe', u'\u5706', u'\u5723',
+    u'\u5739', u'\u573a', u'\u5757', u'\u575a', u'\u575b', u'\u575c', u'\u575d',
+    u'\u575e', u'\u575f', u'\u5760', u'\u5784', u'\u5785', u'\u5786', u'\u5792',
+    u'\u57a6', u'\u57a9', u'\u57ab', u'\u57ad', u'\u57b1', u'\u57b2', u'\u57b4',
+    u'\u57d8', u'\u57d9', u'\u57da', u'\u57ef', u'\u5811', u'\u5899', u'\u58f6',
+    u'\u58f8', u'\u5904', u'\u5907', u'\u5934', u'\u5939', u'\u593a', u'\u5941',
+    u'\u5942', u'\u594b', u'\u5956', u'\u5965', u'\u5986', u'\u5987', u'\u5988',
+    u'\u59a9', u'\u59aa', u'\u59ab', u'\u5a04', u'\u5a05', u'\u5a06', u'\u5a07',
+    u'\u5a08', u'\u5a32', u'\u5a34', u'\u5a73', u'\u5a74', u'\u5a75', u'\u5a76',
+    u'\u5aaa', u'\u5ad2', u'\u5ad4', u'\u5af1', u'\u5b37', u'\u5b59', u'\u5b66',
+    u'\u5b6a', u'\u5ba0', u'\u5ba1', u'\u5baa', u'\u5bab', u'\u5bbd', u'\u5bbe',
+    u'\u5bdd', u'\u5bfb', u'\u5bfc', u'\u5c06', u'\u5c18', u'\u5c1d', u'\u5c27',
+    u'\u5c34', u'\u5c42', u'\u5c43', u'\u5c49', u'\u5c61', u'\u5c66', u'\u5c7f',
+    u'\u5c81', u'\u5c82', u'\u5c96', u'\u5c97', u'\u5c98', u'\u5c99', u'\u5c9a',
+    u'\u5c9b', u'\u5cad', u'\u5cbd', u'\u5cbf', u'\u5cc4', u'\u5ce1', u'\u5ce3',
+    u'\u5ce4', u'\u5ce5', u'\u5c36', u'\u5d02', u'\u5d03', u'\u5d04', u'\u5d2d',
+    u'\u5d58', u'\u5d5a', u'\u5d5d', u'\u5dc5', u'\u5de9', u'\u5def', u'\u5e01',
+    u'\u5e05', u'\u5e08', u'\u5e0f', u'\u5e10', u'\u5e1c', u'\u5e26', u'\u5e27',
+    u'\u5e2e', u'\u5e31', u'\u5e3b', u'\u5e3c', u'\u5e86', u'\u5e90', u'\u5e91',
+    u'\u5e93', u'\u5e9e', u'\u5e9f', u'\u5eea', u'\u5f02', u'\u5f11', u'\u5f20',
+    u'\u5f25', u'\u5f2a', u'\u5f2f', u'\u5f55', u'\u5f5d', u'\u5f68', u'\u5f7b',
+    u'\u5f84', u'\u5f95', u'\u5fc6', u'\u5fcf', u'\u5fe7', u'\u5ffe', u'\u6001',
+    u'\u6002', u'\u6003', u'\u6004', u'\u6005', u'\u6006', u'\u603b', u'\u603c',
+    u'\u603f', u'\u6073', u'\u6076', u'\u6078', u'\u6079', u'\u607a', u'\u607b',
+    u'\u607c', u'\u607d', u'\u60a6', u'\u60ab', u'\u60ac', u'\u60ad', u'\u60ae',
+    u'\u60af', u'\u60ca', u'\u60e8', u'\u60e9', u'\u60eb', u'\u60ec', u'\u60ed',
+    u'\u60ee', u'\u60ef', u'\u6124', u'\u6126', u'\u6151', u'\u61d1', u'\u61d2',
+    u'\u61d4', u'\u6206', u'\u620b', u'\u620f', u'\u6217', u'\u6218', u'\u622c',
+    u'\u622f', u'\u6269', u'\u626a', u'\u626b', u'\u626c', u'\u6270', u'\u629a',
+    u'\u629f', u'\u62a0', u'\u62a1', u'\u62a2', u'\u62a4', u'\u62df', u'\u62e2',
+    u'\u62e3', u'\u62e5', u'\u62e6', u'\u62e7', u'\u62e8', u'\u62e9', u'\u631a',
+    u'\u631b', u'\u631c', u'\u631d', u'\u631e', u'\u631f', u'\u6320', u'\u6321',
+    u'\u6322', u'\u6323', u'\u6324', u'\u6325', u'\u6326', u'\u635d', u'\u635e',
+    u'\u635f', u'\u6361', u'\u6362', u'\u6363', u'\u63b3', u'\u63b4', u'\u63b7',
+    u'\u63b8', u'\u63ba', u'\u63bc', u'\u63fd', u'\u63ff', u'\u6400', u'\u6401',
+    u'\u6402', u'\u6405', u'\u6444', u'\u6445', u'\u6446', u'\u6447', u'\u6448',
+    u'\u644a', u'\u6484', u'\u64b5', u'\u64b7', u'\u64b8', u'\u64ba', u'\u64de',
+    u'\u6512', u'\u654c', u'\u655b', u'\u6569', u'\u6593', u'\u65a9', u'\u65e7',
+    u'\u65f7', u'\u65f8', u'\u6619', u'\u663c', u'\u663d', u'\u663e', u'\u6653',
+    u'\u6654', u'\u6655', u'\u6656', u'\u6682', u'\u66a7', u'\u6740', u'\u6742',
+    u'\u6743', u'\u6761', u'\u6765', u'\u6768', u'\u6769', u'\u679e', u'\u67a2',
+    u'\u67a3', u'\u67a5', u'\u67a7', u'\u67a8', u'\u67aa', u'\u67ab', u'\u67ad',
+    u'\u67e0', u'\u67fd', u'\u6800', u'\u6805', u'\u6807', u'\u6808', u'\u6809',
+    u'\u680a', u'\u680b', u'\u680c', u'\u680e', u'\u680f', u'\u6811', u'\u6837',
+    u'\u6860', u'\u6861', u'\u6862', u'\u6863', u'\u6864', u'\u6865', u'\u6866',
+    u'\u6867', u'\u6868', u'\u6869', u'\u68bc', u'\u68be', u'\u68bf', u'\u68c0',
+    u'\u68c1', u'\u68c2', u'\u6901', u'\u691f', u'\u6920', u'\u6922', u'\u6924',
+    u'\u692b', u'\u692d', u'\u697c', u'\u6984', u'\u6985', u'\u6987', u'\u6988',
+    u'\u6989', u'\u69da', u'\u69db', u'\u69df', u'\u69e0', u'\u6a2a', u'\u6a2f',
+    u'\u6a31', u'\u6a65', u'\u6a71', u'\u6a79', u'\u6a7c', u'\u6aa9', u'\u6b24',
+    u'\u6b27', u'\u6b7c', u'\u6b81', u'\u6b87', u'\u6b8b', u'\u6b92', u'\u6b93',
+    u'\u6b9a', u'\u6ba1', u'\u6bb4', u'\u6bc1', u'\u6bc2', u'\u6bd5', u'\u6bd9',
+    u'\u6bf5', u'\u6caa', u'\u6c07', u'\u6c22', u'\u6c29', u'\u6c32', u'\u6c47',
+    u'\u6c49', u'\u6c64', u'\u6c9f', u'\u6ca3', u'\u6ca4', u'\u6ca5', u'\u6ca6',
+    u'\u6ca7', u'\u6ca8', u'\u6ca9', u'\u6cde', u'\u6cf6', u'\u6cf7', u'\u6cf8',
+    u'\u6cfa', u'\u6cfb', u'\u6cfc', u'\u6cfd', u'\u6cfe', u'\u6d01', u'\u6d43',
+    u'\u6d45', u'\u6d46', u'\u6d47', u'\u6d48', u'\u6d4a', u'\u6d4b', u'\u6d4d',
+    u'\u6d4e', u'\u6d4f', u'\u6d50', u'\u6d51', u'\u6d52', u'\u6d53', u'\u6d54',
+    u'\u6d55', u'\u6d9b', u'\u6d9d', u'\u6d9e', u'\u6d9f', u'\u6da0', u'\u6da1',
+    u'\u6da2', u'\u6da3', u'\u6da4', u'\u6da6', u'\u6da7', u'\u6da8', u'\u6da9',
+    u'\u6e0a', u'\u6e0c', u'\u6e0d', u'\u6e0e', u'\u6e10', u'\u6e11', u'\u6e14',
+    u'\u6e17', u'\u6e7e', u'\u6e7f', u'\u6e83', u'\u6e85', u'\u6e86', u'\u6e87',
+    u'\u6ed7', u'\u6eda', u'\u6ede', u'\u6edf', u'\u6ee0', u'\u6ee1', u'\u6ee2',
+    u'\u6ee4', u'\u6ee5', u'\u6ee6', u'\u6ee8', u'\u6ee9', u'\u6eea', u'\u6f46',
+    u'\u6f47', u'\u6f4b', u'\u6f4d', u'\u6f5c', u'\u6f74', u'\u6f9b', u'\u6f9c',
+    u'\u6fd1', u'\u6fd2', u'\u704f', u'\u706d', u'\u7075', u'\u707f', u'\u7080',
+    u'\u7089', u'\u709c', u'\u709d', u'\u70b9', u'\u70bc', u'\u70bd', u'\u70c1',
+    u'\u70c2', u'\u70c3', u'\u70db', u'\u70e6', u'\u70e7', u'\u70e8', u'\u70e9',
+    u'\u70eb', u'\u70ec', u'\u70ed', u'\u7115', u'\u7116', u'\u7118', u'\u7174',
+    u'\u7231', u'\u7237', u'\u724d', u'\u7266', u'\u7275', u'\u727a', u'\u728a',
+    u'\u72b6', u'\u72b7', u'\u72b8', u'\u72c8', u'\u72dd', u'\u72de', u'\u72ec',
+    u'\u72ed', u'\u72ee', u'\u72ef', u'\u72f0', u'\u72f1', u'\u72f2', u'\u7303',
+    u'\u730e', u'\u7315', u'\u7321', u'\u732c', u'\u736d', u'\u7391', u'\u739a',
+    u'\u739b', u'\u73ae', u'\u73b0', u'\u73b1', u'\u73ba', u'\u73d0', u'\u73d1',
+    u'\u73f0', u'\u73f2', u'\u740f', u'\u7410', u'\u743c', u'\u7476', u'\u7477',
+    u'\u748e', u'\u74d2', u'\u74ef', u'\u7545', u'\u7574', u'\u7596', u'\u7597',
+    u'\u759f', u'\u75a0', u'\u75a1', u'\u75ac', u'\u75ad', u'\u75ae', u'\u75af',
+    u'\u75c8', u'\u75c9', u'\u75d6', u'\u75e8', u'\u75ea', u'\u75eb', u'\u7605',
+    u'\u7606', u'\u7617', u'\u7618', u'\u762a', u'\u762b', u'\u763e', u'\u763f',
+    u'\u765e', u'\u7663', u'\u766b', u'\u7691', u'\u76b1', u'\u76b2', u'\u76cf',
+    u'\u76d0', u'\u76d1', u'\u76d7', u'\u76d8', u'\u770d', u'\u772c', u'\u7741',
+    u'\u7750', u'\u7751', u'\u7786', u'\u7792', u'\u77a9', u'\u77eb', u'\u77f6',
+    u'\u77fe', u'\u77ff', u'\u7800', u'\u7801', u'\u7816', u'\u7817', u'\u781a',
+    u'\u781c', u'\u783a', u'\u783b', u'\u783e', u'\u7840', u'\u7841', u'\u7855',
+    u'\u7856', u'\u7857', u'\u7859', u'\u785a', u'\u7875', u'\u7877', u'\u789b',
+    u'\u789c', u'\u7943', u'\u794e', u'\u796f', u'\u7977', u'\u7978', u'\u7984',
+    u'\u7985', u'\u79bb', u'\u79c3', u'\u79ef', u'\u79fd', u'\u79fe', u'\u7a06',
+    u'\u7a0e', u'\u7a23', u'\u7a33', u'\u7a51', u'\u7a77', u'\u7a83', u'\u7a8d',
+    u'\u7a8e', u'\u7a91', u'\u7a9c', u'\u7a9d', u'\u7aa5', u'\u7aa6', u'\u7aad',
+    u'\u7ad6', u'\u7ade', u'\u7b03', u'\u7b15', u'\u7b3a', u'\u7b3c', u'\u7b3e',
+    u'\u7b5a', u'\u7b5b', u'\u7b5c', u'\u7b5d', u'\u7b79', u'\u7b7c', u'\u7b7e',
+    u'\u7b80', u'\u7b93', u'\u7ba6', u'\u7ba7', u'\u7ba8', u'\u7ba9', u'\u7baa',
+    u'\u7bab', u'\u7bd1', u'\u7bd3', u'\u7bee', u'\u7bef', u'\u7bf1', u'\u7c16',
+    u'\u7c41', u'\u7c74', u'\u7c7b', u'\u7c7c', u'\u7c9d', u'\u7ca4', u'\u7caa',
+    u'\u7cc1', u'\u7cc7', u'\u7d27', u'\u7d77', u'\u7e9f', u'\u7ea0', u'\u7ea1',
+    u'\u7ea2', u'\u7ea3', u'\u7ea4', u'\u7ea5', u'\u7ea6', u'\u7ea7', u'\u7ea8',
+    u'\u7ea9', u'\u7eaa', u'\u7eab', u'\u7eac', u'\u7ead', u'\u7eae', u'\u7eaf',
+    u'\u7eb0', u'\u7eb1', u'\u7eb2', u'\u7eb3', u'\u7eb4', u'\u7eb5', u'\u7eb6',
+    u'\u7eb7', u'\u7eb8', u'\u7eb9', u'\u7eba', u'\u7ebb', u'\u7ebc', u'\u7ebd',
+    u'\u7ebe', u'\u7ebf', u'\u7ec0', u'\u7ec1', u'\u7ec2', u'\u7ec3', u'\u7ec4',
+    u'\u7ec5', u'\u7ec6', u'\u7ec7', u'\u7ec8', u'\u7ec9', u'\u7eca', u'\u7ecb',
+    u'\u7ecc', u'\u7ecd', u'\u7ece', u'\u7ecf', u'\u7ed0', u'\u7ed1', u'\u7ed2',
+    u'\u7ed3', u'\u7ed4', u'\u7ed5', u'\u7ed6', u'\u7ed7', u'\u7ed8', u'\u7ed9',
+    u'\u7eda', u'\u7edb', u'\u7edc', u'\u7edd', u'\u7ede', u'\u7edf', u'\u7ee0',
+    u'\u7ee1', u'\u7ee2', u'\u7ee3', u'\u7ee4', u'\u7ee5', u'\u7ee6', u'\u7ee7',
+    u'\u7ee8', u'\u7ee9', u'\u7eea', u'\u7eeb', u'\u7eec', u'\u7eed', u'\u7eee',
+    u'\u7eef', u'\u7ef0', u'\u7ef1', u'\u7ef2', u'\u7ef3', u'\u7ef4', u'\u7ef5',
+    u'\u7ef6', u'\u7ef7', u'\u7ef8', u'\u7ef9', u'\u7efa', u'\u7efb', u'\u7efc',
+    u'\u7efd', u'\u7efe', u'\u7eff', u'\u7f00', u'\u7f01', u'\u7f02', u'\u7f03',
+    u'\u7f04', u'\u7f05', u'\u7f06', u'\u7f07', u'\u7f08', u'\u7f09', u'\u7f0a',
+    u'\u7f0b', u'\u7f0c', u'\u7f0d', u'\u7f0e', u'\u7f0f', u'\u7f11', u'\u7f12',
+    u'\u7f13', u'\u7f14', u'\u7f15', u'\u7f16', u'\u7f17', u'\u7f18', u'\u7f19',
+    u'\u7f1a', u'\u7f1b', u'\u7f1c', u'\u7f1d', u'\u7f1e', u'\u7f1f', u'\u7f20',
+    u'\u7f21', u'\u7f22', u'\u7f23', u'\u7f24', u'\u7f25', u'\u7f26', u'\u7f27',
+    u'\u7f28', u'\u7f29', u'\u7f2a', u'\u7f2b', u'\u7f2c', u'\u7f2d', u'\u7f2e',
+    u'\u7f2f', u'\u7f30', u'\u7f31', u'\u7f32', u'\u7f33', u'\u7f34', u'\u7f35',
+    u'\u7f42', u'\u7f5a', u'\u7f74', u'\u7f81', u'\u7f9f', u'\u7fd8', u'\u7fd9',
+    u'\u7fda', u'\u8022', u'\u8027', u'\u8038', u'\u8042', u'\u804b', u'\u804c',
+    u'\u804d', u'\u8069', u'\u806a', u'\u8083', u'\u80a0', u'\u80a4', u'\u80be',
+    u'\u80bf', u'\u80c0', u'\u80c1', u'\u80e7', u'\u80e8', u'\u80ea', u'\u80eb',
+    u'\u80f6', u'\u810d', u'\u810f', u'\u8110', u'\u8111', u'\u8113', u'\u8114',
+    u'\u8131', u'\u8136', u'\u8138', u'\u8158', u'\u817b', u'\u817d', u'\u817e',
+    u'\u8191', u'\u81dc', u'\u8206', u'\u8223', u'\u8230', u'\u8231', u'\u823b',
+    u'\u8270', u'\u8273', u'\u827a', u'\u8282', u'\u8288', u'\u8297', u'\u829c',
+    u'\u82c1', u'\u82c7', u'\u82c8', u'\u82cb', u'\u82cc', u'\u82cd', u'\u82ce',
+    u'\u82cf', u'\u82e7', u'\u830e', u'\u830f', u'\u8311', u'\u8314', u'\u8315',
+    u'\u8327', u'\u8359', u'\u835a', u'\u835b', u'\u835c', u'\u835d', u'\u835e',
+    u'\u835f', u'\u8360', u'\u8361', u'\u8364', u'\u8365', u'\u8366', u'\u8367',
+    u'\u8368', u'\u8369', u'\u836a', u'\u836b', u'\u836c', u'\u836d', u'\u836e',
+    u'\u836f', u'\u83b1', u'\u83b2', u'\u83b3', u'\u83b4', u'\u83b6', u'\u83b7',
+    u'\u83b8', u'\u83b9', u'\u83ba', u'\u83bc', u'\u841d', u'\u8424', u'\u8425',
+    u'\u8426', u'\u8427', u'\u8428', u'\u8487', u'\u8489', u'\u848b', u'\u848c',
+    u'\u84dd', u'\u84df', u'\u84e0', u'\u84e3', u'\u84e5', u'\u84e6', u'\u8537',
+    u'\u8539', u'\u853a', u'\u853c', u'\u8570', u'\u8572', u'\u8574', u'\u85ae',
+    u'\u85d3', u'\u864f', u'\u8651', u'\u865a', u'\u866e', u'\u867d', u'\u867e',
+    u'\u867f', u'\u8680', u'\u8681', u'\u8682', u'\u8683', u'\u86ac', u'\u86ca',
+    u'\u86ce', u'\u86cf', u'\u86f0', u'\u86f1', u'\u86f2', u'\u86f3', u'\u86f4',
+    u'\u8715', u'\u8717', u'\u8747', u'\u8748', u'\u8749', u'\u877c', u'\u877e',
+    u'\u8780', u'\u87a8', u'\u87cf', u'\u8854', u'\u8865', u'\u886c', u'\u8884',
+    u'\u8885', u'\u8886', u'\u88ad', u'\u88af', u'\u88c5', u'\u88c6', u'\u88c8',
+    u'\u88e2', u'\u88e3', u'\u88e4', u'\u88e5', u'\u891b', u'\u8934', u'\u8955',
+    u'\u89c1', u'\u89c2', u'\u89c3', u'\u89c4', u'\u89c5', u'\u89c6', u'\u89c7',
+    u'\u89c8', u'\u89c9', u'\u89ca', u'\u89cb', u'\u89cc', u'\u89cd', u'\u89ce',
+    u'\u89cf', u'\u89d0', u'\u89d1', u'\u89de', u'\u89e6', u'\u89ef', u'\u8a1a',
+    u'\u8a5f', u'\u8a89', u'\u8a8a', u'\u8ba0', u'\u8ba1', u'\u8ba2', u'\u8ba3',
+    u'\u8ba4', u'\u8ba5', u'\u8ba6', u'\u8ba7', u'\u8ba8', u'\u8ba9', u'\u8baa',
+    u'\u8bab', u'\u8bac', u'\u8bad', u'\u8bae', u'\u8baf', u'\u8bb0', u'\u8bb1',
+    u'\u8bb2', u'\u8bb3', u'\u8bb4', u'\u8bb5', u'\u8bb6', u'\u8bb7', u'\u8bb8',
+    u'\u8bb9', u'\u8bba', u'\u8bbb', u'\u8bbc', u'\u8bbd', u'\u8bbe', u'\u8bbf',
+    u'\u8bc0', u'\u8bc1', u'\u8bc2', u'\u8bc3', u'\u8bc4', u'\u8bc5', u'\u8bc6',
+    u'\u8bc7', u'\u8bc8', u'\u8bc9', u'\u8bca', u'\u8bcb', u'\u8bcc', u'\u8bcd',
+    u'\u8bce', u'\u8bcf', u'\u8bd0', u'\u8bd1', u'\u8bd2', u'\u8bd3', u'\u8bd4',
+    u'\u8bd5', u'\u8bd6', u'\u8bd7', u'\u8bd8', u'\u8bd9', u'\u8bda', u'\u8bdb',
+    u'\u8bdc', u'\u8bdd', u'\u8bde', u'\u8bdf', u'\u8be0', u'\u8be1', u'\u8be2',
+    u'\u8be3', u'\u8be4', u'\u8be5', u'\u8be6', u'\u8be7', u'\u8be8', u'\u8be9',
+    u'\u8bea', u'\u8beb', u'\u8bec', u'\u8bed', u'\u8bee', u'\u8bef', u'\u8bf0',
+    u'\u8bf1', u'\u8bf2', u'\u8bf3', u'\u8bf4', u'\u8bf5', u'\u8bf6', u'\u8bf7',
+    u'\u8bf8', u'\u8bf9', u'\u8bfa', u'\u8bfb', u'\u8bfc', u'\u8bfd', u'\u8bfe',
+    u'\u8bff', u'\u8c00', u'\u8c01', u'\u8c02', u'\u8c03', u'\u8c04', u'\u8c05',
+    u'\u8c06', u'\u8c07', u'\u8c08', u'\u8c0a', u'\u8c0b', u'\u8c0c', u'\u8c0d',
+    u'\u8c0e', u'\u8c0f', u'\u8c10', u'\u8c11', u'\u8c12', u'\u8c13', u'\u8c14',
+    u'\u8c15', u'\u8c16', u'\u8c17', u'\u8c18', u'\u8c19', u'\u8c1a', u'\u8c1b',
+    u'\u8c1c', u'\u8c1d', u'\u8c1e', u'\u8c1f', u'\u8c20', u'\u8c21', u'\u8c22',
+    u'\u8c23', u'\u8c24', u'\u8c25', u'\u8c26', u'\u8c27', u'\u8c28', u'\u8c29',
+    u'\u8c2a', u'\u8c2b', u'\u8c2c', u'\u8c2d', u'\u8c2e', u'\u8c2f', u'\u8c30',
+    u'\u8c31', u'\u8c32', u'\u8c33', u'\u8c34', u'\u8c35', u'\u8c36', u'\u8c6e',
+    u'\u8d1d', u'\u8d1e', u'\u8d1f', u'\u8d20', u'\u8d21', u'\u8d22', u'\u8d23',
+    u'\u8d24', u'\u8d25', u'\u8d26', u'\u8d27', u'\u8d28', u'\u8d29', u'\u8d2a',
+    u'\u8d2b', u'\u8d2c', u'\u8d2d', u'\u8d2e', u'\u8d2f', u'\u8d30', u'\u8d31',
+    u'\u8d32', u'\u8d33', u'\u8d34', u'\u8d35', u'\u8d36', u'\u8d37', u'\u8d38',
+    u'\u8d39', u'\u8d3a', u'\u8d3b', u'\u8d3c', u'\u8d3d', u'\u8d3e', u'\u8d3f',
+    u'\u8d40', u'\u8d41', u'\u8d42', u'\u8d43', u'\u8d44', u'\u8d45', u'\u8d46',
+    u'\u8d47', u'\u8d48', u'\u8d49', u'\u8d4a', u'\u8d4b', u'\u8d4c', u'\u8d4d',
+    u'\u8d4e', u'\u8d4f', u'\u8d50', u'\u8d51', u'\u8d52', u'\u8d53', u'\u8d54',
+    u'\u8d55', u'\u8d56', u'\u8d57', u'\u8d58', u'\u8d59', u'\u8d5a', u'\u8d5b',
+    u'\u8d5c', u'\u8d5d', u'\u8d5e', u'\u8d5f', u'\u8d60', u'\u8d61', u'\u8d62',
+    u'\u8d63', u'\u8d6a', u'\u8d75', u'\u8d8b', u'\u8db1', u'\u8db8', u'\u8dc3',
+    u'\u8dc4', u'\u8dde', u'\u8df5', u'\u8df6', u'\u8df7', u'\u8df8', u'\u8df9',
+    u'\u8dfb', u'\u8e0c', u'\u8e2c', u'\u8e2f', u'\u8e51', u'\u8e52', u'\u8e7f',
+    u'\u8e8f', u'\u8e9c', u'\u8eaf', u'\u8f66', u'\u8f67', u'\u8f68', u'\u8f69',
+    u'\u8f6a', u'\u8f6b', u'\u8f6c', u'\u8f6d', u'\u8f6e', u'\u8f6f', u'\u8f70',
+    u'\u8f71', u'\u8f72', u'\u8f73', u'\u8f74', u'\u8f75', u'\u8f76', u'\u8f77',
+    u'\u8f78', u'\u8f79', u'\u8f7a', u'\u8f7b', u'\u8f7c', u'\u8f7d', u'\u8f7e',
+    u'\u8f7f', u'\u8f80', u'\u8f81', u'\u8f82', u'\u8f83', u'\u8f84', u'\u8f85',
+    u'\u8f86', u'\u8f87', u'\u8f88', u'\u8f89', u'\u8f8a', u'\u8f8b', u'\u8f8c',
+    u'\u8f8d', u'\u8f8e', u'\u8f8f', u'\u8f90', u'\u8f91', u'\u8f92', u'\u8f93',
+    u'\u8f94', u'\u8f95', u'\u8f96', u'\u8f97', u'\u8f98', u'\u8f99', u'\u8f9a',
+    u'\u8fa9', u'\u8fab', u'\u8fbd', u'\u8fbe', u'\u8fc8', u'\u8fd0', u'\u8fdb',
+    u'\u8fdd', u'\u8fde', u'\u8fdf', u'\u8ff3', u'\u900a', u'\u9026', u'\u903b',
+    u'\u9057', u'\u9065', u'\u9093', u'\u909d', u'\u90ac', u'\u90ae', u'\u90b9',
+    u'\u90ba', u'\u90bb', u'\u90cf', u'\u90d0', u'\u90d1', u'\u90d3', u'\u90e6',
+    u'\u90e7', u'\u90f8', u'\u9142', u'\u915d', u'\u9166', u'\u9171', u'\u917d',
+    u'\u917e', u'\u917f', u'\u91ca', u'\u9274', u'\u92ae', u'\u933e', u'\u9485',
+    u'\u9486', u'\u9487', u'\u9488', u'\u9489', u'\u948a', u'\u948b', u'\u948c',
+    u'\u948d', u'\u948e', u'\u948f', u'\u9490', u'\u9491', u'\u9492', u'\u9493',
+    u'\u9494', u'\u9495', u'\u9496', u'\u9497', u'\u9498', u'\u9499', u'\u949a',
+    u'\u949b', u'\u949c', u'\u949d', u'\u949e', u'\u949f', u'\u94a0', u'\u94a1',
+    u'\u94a2', u'\u94a3', u'\u94a4', u'\u94a5', u'\u94a6', u'\u94a7', u'\u94a8',
+    u'\u94a9', u'\u94aa', u'\u94ab', u'\u94ac', u'\u94ad', u'\u94ae', u'\u94af',
+    u'\u94b0', u'\u94b1', u'\u94b2', u'\u94b3', u'\u94b4', u'\u94b5', u'\u94b6',
+    u'\u94b7', u'\u94b8', u'\u94b9', u'\u94ba', u'\u94bb', u'\u94bc', u'\u94bd',
+    u'\u94be', u'\u94bf', u'\u94c0', u'\u94c1', u'\u94c2', u'\u94c3', u'\u94c4',
+    u'\u94c5', u'\u94c6', u'\u94c7', u'\u94c8', u'\u94c9', u'\u94ca', u'\u94cb',
+    u'\u94cc', u'\u94cd', u'\u94ce', u'\u94cf', u'\u94d0', u'\u94d1', u'\u94d2',
+    u'\u94d3', u'\u94d4', u'\u94d5', u'\u94d6', u'\u94d7', u'\u94d8', u'\u94d9',
+    u'\u94da', u'\u94db', u'\u94dc', u'\u94dd', u'\u94de', u'\u94df', u'\u94e0',
+    u'\u94e1', u'\u94e2', u'\u94e3', u'\u94e4', u'\u94e5', u'\u94e6', u'\u94e7',
+    u'\u94e8', u'\u94e9', u'\u94ea', u'\u94eb', u'\u94ec', u'\u94ed', u'\u94ee',
+    u'\u94ef', u'\u94f0', u'\u94f1', u'\u94f2', u'\u94f3', u'\u94f4', u'\u94f5',
+    u'\u94f6', u'\u94f7', u'\u94f8', u'\u94f9', u'\u94fa', u'\u94fb', u'\u94fc',
+    u'\u94fd', u'\u94fe', u'\u94ff', u'\u9500', u'\u9501', u'\u9502', u'\u9503',
+    u'\u9504', u'\u9505', u'\u9506', u'\u9507', u'\u9508', u'\u9509', u'\u950a',
+    u'\u950b', u'\u950c', u'\u950d', u'\u950e', u'\u950f', u'\u9510', u'\u9511',
+    u'\u9512', u'\u9513', u'\u9514', u'\u9515', u'\u9516', u'\u9517', u'\u9518',
+    u'\u9519', u'\u951a', u'\u951b', u'\u951c', u'\u951d', u'\u951e', u'\u951f',
+    u'\u9520', u'\u9521', u'\u9522', u'\u9523', u'\u9524', u'\u9525', u'\u9526',
+    u'\u9527', u'\u9528', u'\u9529', u'\u952a', u'\u952b', u'\u952c', u'\u952d',
+    u'\u952e', u'\u952f', u'\u9530', u'\u9531', u'\u9532', u'\u9533', u'\u9534',
+    u'\u9535', u'\u9536', u'\u9537', u'\u9538', u'\u9539', u'\u953a', u'\u953b',
+    u'\u953c', u'\u953d', u'\u953e', u'\u953f', u'\u9540', u'\u9541', u'\u9542',
+    u'\u9543', u'\u9544', u'\u9545', u'\u9546', u'\u9547', u'\u9548', u'\u9549',
+    u'\u954a', u'\u954b', u'\u954c', u'\u954d', u'\u954e', u'\u954f', u'\u9550',
+    u'\u9551', u'\u9552', u'\u9553', u'\u9554', u'\u9555', u'\u9556', u'\u9557',
+    u'\u9558', u'\u9559', u'\u955a', u'\u955b', u'\u955c', u'\u955d', u'\u955e',
+    u'\u955f', u'\u9560', u'\u9561', u'\u9562', u'\u9563', u'\u9564', u'\u9565',
+    u'\u9566', u'\u9567', u'\u9568', u'\u9569', u'\u956a', u'\u956b', u'\u956c',
+    u'\u956d', u'\u956e', u'\u956f', u'\u9570', u'\u9571', u'\u9572', u'\u9573',
+    u'\u9574', u'\u9575', u'\u9576', u'\u957f', u'\u95e8', u'\u95e9', u'\u95ea',
+    u'\u95eb', u'\u95ec', u'\u95ed', u'\u95ee', u'\u95ef', u'\u95f0', u'\u95f1',
+    u'\u95f2', u'\u95f3', u'\u95f4', u'\u95f5', u'\u95f6', u'\u95f7', u'\u95f8',
+    u'\u95f9', u'\u95fa', u'\u95fb', u'\u95fc', u'\u95fd', u'\u95fe', u'\u95ff',
+    u'\u9600', u'\u9601', u'\u9602', u'\u9603', u'\u9604', u'\u9605', u'\u9606',
+    u'\u9607', u'\u9608', u'\u9609', u'\u960a', u'\u960b', u'\u960c', u'\u960d',
+    u'\u960e', u'\u960f', u'\u9610', u'\u9611', u'\u9612', u'\u9613', u'\u9614',
+    u'\u9615', u'\u9616', u'\u9617', u'\u9618', u'\u9619', u'\u961a', u'\u961b',
+    u'\u961f', u'\u9633', u'\u9634', u'\u9635', u'\u9636', u'\u9645', u'\u9646',
+    u'\u9647', u'\u9648', u'\u9649', u'\u9655', u'\u9667', u'\u9668', u'\u9669',
+    u'\u968f', u'\u96cf', u'\u96e0', u'\u96f3', u'\u96fe', u'\u9701', u'\u9721',
+    u'\u972d', u'\u9753', u'\u9765', u'\u9791', u'\u9792', u'\u97af', u'\u97e6',
+    u'\u97e7', u'\u97e8', u'\u97e9', u'\u97ea', u'\u97eb', u'\u97ec', u'\u9875',
+    u'\u9876', u'\u9877', u'\u9878', u'\u9879', u'\u987a', u'\u987b', u'\u987c',
+    u'\u987d', u'\u987e', u'\u987f', u'\u9880', u'\u9881', u'\u9882', u'\u9883',
+    u'\u9884', u'\u9885', u'\u9886', u'\u9887', u'\u9888', u'\u9889', u'\u988a',
+    u'\u988b', u'\u988c', u'\u988d', u'\u988e', u'\u988f', u'\u9890', u'\u9891',
+    u'\u9892', u'\u9893', u'\u9894', u'\u9895', u'\u9896', u'\u9897', u'\u9898',
+    u'\u9899', u'\u989a', u'\u989b', u'\u989c', u'\u989d', u'\u989e', u'\u989f',
+    u'\u98a0', u'\u98a1', u'\u98a2', u'\u98a3', u'\u98a4', u'\u98a5', u'\u98a6',
+    u'\u98a7', u'\u98ce', u'\u98cf', u'\u98d0', u'\u98d1', u'\u98d2', u'\u98d3',
+    u'\u98d4', u'\u98d5', u'\u98d6', u'\u98d7', u'\u98d8', u'\u98d9', u'\u98da',
+    u'\u98de', u'\u98e8', u'\u990d', u'\u9963', u'\u9964', u'\u9965', u'\u9966',
+    u'\u9967', u'\u9968', u'\u9969', u'\u996a', u'\u996b', u'\u996c', u'\u996d',
+    u'\u996e', u'\u996f', u'\u9970', u'\u9971', u'\u9972', u'\u9973', u'\u9974',
+    u'\u9975', u'\u9976', u'\u9977', u'\u9978', u'\u9979', u'\u997a', u'\u997b',
+    u'\u997c', u'\u997d', u'\u997e', u'\u997f', u'\u9980', u'\u9981', u'\u9982',
+    u'\u9983', u'\u9984', u'\u9985', u'\u9986', u'\u9987', u'\u9988', u'\u9989',
+    u'\u998a', u'\u998b', u'\u998c', u'\u998d', u'\u998e', u'\u998f', u'\u9990',
+    u'\u9991', u'\u9992', u'\u9993', u'\u9994', u'\u9995', u'\u9a6c', u'\u9a6d',
+    u'\u9a6e', u'\u9a6f', u'\u9a70', u'\u9a71', u'\u9a72', u'\u9a73', u'\u9a74',
+    u'\u9a75', u'\u9a76', u'\u9a77', u'\u9a78', u'\u9a79', u'\u9a7a', u'\u9a7b',
+    u'\u9a7c', u'\u9a7d', u'\u9a7e', u'\u9a7f', u'\u9a80', u'\u9a81', u'\u9a82',
+    u'\u9a83', u'\u9a84', u'\u9a85', u'\u9a86', u'\u9a87', u'\u9a88', u'\u9a89',
+    u'\u9a8a', u'\u9a8b', u'\u9a8c', u'\u9a8d', u'\u9a8e', u'\u9a8f', u'\u9a90',
+    u'\u9a91', u'\u9a92', u'\u9a93', u'\u9a94', u'\u9a95', u'\u9a96', u'\u9a97',
+    u'\u9a98', u'\u9a99', u'\u9a9a', u'\u9a9b', u'\u9a9c', u'\u9a9d', u'\u9a9e',
+    u'\u9a9f', u'\u9aa0', u'\u9aa1', u'\u9aa2', u'\u9aa3', u'\u9aa4', u'\u9aa5',
+    u'\u9aa6', u'\u9aa7', u'\u9ac5', u'\u9acb', u'\u9acc', u'\u9b13', u'\u9b47',
+    u'\u9b49', u'\u9c7c', u'\u9c7d', u'\u9c7e', u'\u9c7f', u'\u9c80', u'\u9c81',
+    u'\u9c82', u'\u9c83', u'\u9c84', u'\u9c85', u'\u9c86', u'\u9c88', u'\u9c89',
+    u'\u9c8a', u'\u9c8b', u'\u9c8c', u'\u9c8d', u'\u9c8e', u'\u9c8f', u'\u9c90',
+    u'\u9c91', u'\u9c92', u'\u9c93', u'\u9c94', u'\u9c95', u'\u9c96', u'\u9c97',
+    u'\u9c98', u'\u9c99', u'\u9c9a', u'\u9c9b', u'\u9c9c', u'\u9c9d', u'\u9c9e',
+    u'\u9c9f', u'\u9ca0', u'\u9ca1', u'\u9ca2', u'\u9ca3', u'\u9ca4', u'\u9ca5',
+    u'\u9ca6', u'\u9ca7', u'\u9ca8', u'\u9ca9', u'\u9caa', u'\u9cab', u'\u9cac',
+    u'\u9cad', u'\u9cae', u'\u9caf', u'\u9cb0', u'\u9cb1', u'\u9cb2', u'\u9cb3',
+    u'\u9cb4', u'\u9cb5', u'\u9cb7', u'\u9cb8', u'\u9cb9', u'\u9cba', u'\u9cbb',
+    u'\u9cbc', u'\u9cbd', u'\u9cbe', u'\u9cbf', u'\u9cc0', u'\u9cc1', u'\u9cc2',
+    u'\u9cc3', u'\u9cc4', u'\u9cc5', u'\u9cc6', u'\u9cc7', u'\u9cc8', u'\u9cc9',
+    u'\u9cca', u'\u9ccb', u'\u9ccc', u'\u9ccd', u'\u9cce', u'\u9ccf', u'\u9cd0',
+    u'\u9cd1', u'\u9cd2', u'\u9cd3', u'\u9cd4', u'\u9cd5', u'\u9cd6', u'\u9cd7',
+    u'\u9cd8', u'\u9cd9', u'\u9cda', u'\u9cdb', u'\u9cdc', u'\u9cdd', u'\u9cde',
+    u'\u9cdf', u'\u9ce0', u'\u9ce1', u'\u9ce2', u'\u9ce3', u'\u9e1f', u'\u9e20',
+    u'\u9e21', u'\u9e22', u'\u9e23', u'\u9e24', u'\u9e25', u'\u9e26', u'\u9e27',
+    u'\u9e28', u'\u9e29', u'\u9e2a', u'\u9e2b', u'\u9e2c', u'\u9e2d', u'\u9e2e',
+    u'\u9e2f', u'\u9e30', u'\u9e31', u'\u9e32', u'\u9e33', u'\u9e34', u'\u9e35',
+    u'\u9e36', u'\u9e37', u'\u9e38', u'\u9e39', u'\u9e3a', u'\u9e3b', u'\u9e3c',
+    u'\u9e3d', u'\u9e3e', u'\u9e3f', u'\u9e40', u'\u9e41', u'\u9e42', u'\u9e43',
+    u'\u9e44', u'\u9e45', u'\u9e46', u'\u9e47', u'\u9e48', u'\u9e49', u'\u9e4a',
+    u'\u9e4b', u'\u9e4c', u'\u9e4d', u'\u9e4e', u'\u9e4f', u'\u9e50', u'\u9e51',
+    u'\u9e52', u'\u9e53', u'\u9e54', u'\u9e55', u'\u9e56', u'\u9e57', u'\u9e58',
+    u'\u9e59', u'\u9e5a', u'\u9e5b', u'\u9e5c', u'\u9e5d', u'\u9e5e', u'\u9e5f',
+    u'\u9e60', u'\u9e61', u'\u9e62', u'\u9e63', u'\u9e64', u'\u9e65', u'\u9e66',
+    u'\u9e67', u'\u9e68', u'\u9e69', u'\u9e6a', u'\u9e6b', u'\u9e6c', u'\u9e6d',
+    u'\u9e6e', u'\u9e6f', u'\u9e70', u'\u9e71', u'\u9e72', u'\u9e73', u'\u9e74',
+    u'\u9e7e', u'\u9eb8', u'\u9ec9', u'\u9ee1', u'\u9ee9', u'\u9eea', u'\u9f0b',
+    u'\u9f0d', u'\u9f50', u'\u9f51', u'\u9f7f', u'\u9f80', u'\u9f81', u'\u9f82',
+    u'\u9f83', u'\u9f84', u'\u9f85', u'\u9f86', u'\u9f87', u'\u9f88', u'\u9f89',
+    u'\u9f8a', u'\u9f8b', u'\u9f8c', u'\u9f99', u'\u9f9a', u'\u9f9b', u'\u9f9f',
 };
 
 // These are characters that technically exist in traditional Chinese, but
 // are rare, rare variants, literary, or used only in specific place names
-const static QList<QString> MOSTLY_SIMPLIFIED_CHINESE_CHARS = {
-    "\u3cfd", "\u4e07", "\u4e22", "\u4e24", "\u4e2a", "\u4e30", "\u4e48",
-    "\u4e49", "\u4e50", "\u4e71", "\u4e89", "\u4e8e", "\u4e8f", "\u4e91",
-    "\u4ec5", "\u4ece", "\u4eea", "\u4ef7", "\u4f17", "\u4f18", "\u4f1a",
-    "\u4f53", "\u4fa9", "\u506c", "\u50de", "\u513f", "\u5151", "\u515a",
-    "\u5185", "\u518c", "\u518c", "\u51b2", "\u51b5", "\u51c9", "\u51cf",
-    "\u51d1",
-    "\u51e0", // Debatable I guess, but much more frequently used in Simplified Chinese
-    "\u51e4", "\u51ed", "\u5218", "\u5220", "\u522b", "\u5239", "\u529e",
-    "\u52b3", "\u52bf", "\u5300", "\u533b", "\u5355", "\u5382", "\u5398",
-    "\u53a6", "\u53a8", "\u53a9", "\u53ae", "\u53c2", "\u53cc", "\u53d9",
-    "\u53e0", "\u53f0", "\u53f6", "\u53f7", "\u542c", "\u5434", "\u548f",
-    "\u54a4", "\u54cd", "\u5631", "\u56ed", "\u574f", "\u5815", "\u58ee",
-    "\u58f0", "\u58f3", "\u591f", "\u5978", "\u59d7", "\u59f9", "\u5a31",
-    "\u5b81", "\u5b9d", "\u5b9e", "\u5bf9", "\u5bff", "\u5c14", "\u5c3d",
-    "\u5c4a", "\u5c5e", "\u5e18", "\u5e42", "\u5e76", // Also debatable
-    "\u5e7f", "\u5e84", "\u5e94", "\u5e99", "\u5f00", "\u5f03", "\u5f39",
-    "\u5f3a", "\u5f52", "\u5f53", "\u5f66", "\u6000", "\u601c", "\u604b",
-    "\u6052", "\u60e7", "\u6120", // Wiktionary claims this character is also used in traditional in Hong Kong
-    "\u613f", "\u6237", "\u6267", "\u629b", "\u62a5", "\u62c5", "\u6302",
-    "\u636e", "\u63fe", "\u643a", "\u6491", "\u6570", "\u658b", "\u65ad",
-    "\u65e0", "\u65f6", "\u664b", "\u6652", "\u672f", "\u6734", "\u673a",
-    "\u6781", "\u6784", "\u67dc", // Also debatable */
-    "\u6816", "\u683e", "\u68a6", "\u6b22", "\u6be1", "\u6c14", "\u6c79",
-    "\u6c88", "\u6ca1", "\u6cea", "\u6d12", "\u6d3c", "\u6d82", "\u6dc0",
-    "\u6e29", // Wiktionary claims this character is also used in traditional in Hong Kong
-    "\u6f13", "\u706f", "\u707e", "\u70df", "\u72b9", "\u732a", "\u732b",
-    "\u732e", "\u73af", "\u7535", "\u753b", "\u75b1", "\u75b4", "\u75d2",
-    "\u76d6", "\u7726", "\u786e", "\u788d", "\u78b1", "\u793c", "\u7980",
-    "\u79c6", "\u79cd", "\u79f0", "\u7b0b", "\u7b14", "\u7c9c", "\u7cae",
-    "\u7f51", "\u7f57", "\u7f62", "\u803b", "\u8054", "\u80ae", "\u80c6",
-    "\u80dc", "\u8109", "\u811a", "\u814a", "\u816d", "\u82a6", "\u82f9",
-    "\u8303", "\u8346", "\u8350", "\u8363", "\u8385", "\u8502", "\u8616",
-    "\u866b", "\u866c", "\u8695", "\u86ee", "\u8721", "\u8845", "\u886e",
-    "\u889c", "\u8d76", "\u8e2a", "\u8f9e", "\u8fb9", "\u8fc1", "\u8fc7",
-    "\u8fd8", "\u8fd9", "\u8fdc", "\u8fe9", "\u8ff9", "\u9002", "\u9009",
-    "\u9012", "\u9690", "\u96b6", "\u96bd", "\u96be", "\u9759", "\u97f5",
-    "\u9ea6", "\u9ec4", "\u9efe", "\u9f39",
+constexpr char16_t MOSTLY_SIMPLIFIED_CHINESE_CHARS[] = {
+    u'\u3cfd', u'\u4e07', u'\u4e22', u'\u4e24', u'\u4e2a', u'\u4e30', u'\u4e48',
+    u'\u4e49', u'\u4e50', u'\u4e71', u'\u4e89', u'\u4e8e', u'\u4e8f', u'\u4e91',
+    u'\u4ec5', u'\u4ece', u'\u4eea', u'\u4ef7', u'\u4f17', u'\u4f18', u'\u4f1a',
+    u'\u4f53', u'\u4fa9', u'\u506c', u'\u50de', u'\u513f', u'\u5151', u'\u515a',
+    u'\u5185', u'\u518c', u'\u518c', u'\u51b2', u'\u51b5', u'\u51c9', u'\u51cf',
+    u'\u51d1',
+    u'\u51e0', // Debatable I guess, but much more frequently used in Simplified Chinese
+    u'\u51e4', u'\u51ed', u'\u5218', u'\u5220', u'\u522b', u'\u5239', u'\u529e',
+    u'\u52b3', u'\u52bf', u'\u5300', u'\u533b', u'\u5355', u'\u5382', u'\u5398',
+    u'\u53a6', u'\u53a8', u'\u53a9', u'\u53ae', u'\u53c2', u'\u53cc', u'\u53d9',
+    u'\u53e0', u'\u53f0', u'\u53f6', u'\u53f7', u'\u542c', u'\u5434', u'\u548f',
+    u'\u54a4', u'\u54cd', u'\u5631', u'\u56ed', u'\u574f', u'\u5815', u'\u58ee',
+    u'\u58f0', u'\u58f3', u'\u591f', u'\u5978', u'\u59d7', u'\u59f9', u'\u5a31',
+    u'\u5b81', u'\u5b9d', u'\u5b9e', u'\u5bf9', u'\u5bff', u'\u5c14', u'\u5c3d',
+    u'\u5c4a', u'\u5c5e', u'\u5e18', u'\u5e42', u'\u5e76', // Also debatable
+    u'\u5e7f', u'\u5e84', u'\u5e94', u'\u5e99', u'\u5f00', u'\u5f03', u'\u5f39',
+    u'\u5f3a', u'\u5f52', u'\u5f53', u'\u5f66', u'\u6000', u'\u601c', u'\u604b',
+    u'\u6052', u'\u60e7', u'\u6120', // Wiktionary claims this character is also used in traditional in Hong Kong
+    u'\u613f', u'\u6237', u'\u6267', u'\u629b', u'\u62a5', u'\u62c5', u'\u6302',
+    u'\u636e', u'\u63fe', u'\u643a', u'\u6491', u'\u6570', u'\u658b', u'\u65ad',
+    u'\u65e0', u'\u65f6', u'\u664b', u'\u6652', u'\u672f', u'\u6734', u'\u673a',
+    u'\u6781', u'\u6784', u'\u67dc', // Also debatable */
+    u'\u6816', u'\u683e', u'\u68a6', u'\u6b22', u'\u6be1', u'\u6c14', u'\u6c79',
+    u'\u6c88', u'\u6ca1', u'\u6cea', u'\u6d12', u'\u6d3c', u'\u6d82', u'\u6dc0',
+    u'\u6e29', // Wiktionary claims this character is also used in traditional in Hong Kong
+    u'\u6f13', u'\u706f', u'\u707e', u'\u70df', u'\u72b9', u'\u732a', u'\u732b',
+    u'\u732e', u'\u73af', u'\u7535', u'\u753b', u'\u75b1', u'\u75b4', u'\u75d2',
+    u'\u76d6', u'\u7726', u'\u786e', u'\u788d', u'\u78b1', u'\u793c', u'\u7980',
+    u'\u79c6', u'\u79cd', u'\u79f0', u'\u7b0b', u'\u7b14', u'\u7c9c', u'\u7cae',
+    u'\u7f51', u'\u7f57', u'\u7f62', u'\u803b', u'\u8054', u'\u80ae', u'\u80c6',
+    u'\u80dc', u'\u8109', u'\u811a', u'\u814a', u'\u816d', u'\u82a6', u'\u82f9',
+    u'\u8303', u'\u8346', u'\u8350', u'\u8363', u'\u8385', u'\u8502', u'\u8616',
+    u'\u866b', u'\u866c', u'\u8695', u'\u86ee', u'\u8721', u'\u8845', u'\u886e',
+    u'\u889c', u'\u8d76', u'\u8e2a', u'\u8f9e', u'\u8fb9', u'\u8fc1', u'\u8fc7',
+    u'\u8fd8', u'\u8fd9', u'\u8fdc', u'\u8fe9', u'\u8ff9', u'\u9002', u'\u9009',
+    u'\u9012', u'\u9690', u'\u96b6', u'\u96bd', u'\u96be', u'\u9759', u'\u97f5',
+    u'\u9ea6', u'\u9ec4', u'\u9efe', u'\u9f39',
 };
 
-const static QList<QString> TRADITIONAL_CHINESE_CHARS = {
-    "\u346F", "\u3473", "\u3493", "\u34E8", "\u35F2", "\u361A", "\u3704",
-    "\u370F", "\u3722", "\u3737", "\u379E", "\u380F", "\u389D", "\u396E",
-    "\u398E", "\u3A5C", "\u3A73", "\u3DFF", "\u3E8F", "\u3FE7", "\u4039",
-    "\u406A", "\u407B", "\u4259", "\u426C", "\u4272", "\u42AD", "\u42B7",
-    "\u42D9", "\u42DA", "\u42FB", "\u42FF", "\u4308", "\u430B", "\u4316",
-    "\u431D", "\u431F", "\u4325", "\u4330", "\u4573", "\u45FF", "\u4661",
-    "\u4700", "\u477B", "\u477C", "\u4788", "\u48A8", "\u4947", "\u4969",
-    "\u4971", "\u4998", "\u499B", "\u499F", "\u49B3", "\u49E2", "\u4A8F",
-    "\u4A97", "\u4A98", "\u4AF4", "\u4B18", "\u4B1D", "\u4B1E", "\u4B40",
-    "\u4B43", "\u4B7F", "\u4B9D", "\u4B9E", "\u4BA0", "\u4BAB", "\u4BB3",
-    "\u4BBE", "\u4BC0", "\u4C3E", "\u4C59", "\u4C6C", "\u4C70", "\u4C77",
-    "\u4C7D", "\u4C81", "\u4C96", "\u4CB0", "\u4D09", "\u4D2C", "\u4D34",
-    "\u4E1F", "\u4E26", "\u4E7E", "\u4E82", "\u4E9E", "\u4F47", "\u4F59",
-    "\u4F75", "\u4F86", "\u4F96", "\u4FB6", "\u4FC1", "\u4FC2", "\u4FD4",
-    "\u4FE0", "\u4FE5", "\u5000", "\u5006", "\u5008", "\u5009", "\u500B",
-    "\u5011", "\u502B", "\u5032", "\u5049", "\u5051", "\u5074", "\u5075",
-    "\u507D", "\u5091", "\u5096", "\u5098", "\u5099", "\u50AD", "\u50AF",
-    "\u50B3", "\u50B4", "\u50B5", "\u50B7", "\u50BE", "\u50C2", "\u50C5",
-    "\u50C9", "\u50D1", "\u50D5", "\u50DE", "\u50E5", "\u50E8", "\u50F9",
-    "\u5100", "\u5102", "\u5104", "\u5108", "\u5109", "\u5110", "\u5114",
-    "\u5115", "\u5118", "\u511F", "\u5123", "\u512A", "\u5132", "\u5137",
-    "\u5138", "\u513A", "\u513B", "\u513C", "\u514C", "\u5152", "\u5157",
-    "\u5167", "\u5169", "\u518A", "\u51AA", "\u51C8", "\u51CD", "\u51D9",
-    "\u51DC", "\u51F1", "\u5225", "\u522A", "\u5244", "\u5247", "\u524B",
-    "\u524E", "\u5257", "\u525B", "\u525D", "\u526E", "\u5274", "\u5275",
-    "\u527E", "\u5283", "\u5287", "\u5289", "\u528A", "\u528C", "\u528D",
-    "\u528F", "\u5291", "\u529A", "\u52C1", "\u52D5", "\u52D9", "\u52DB",
-    "\u52DD", "\u52DE", "\u52E2", "\u52E9", "\u52F1", "\u52F5", "\u52F8",
-    "\u52FB", "\u532D", "\u532F", "\u5331", "\u5340", "\u5354", "\u537B",
-    "\u5399", "\u53AD", "\u53B2", "\u53B4", "\u53C3", "\u53C4", "\u53E2",
-    "\u53F0", "\u540E", "\u5412", "\u5433", "\u5436", "\u5442", "\u54BC",
-    "\u54E1", "\u54EF", "\u5504", "\u551A", "\u554F", "\u555E", "\u555F",
-    "\u5562", "\u558E", "\u559A", "\u55AA", "\u55AC", "\u55AE", "\u55B2",
-    "\u55C6", "\u55C7", "\u55CA", "\u55CE", "\u55DA", "\u55E9", "\u55F6",
-    "\u55F9", "\u5606", "\u560D", "\u5613", "\u5614", "\u5616", "\u5617",
-    "\u561C", "\u5629", "\u562E", "\u562F", "\u5630", "\u5635", "\u5638",
-    "\u563D", "\u5645", "\u5653", "\u565A", "\u565D", "\u5660", "\u5665",
-    "\u5666", "\u566F", "\u5672", "\u5674", "\u5678", "\u5679", "\u5680",
-    "\u5687", "\u568C", "\u5695", "\u5699", "\u56A6", "\u56A8", "\u56B2",
-    "\u56B3", "\u56B4", "\u56B6", "\u56C0", "\u56C1", "\u56C2", "\u56C5",
-    "\u56C8", "\u56C9", "\u56D1", "\u56EA", "\u5707", "\u570B", "\u570D",
-    "\u5712", "\u5713", "\u5716", "\u5718", "\u571E", "\u57B5", "\u57E1",
-    "\u57F0", "\u57F7", "\u5805", "\u580A", "\u5816", "\u581D", "\u582F",
-    "\u5831", "\u5834", "\u584A", "\u584B", "\u584F", "\u5852", "\u5857",
-    "\u5862", "\u5864", "\u5875", "\u5879", "\u588A", "\u589C", "\u58AE",
-    "\u58B3", "\u58BE", "\u58C7", "\u58C8", "\u58CB", "\u58D3", "\u58D8",
-    "\u58D9", "\u58DA", "\u58DE", "\u58DF", "\u58E0", "\u58E2", "\u58E9",
-    "\u58EF", "\u58FA", "\u58FC", "\u58FD", "\u5920", "\u5922", "\u593E",
-    "\u5950", "\u5967", "\u5969", "\u596A", "\u596E", "\u597C", "\u599D",
-    "\u59CD", "\u59E6", "\u5A1B", "\u5A41", "\u5A66", "\u5A6D", "\u5AA7",
-    "\u5AAF", "\u5AB0", "\u5ABC", "\u5ABD", "\u5AD7", "\u5AF5", "\u5AFB",
-    "\u5AFF", "\u5B08", "\u5B0B", "\u5B0C", "\u5B19", "\u5B21", "\u5B24",
-    "\u5B2A", "\u5B30", "\u5B38", "\u5B4B", "\u5B4C", "\u5B6B", "\u5B78",
-    "\u5B7F", "\u5BAE", "\u5BE2", "\u5BE6", "\u5BE7", "\u5BE9", "\u5BEB",
-    "\u5BEC", "\u5BF5", "\u5BF6", "\u5C07", "\u5C08", "\u5C0B", "\u5C0D",
-    "\u5C0E", "\u5C37", "\u5C46", "\u5C4D", "\u5C53", "\u5C5C", "\u5C62",
-    "\u5C64", "\u5C68", "\u5C69", "\u5C6C", "\u5CA1", "\u5CF4", "\u5CF6",
-    "\u5CFD", "\u5D0D", "\u5D17", "\u5D22", "\u5D2C", "\u5D50", "\u5D7C",
-    "\u5D81", "\u5D84", "\u5D87", "\u5D94", "\u5D97", "\u5DA0", "\u5DA2",
-    "\u5DA7", "\u5DAE", "\u5DB4", "\u5DB8", "\u5DBA", "\u5DBC", "\u5DCB",
-    "\u5DD2", "\u5DD4", "\u5DF0", "\u5E25", "\u5E2B", "\u5E33", "\u5E36",
-    "\u5E40", "\u5E43", "\u5E57", "\u5E58", "\u5E5F", "\u5E63", "\u5E6B",
-    "\u5E6C", "\u5E79", "\u5E7A", "\u5E7E", "\u5EAB", "\u5EC1", "\u5EC2",
-    "\u5EC4", "\u5EC8", "\u5EDA", "\u5EDD", "\u5EDF", "\u5EE0", "\u5EE1",
-    "\u5EE2", "\u5EE3", "\u5EE9", "\u5EEC", "\u5EF3", "\u5F12", "\u5F33",
-    "\u5F35", "\u5F37", "\u5F48", "\u5F4C", "\u5F4E", "\u5F59", "\u5F5E",
-    "\u5F65", "\u5F72", "\u5F8C", "\u5F91", "\u5F9E", "\u5FA0", "\u5FA9",
-    "\u5FB5", "\u5FB9", "\u5FD7", "\u6046", "\u6065", "\u6085", "\u609E",
-    "\u60B5", "\u60B6", "\u60E1", "\u60F1", "\u60F2", "\u60FB", "\u611B",
-    "\u611C", "\u6128", "\u6134", "\u6137", "\u613E", "\u6144", "\u614B",
-    "\u614D", "\u6158", "\u615A", "\u615F", "\u6163", "\u616A", "\u616B",
-    "\u616E", "\u6173", "\u6176", "\u6182", "\u618A", "\u6190", "\u6191",
-    "\u6192", "\u619A", "\u61A4", "\u61AB", "\u61AE", "\u61B2", "\u61B6",
-    "\u61C0", "\u61C7", "\u61C9", "\u61CC", "\u61CD", "\u61DF", "\u61E3",
-    "\u61E8", "\u61F2", "\u61F6", "\u61F7", "\u61F8", "\u61FA", "\u61FC",
-    "\u61FE", "\u6200", "\u6207", "\u6214", "\u6227", "\u6229", "\u6230",
-    "\u6231", "\u6232", "\u6236", "\u62CB", "\u6329", "\u633E", "\u6368",
-    "\u636B", "\u6383", "\u6384", "\u6386", "\u6397", "\u6399", "\u639B",
-    "\u63A1", "\u63C0", "\u63DA", "\u63DB", "\u63EE", "\u640D", "\u6416",
-    "\u6417", "\u6435", "\u6436", "\u644B", "\u6451", "\u645C", "\u645F",
-    "\u646F", "\u6473", "\u6476", "\u647B", "\u6488", "\u648F", "\u6490",
-    "\u6493", "\u649D", "\u649F", "\u64A3", "\u64A5", "\u64AB", "\u64B2",
-    "\u64B3", "\u64BB", "\u64BE", "\u64BF", "\u64C1", "\u64C4", "\u64C7",
-    "\u64CA", "\u64CB", "\u64D3", "\u64D4", "\u64DA", "\u64E0", "\u64E3",
-    "\u64EC", "\u64EF", "\u64F0", "\u64F1", "\u64F2", "\u64F4", "\u64F7",
-    "\u64FA", "\u64FB", "\u64FC", "\u64FD", "\u64FE", "\u6504", "\u6506",
-    "\u650F", "\u6514", "\u6516", "\u6519", "\u651B", "\u651C", "\u651D",
-    "\u6522", "\u6523", "\u6524", "\u652A", "\u652C", "\u6557", "\u6558",
-    "\u6575", "\u6578", "\u6582", "\u6583", "\u6585", "\u6586", "\u6595",
-    "\u65AC", "\u65B7", "\u65BC", "\u6642", "\u6649", "\u665D", "\u6688",
-    "\u6689", "\u6698", "\u66A2", "\u66AB", "\u66C4", "\u66C6", "\u66C7",
-    "\u66C9", "\u66CF", "\u66D6", "\u66E0", "\u66E5", "\u66E8", "\u66EC",
-    "\u66F8", "\u6703", "\u6725", "\u6727", "\u6771", "\u6774", "\u6781",
-    "\u67F5", "\u687F", "\u6894", "\u6898", "\u689D", "\u689F", "\u68B2",
-    "\u68C4", "\u68D6", "\u68D7", "\u68DF", "\u68E1", "\u68E7", "\u68F2",
-    "\u68F6", "\u690F", "\u6932", "\u694A", "\u6953", "\u6968", "\u696D",
-    "\u6975", "\u69AA", "\u69AE", "\u69B2", "\u69BF", "\u69CB", "\u69CD",
-    "\u69E4", "\u69E7", "\u69E8", "\u69F3", "\u69F6", "\u6A01", "\u6A02",
-    "\u6A05", "\u6A13", "\u6A19", "\u6A1E", "\u6A22", "\u6A23", "\u6A2B",
-    "\u6A38", "\u6A39", "\u6A3A", "\u6A3F", "\u6A48", "\u6A4B", "\u6A5F",
-    "\u6A62", "\u6A6B", "\u6A81", "\u6A89", "\u6A94", "\u6A9C", "\u6A9F",
-    "\u6AA2", "\u6AA3", "\u6AAD", "\u6AAE", "\u6AAF", "\u6AB3", "\u6AB8",
-    "\u6ABB", "\u6AC3", "\u6AD3", "\u6ADA", "\u6ADB", "\u6ADD", "\u6ADE",
-    "\u6ADF", "\u6AE5", "\u6AE7", "\u6AE8", "\u6AEA", "\u6AEB", "\u6AEC",
-    "\u6AF1", "\u6AF3", "\u6AF8", "\u6AFB", "\u6B04", "\u6B0A", "\u6B0D",
-    "\u6B0F", "\u6B12", "\u6B13", "\u6B16", "\u6B1E", "\u6B3D", "\u6B50",
-    "\u6B5F", "\u6B61", "\u6B72", "\u6B77", "\u6B78", "\u6B7F", "\u6B98",
-    "\u6B9E", "\u6BA4", "\u6BA8", "\u6BAB", "\u6BAE", "\u6BAF", "\u6BB0",
-    "\u6BB2", "\u6BBA", "\u6BBC", "\u6BC0", "\u6BC6", "\u6BFF", "\u6C02",
-    "\u6C08", "\u6C0C", "\u6C23", "\u6C2B", "\u6C2C", "\u6C33", "\u6C7A",
-    "\u6C92", "\u6C96", "\u6CC1", "\u6D36", "\u6D79", "\u6D87", "\u6DBC",
-    "\u6DDA", "\u6DE5", "\u6DEA", "\u6DF5", "\u6DF6", "\u6DFA", "\u6E19",
-    "\u6E1B", "\u6E22", "\u6E26", "\u6E2C", "\u6E3E", "\u6E4A", "\u6E5E",
-    "\u6E6F", "\u6E88", "\u6E96", "\u6E9D", "\u6EAB", "\u6EB3", "\u6EC4",
-    "\u6EC5", "\u6ECC", "\u6ECE", "\u6EEC", "\u6EEF", "\u6EF2", "\u6EF8",
-    "\u6EFB", "\u6EFE", "\u6EFF", "\u6F01", "\u6F0A", "\u6F1A", "\u6F22",
-    "\u6F23", "\u6F2C", "\u6F32", "\u6F35", "\u6F38", "\u6F3F", "\u6F41",
-    "\u6F51", "\u6F54", "\u6F5B", "\u6F64", "\u6F6F", "\u6F70", "\u6F77",
-    "\u6F7F", "\u6F80", "\u6F85", "\u6F86", "\u6F87", "\u6F97", "\u6FA0",
-    "\u6FA4", "\u6FA6", "\u6FA9", "\u6FAE", "\u6FB1", "\u6FBE", "\u6FC1",
-    "\u6FC3", "\u6FC4", "\u6FC6", "\u6FD5", "\u6FD8", "\u6FDC", "\u6FDF",
-    "\u6FE4", "\u6FE7", "\u6FEB", "\u6FF0", "\u6FF1", "\u6FFA", "\u6FFC",
-    "\u6FFE", "\u7002", "\u7003", "\u7005", "\u7006", "\u7007", "\u7009",
-    "\u700B", "\u700F", "\u7015", "\u7018", "\u701D", "\u701F", "\u7020",
-    "\u7026", "\u7027", "\u7028", "\u7030", "\u7032", "\u703E", "\u7043",
-    "\u7044", "\u7051", "\u7055", "\u7058", "\u7059", "\u705D", "\u7060",
-    "\u7061", "\u7063", "\u7064", "\u7067", "\u707D", "\u70BA", "\u70CF",
-    "\u70F4", "\u7121", "\u7149", "\u7152", "\u7159", "\u7162", "\u7165",
-    "\u7169", "\u716C", "\u7171", "\u7185", "\u7189", "\u718C", "\u7192",
-    "\u7193", "\u7197", "\u71A1", "\u71B1", "\u71B2", "\u71BE", "\u71C1",
-    "\u71C8", "\u71D2", "\u71D9", "\u71DC", "\u71DF", "\u71E6", "\u71ED",
-    "\u71F4", "\u71F6", "\u71FC", "\u71FE", "\u7204", "\u720D", "\u7210",
-    "\u721B", "\u722D", "\u723A", "\u723E", "\u7246", "\u7258", "\u727D",
-    "\u7296", "\u72A2", "\u72A7", "\u72C0", "\u72F9", "\u72FD", "\u7319",
-    "\u7336", "\u733B", "\u7341", "\u7344", "\u7345", "\u734E", "\u7368",
-    "\u736A", "\u736B", "\u736E", "\u7370", "\u7371", "\u7372", "\u7375",
-    "\u7377", "\u7378", "\u737A", "\u737B", "\u737C", "\u7380", "\u7381",
-    "\u73FE", "\u743A", "\u743F", "\u744B", "\u7452", "\u7463", "\u7464",
-    "\u7469", "\u746A", "\u7472", "\u747D", "\u7489", "\u74A3", "\u74A6",
-    "\u74AB", "\u74AF", "\u74B0", "\u74BD", "\u74CA", "\u74CF", "\u74D4",
-    "\u74D5", "\u74DA", "\u750C", "\u7522", "\u755D", "\u7562", "\u756B",
-    "\u7570", "\u7576", "\u7587", "\u758A", "\u75D9", "\u75FE", "\u7602",
-    "\u760B", "\u760D", "\u7613", "\u761E", "\u7621", "\u7627", "\u762E",
-    "\u7632", "\u763A", "\u7642", "\u7646", "\u7647", "\u7649", "\u7658",
-    "\u765F", "\u7662", "\u7664", "\u7665", "\u7667", "\u7669", "\u766C",
-    "\u766D", "\u766E", "\u7670", "\u7671", "\u7672", "\u767C", "\u769A",
-    "\u769F", "\u76B0", "\u76B8", "\u76BA", "\u76DC", "\u76DE", "\u76E1",
-    "\u76E3", "\u76E4", "\u76E7", "\u76EA", "\u7725", "\u773E", "\u774D",
-    "\u774F", "\u775C", "\u775E", "\u7798", "\u779C", "\u779E", "\u77A4",
-    "\u77B6", "\u77BC", "\u77D3", "\u77DA", "\u77EF", "\u785C", "\u7864",
-    "\u7868", "\u786F", "\u7899", "\u78A9", "\u78AD", "\u78B8", "\u78BA",
-    "\u78BC", "\u78BD", "\u78D1", "\u78DA", "\u78E0", "\u78E3", "\u78E7",
-    "\u78EF", "\u78FD", "\u7904", "\u7906", "\u790E", "\u7912", "\u7919",
-    "\u7926", "\u792A", "\u792B", "\u792C", "\u7931", "\u797F", "\u798D",
-    "\u798E", "\u7995", "\u79A1", "\u79A6", "\u79AA", "\u79AE", "\u79B0",
-    "\u79B1", "\u79BF", "\u79C8", "\u7A05", "\u7A08", "\u7A0F", "\u7A1F",
-    "\u7A2E", "\u7A31", "\u7A40", "\u7A4C", "\u7A4D", "\u7A4E", "\u7A60",
-    "\u7A61", "\u7A62", "\u7A69", "\u7A6B", "\u7A6D", "\u7AA9", "\u7AAA",
-    "\u7AAE", "\u7AAF", "\u7AB5", "\u7AB6", "\u7ABA", "\u7AC4", "\u7AC5",
-    "\u7AC7", "\u7ACA", "\u7AF6", "\u7B46", "\u7B4D", "\u7B67", "\u7B74",
-    "\u7B8B", "\u7B8F", "\u7BC0", "\u7BC4", "\u7BC9", "\u7BCB", "\u7BD4",
-    "\u7BD8", "\u7BE4", "\u7BE9", "\u7BF3", "\u7C00", "\u7C0D", "\u7C1E",
-    "\u7C21", "\u7C23", "\u7C2B", "\u7C39", "\u7C3D", "\u7C3E", "\u7C43",
-    "\u7C4B", "\u7C4C", "\u7C54", "\u7C59", "\u7C5B", "\u7C5C", "\u7C5F",
-    "\u7C60", "\u7C69", "\u7C6A", "\u7C6C", "\u7C6E", "\u7CB5", "\u7CDD",
-    "\u7CDE", "\u7CE7", "\u7CF2", "\u7CF4", "\u7CF6", "\u7CF9", "\u7CFE",
-    "\u7D00", "\u7D02", "\u7D04", "\u7D05", "\u7D06", "\u7D07", "\u7D08",
-    "\u7D09", "\u7D0B", "\u7D0D", "\u7D10", "\u7D13", "\u7D14", "\u7D15",
-    "\u7D16", "\u7D17", "\u7D18", "\u7D19", "\u7D1A", "\u7D1B", "\u7D1C",
-    "\u7D1D", "\u7D21", "\u7D2C", "\u7D30", "\u7D31", "\u7D32", "\u7D33",
-    "\u7D35", "\u7D39", "\u7D3A", "\u7D3C", "\u7D3F", "\u7D40", "\u7D42",
-    "\u7D44", "\u7D45", "\u7D46", "\u7D4E", "\u7D50", "\u7D55", "\u7D5B",
-    "\u7D5D", "\u7D5E", "\u7D61", "\u7D62", "\u7D66", "\u7D68", "\u7D70",
-    "\u7D71", "\u7D72", "\u7D73", "\u7D79", "\u7D7A", "\u7D80", "\u7D81",
-    "\u7D83", "\u7D86", "\u7D87", "\u7D88", "\u7D8C", "\u7D8F", "\u7D90",
-    "\u7D93", "\u7D9C", "\u7D9E", "\u7DA0", "\u7DA2", "\u7DA3", "\u7DAC",
-    "\u7DAD", "\u7DAF", "\u7DB0", "\u7DB1", "\u7DB2", "\u7DB4", "\u7DB5",
-    "\u7DB8", "\u7DB9", "\u7DBA", "\u7DBB", "\u7DBD", "\u7DBE", "\u7DBF",
-    "\u7DC4", "\u7DC7", "\u7DCA", "\u7DCB", "\u7DCD", "\u7DD2", "\u7DD3",
-    "\u7DD7", "\u7DD8", "\u7DD9", "\u7DDA", "\u7DDD", "\u7DDE", "\u7DE0",
-    "\u7DE1", "\u7DE3", "\u7DE6", "\u7DE8", "\u7DE9", "\u7DEC", "\u7DEF",
-    "\u7DF0", "\u7DF1", "\u7DF2", "\u7DF4", "\u7DF6", "\u7DF7", "\u7DF8",
-    "\u7DF9", "\u7DFB", "\u7E08", "\u7E09", "\u7E0A", "\u7E0B", "\u7E0E",
-    "\u7E10", "\u7E11", "\u7E15", "\u7E17", "\u7E1B", "\u7E1D", "\u7E1E",
-    "\u7E1F", "\u7E23", "\u7E2B", "\u7E2C", "\u7E2D", "\u7E2E", "\u7E31",
-    "\u7E32", "\u7E33", "\u7E35", "\u7E36", "\u7E37", "\u7E39", "\u7E3A",
-    "\u7E3D", "\u7E3E", "\u7E43", "\u7E45", "\u7E46", "\u7E4F", "\u7E52",
-    "\u7E53", "\u7E54", "\u7E55", "\u7E5A", "\u7E5E", "\u7E5F", "\u7E61",
-    "\u7E62", "\u7E69", "\u7E6A", "\u7E6B", "\u7E6D", "\u7E6F", "\u7E70",
-    "\u7E73", "\u7E78", "\u7E79", "\u7E7B", "\u7E7C", "\u7E7D", "\u7E7E",
-    "\u7E7F", "\u7E81", "\u7E87", "\u7E88", "\u7E8A", "\u7E8C", "\u7E8D",
-    "\u7E8F", "\u7E93", "\u7E96", "\u7E98", "\u7E9C", "\u7F3D", "\u7F48",
-    "\u7F4C", "\u7F70", "\u7F75", "\u7F77", "\u7F85", "\u7F86", "\u7F88",
-    "\u7F8B", "\u7FA5", "\u7FA9", "\u7FD2", "\u7FEC", "\u7FF9", "\u7FFD",
-    "\u802C", "\u802E", "\u8056", "\u805E", "\u806F", "\u8070", "\u8072",
-    "\u8073", "\u8075", "\u8076", "\u8077", "\u8079", "\u807D", "\u807E",
-    "\u8085", "\u8105", "\u8108", "\u811B", "\u8125", "\u812B", "\u8139",
-    "\u814E", "\u8156", "\u8161", "\u8166", "\u816A", "\u816B", "\u8173",
-    "\u8178", "\u8183", "\u8195", "\u819A", "\u81A0", "\u81A2", "\u81A9",
-    "\u81BD", "\u81BE", "\u81BF", "\u81C9", "\u81CD", "\u81CF", "\u81D7",
-    "\u81D8", "\u81DA", "\u81DF", "\u81E0", "\u81E2", "\u81E8", "\u81FA",
-    "\u8207", "\u8208", "\u8209", "\u820A", "\u8259", "\u8264", "\u8266",
-    "\u826B", "\u8271", "\u8277", "\u82BB", "\u82E7", "\u8332", "\u834A",
-    "\u838A", "\u8396", "\u83A2", "\u83A7", "\u83EF", "\u8407", "\u840A",
-    "\u842C", "\u8434", "\u8435", "\u8449", "\u8452", "\u8457", "\u8464",
-    "\u8466", "\u8477", "\u8494", "\u849E", "\u84BC", "\u84C0", "\u84CB",
-    "\u84EE", "\u84EF", "\u84F4", "\u84FD", "\u851E", "\u8523", "\u8525",
-    "\u8526", "\u852D", "\u8541", "\u8546", "\u854E", "\u8552", "\u8553",
-    "\u8555", "\u8558", "\u8562", "\u8569", "\u856A", "\u856D", "\u8577",
-    "\u8580", "\u8588", "\u858A", "\u858C", "\u8594", "\u8598", "\u859F",
-    "\u85A6", "\u85A9", "\u85B3", "\u85B4", "\u85BA", "\u85CD", "\u85CE",
-    "\u85DD", "\u85E5", "\u85EA", "\u85F6", "\u85F9", "\u85FA", "\u8604",
-    "\u8606", "\u8607", "\u860A", "\u860B", "\u861A", "\u861E", "\u8622",
-    "\u862D", "\u863A", "\u863F", "\u8646", "\u8655", "\u865B", "\u865C",
-    "\u865F", "\u8667", "\u866F", "\u86FA", "\u86FB", "\u8706", "\u8721",
-    "\u8755", "\u875F", "\u8766", "\u8778", "\u8784", "\u879E", "\u87A2",
-    "\u87AE", "\u87BB", "\u87BF", "\u87C4", "\u87C8", "\u87CE", "\u87E3",
-    "\u87EC", "\u87EF", "\u87F2", "\u87F6", "\u87FB", "\u8801", "\u8805",
-    "\u8806", "\u8810", "\u8811", "\u881F", "\u8823", "\u8828", "\u8831",
-    "\u8836", "\u883B", "\u8853", "\u8855", "\u885A", "\u885B", "\u885D",
-    "\u889E", "\u88CA", "\u88DC", "\u88DD", "\u88E1", "\u88FD", "\u8907",
-    "\u890C", "\u8918", "\u8932", "\u8933", "\u8938", "\u893B", "\u8940",
-    "\u8949", "\u894F", "\u8956", "\u895D", "\u8960", "\u8964", "\u896A",
-    "\u896C", "\u896F", "\u8972", "\u8974", "\u8986", "\u898B", "\u898E",
-    "\u898F", "\u8993", "\u8996", "\u8998", "\u89A1", "\u89A5", "\u89A6",
-    "\u89AA", "\u89AC", "\u89AF", "\u89B2", "\u89B7", "\u89BA", "\u89BC",
-    "\u89BD", "\u89BF", "\u89C0", "\u89F4", "\u89F6", "\u89F8", "\u8A01",
-    "\u8A02", "\u8A03", "\u8A08", "\u8A0A", "\u8A0C", "\u8A0E", "\u8A10",
-    "\u8A11", "\u8A12", "\u8A13", "\u8A15", "\u8A16", "\u8A17", "\u8A18",
-    "\u8A1B", "\u8A1D", "\u8A1F", "\u8A22", "\u8A23", "\u8A25", "\u8A29",
-    "\u8A2A", "\u8A2D", "\u8A31", "\u8A34", "\u8A36", "\u8A3A", "\u8A3B",
-    "\u8A40", "\u8A41", "\u8A46", "\u8A4E", "\u8A50", "\u8A51", "\u8A52",
-    "\u8A54", "\u8A55", "\u8A56", "\u8A57", "\u8A58", "\u8A5B", "\u8A5E",
-    "\u8A60", "\u8A61", "\u8A62", "\u8A63", "\u8A66", "\u8A69", "\u8A6B",
-    "\u8A6C", "\u8A6D", "\u8A6E", "\u8A70", "\u8A71", "\u8A72", "\u8A73",
-    "\u8A75", "\u8A7C", "\u8A7F", "\u8A84", "\u8A85", "\u8A86", "\u8A87",
-    "\u8A8C", "\u8A8D", "\u8A91", "\u8A92", "\u8A95", "\u8A98", "\u8A9A",
-    "\u8A9E", "\u8AA0", "\u8AA1", "\u8AA3", "\u8AA4", "\u8AA5", "\u8AA6",
-    "\u8AA8", "\u8AAA", "\u8AB0", "\u8AB2", "\u8AB6", "\u8AB9", "\u8ABC",
-    "\u8ABE", "\u8ABF", "\u8AC2", "\u8AC4", "\u8AC7", "\u8AC9", "\u8ACB",
-    "\u8ACD", "\u8ACF", "\u8AD1", "\u8AD2", "\u8AD6", "\u8AD7", "\u8ADB",
-    "\u8ADC", "\u8ADD", "\u8ADE", "\u8AE2", "\u8AE4", "\u8AE6", "\u8AE7",
-    "\u8AEB", "\u8AED", "\u8AEE", "\u8AF0", "\u8AF1", "\u8AF3", "\u8AF6",
-    "\u8AF7", "\u8AF8", "\u8AFA", "\u8AFC", "\u8AFE", "\u8B00", "\u8B01",
-    "\u8B02", "\u8B04", "\u8B05", "\u8B0A", "\u8B0E", "\u8B0F", "\u8B10",
-    "\u8B14", "\u8B16", "\u8B17", "\u8B19", "\u8B1A", "\u8B1B", "\u8B1D",
-    "\u8B20", "\u8B28", "\u8B2B", "\u8B2C", "\u8B33", "\u8B39", "\u8B3E",
-    "\u8B49", "\u8B4A", "\u8B4E", "\u8B4F", "\u8B56", "\u8B58", "\u8B59",
-    "\u8B5A", "\u8B5C", "\u8B6B", "\u8B6F", "\u8B70", "\u8B74", "\u8B77",
-    "\u8B78", "\u8B7D", "\u8B7E", "\u8B80", "\u8B8A", "\u8B8B", "\u8B8C",
-    "\u8B8E", "\u8B92", "\u8B93", "\u8B95", "\u8B96", "\u8B9C", "\u8B9E",
-    "\u8C48", "\u8C4E", "\u8C50", "\u8C6C", "\u8C76", "\u8C93", "\u8C99",
-    "\u8C9D", "\u8C9E", "\u8C9F", "\u8CA0", "\u8CA1", "\u8CA2", "\u8CA7",
-    "\u8CA8", "\u8CA9", "\u8CAA", "\u8CAB", "\u8CAC", "\u8CAF", "\u8CB0",
-    "\u8CB2", "\u8CB3", "\u8CB4", "\u8CB6", "\u8CB7", "\u8CB8", "\u8CBA",
-    "\u8CBB", "\u8CBC", "\u8CBD", "\u8CBF", "\u8CC0", "\u8CC1", "\u8CC2",
-    "\u8CC3", "\u8CC4", "\u8CC5", "\u8CC7", "\u8CC8", "\u8CCA", "\u8CD1",
-    "\u8CD2", "\u8CD3", "\u8CD5", "\u8CD9", "\u8CDA", "\u8CDC", "\u8CDE",
-    "\u8CDF", "\u8CE0", "\u8CE1", "\u8CE2", "\u8CE3", "\u8CE4", "\u8CE6",
-    "\u8CE7", "\u8CEA", "\u8CEC", "\u8CED", "\u8CF0", "\u8CF4", "\u8CF5",
-    "\u8CFA", "\u8CFB", "\u8CFC", "\u8CFD", "\u8CFE", "\u8D03", "\u8D04",
-    "\u8D05", "\u8D07", "\u8D08", "\u8D0A", "\u8D0D", "\u8D0F", "\u8D10",
-    "\u8D13", "\u8D14", "\u8D16", "\u8D17", "\u8D1B", "\u8D6C", "\u8D95",
-    "\u8D99", "\u8DA8", "\u8DB2", "\u8DE1", "\u8E10", "\u8E34", "\u8E4C",
-    "\u8E55", "\u8E63", "\u8E64", "\u8E7A", "\u8E7B", "\u8E82", "\u8E89",
-    "\u8E8A", "\u8E8B", "\u8E8D", "\u8E8E", "\u8E91", "\u8E92", "\u8E93",
-    "\u8E95", "\u8E9A", "\u8E9D", "\u8EA1", "\u8EA5", "\u8EA6", "\u8EAA",
-    "\u8EC0", "\u8EC9", "\u8ECA", "\u8ECB", "\u8ECC", "\u8ECD", "\u8ECF",
-    "\u8ED1", "\u8ED2", "\u8ED4", "\u8ED7", "\u8EDB", "\u8EDF", "\u8EE4",
-    "\u8EE8", "\u8EEB", "\u8EF2", "\u8EF8", "\u8EF9", "\u8EFA", "\u8EFB",
-    "\u8EFC", "\u8EFE", "\u8F03", "\u8F04", "\u8F05", "\u8F07", "\u8F08",
-    "\u8F09", "\u8F0A", "\u8F12", "\u8F13", "\u8F14", "\u8F15", "\u8F17",
-    "\u8F1B", "\u8F1C", "\u8F1D", "\u8F1E", "\u8F1F", "\u8F25", "\u8F26",
-    "\u8F29", "\u8F2A", "\u8F2C", "\u8F2E", "\u8F2F", "\u8F33", "\u8F38",
-    "\u8F3B", "\u8F3E", "\u8F3F", "\u8F40", "\u8F42", "\u8F44", "\u8F45",
-    "\u8F46", "\u8F49", "\u8F4D", "\u8F4E", "\u8F54", "\u8F5F", "\u8F61",
-    "\u8F62", "\u8F63", "\u8F64", "\u8FA6", "\u8FAD", "\u8FAE", "\u8FAF",
-    "\u8FB2", "\u9015", "\u9019", "\u9023", "\u9032", "\u904B", "\u904E",
-    "\u9054", "\u9055", "\u9059", "\u905C", "\u905E", "\u9060", "\u9069",
-    "\u9072", "\u9077", "\u9078", "\u907A", "\u907C", "\u9081", "\u9084",
-    "\u9087", "\u908A", "\u908F", "\u9090", "\u90DF", "\u90F5", "\u9106",
-    "\u9109", "\u9112", "\u9114", "\u9116", "\u9127", "\u912D", "\u9130",
-    "\u9132", "\u9134", "\u9136", "\u913A", "\u9147", "\u9148", "\u919C",
-    "\u919E", "\u91AB", "\u91AC", "\u91B1", "\u91C0", "\u91C1", "\u91C3",
-    "\u91C5", "\u91CB", "\u91D0", "\u91D2", "\u91D3", "\u91D4", "\u91D5",
-    "\u91D7", "\u91D8", "\u91D9", "\u91DD", "\u91E3", "\u91E4", "\u91E7",
-    "\u91E9", "\u91F3", "\u91F5", "\u91F7", "\u91F9", "\u91FA", "\u91FE",
-    "\u9200", "\u9201", "\u9203", "\u9204", "\u9207", "\u9208", "\u9209",
-    "\u920B", "\u920D", "\u9210", "\u9211", "\u9212", "\u9214", "\u9215",
-    "\u921E", "\u9220", "\u9223", "\u9225", "\u9226", "\u9227", "\u922E",
-    "\u922F", "\u9230", "\u9232", "\u9233", "\u9234", "\u9237", "\u9238",
-    "\u9239", "\u923A", "\u923D", "\u923E", "\u923F", "\u9240", "\u9241",
-    "\u9245", "\u9248", "\u9249", "\u924B", "\u924D", "\u9251", "\u9255",
-    "\u9257", "\u925A", "\u925B", "\u925E", "\u9264", "\u9266", "\u926C",
-    "\u926D", "\u9276", "\u9278", "\u927A", "\u927B", "\u927F", "\u9280",
-    "\u9283", "\u9285", "\u928D", "\u9291", "\u9293", "\u9296", "\u9298",
-    "\u929A", "\u929B", "\u929C", "\u92A0", "\u92A3", "\u92A5", "\u92A6",
-    "\u92A8", "\u92A9", "\u92AA", "\u92AB", "\u92AC", "\u92B1", "\u92B3",
-    "\u92B6", "\u92B7", "\u92BB", "\u92BC", "\u92C1", "\u92C3", "\u92C5",
-    "\u92C7", "\u92C9", "\u92CC", "\u92CF", "\u92D2", "\u92D9", "\u92DD",
-    "\u92DF", "\u92E3", "\u92E4", "\u92E5", "\u92E6", "\u92E8", "\u92E9",
-    "\u92EA", "\u92EE", "\u92EF", "\u92F0", "\u92F1", "\u92F6", "\u92F8",
-    "\u92FC", "\u9301", "\u9302", "\u9304", "\u9306", "\u9307", "\u9308",
-    "\u930F", "\u9310", "\u9312", "\u9315", "\u9318", "\u9319", "\u931A",
-    "\u931B", "\u931F", "\u9320", "\u9321", "\u9322", "\u9326", "\u9328",
-    "\u9329", "\u932B", "\u932E", "\u932F", "\u9333", "\u9336", "\u9338",
-    "\u9340", "\u9343", "\u9344", "\u9346", "\u9347", "\u9348", "\u934B",
-    "\u934D", "\u9354", "\u9358", "\u935A", "\u935B", "\u9360", "\u9364",
-    "\u9365", "\u9369", "\u936C", "\u936E", "\u9370", "\u9375", "\u9376",
-    "\u937A", "\u937E", "\u9382", "\u9384", "\u9387", "\u938A", "\u9394",
-    "\u9396", "\u9398", "\u939B", "\u939D", "\u93A1", "\u93A2", "\u93A3",
-    "\u93A6", "\u93A7", "\u93A9", "\u93AA", "\u93AC", "\u93AE", "\u93AF",
-    "\u93B0", "\u93B2", "\u93B3", "\u93B5", "\u93B7", "\u93BF", "\u93C3",
-    "\u93C6", "\u93C7", "\u93C8", "\u93C9", "\u93CC", "\u93CD", "\u93D0",
-    "\u93D1", "\u93D7", "\u93D8", "\u93DC", "\u93DD", "\u93DE", "\u93DF",
-    "\u93E1", "\u93E2", "\u93E4", "\u93E6", "\u93E8", "\u93F0", "\u93F5",
-    "\u93F7", "\u93F9", "\u93FA", "\u93FD", "\u9403", "\u9404", "\u940B",
-    "\u940D", "\u940E", "\u940F", "\u9410", "\u9412", "\u9413", "\u9414",
-    "\u9418", "\u9419", "\u9420", "\u9425", "\u9426", "\u9427", "\u9428",
-    "\u942B", "\u942E", "\u942F", "\u9432", "\u9433", "\u9435", "\u9436",
-    "\u9438", "\u943A", "\u943F", "\u9444", "\u944A", "\u944C", "\u9452",
-    "\u9454", "\u9455", "\u945E", "\u9460", "\u9463", "\u9465", "\u946D",
-    "\u9470", "\u9471", "\u9472", "\u9477", "\u9479", "\u947C", "\u947D",
-    "\u947E", "\u947F", "\u9481", "\u9577", "\u9580", "\u9582", "\u9583",
-    "\u9586", "\u9588", "\u9589", "\u958B", "\u958C", "\u958D", "\u958E",
-    "\u958F", "\u9590", "\u9591", "\u9593", "\u9594", "\u9598", "\u95A1",
-    "\u95A3", "\u95A5", "\u95A8", "\u95A9", "\u95AB", "\u95AC", "\u95AD",
-    "\u95B1", "\u95B6", "\u95B9", "\u95BB", "\u95BC", "\u95BD", "\u95BE",
-    "\u95BF", "\u95C3", "\u95C6", "\u95C8", "\u95CA", "\u95CB", "\u95CC",
-    "\u95CD", "\u95D0", "\u95D2", "\u95D3", "\u95D4", "\u95D5", "\u95D6",
-    "\u95DC", "\u95DE", "\u95E0", "\u95E1", "\u95E4", "\u95E5", "\u962A",
-    "\u9658", "\u965D", "\u9663", "\u9670", "\u9673", "\u9678", "\u967D",
-    "\u9689", "\u968A", "\u968E", "\u9695", "\u969B", "\u96A8", "\u96AA",
-    "\u96B1", "\u96B4", "\u96B8", "\u96BB", "\u96CB", "\u96D6", "\u96D9",
-    "\u96DB", "\u96DC", "\u96DE", "\u96E2", "\u96E3", "\u96F2", "\u96FB",
-    "\u9722", "\u9727", "\u973D", "\u9742", "\u9744", "\u9748", "\u975A",
-    "\u975C", "\u9766", "\u9768", "\u9780", "\u978F", "\u979D", "\u97BD",
-    "\u97C1", "\u97C3", "\u97C9", "\u97CB", "\u97CC", "\u97CD", "\u97D3",
-    "\u97D9", "\u97DC", "\u97DE", "\u97FB", "\u97FF", "\u9801", "\u9802",
-    "\u9803", "\u9805", "\u9806", "\u9807", "\u9808", "\u980A", "\u980C",
-    "\u980E", "\u980F", "\u9810", "\u9811", "\u9812", "\u9813", "\u9817",
-    "\u9818", "\u981C", "\u9821", "\u9824", "\u9826", "\u982D", "\u982E",
-    "\u9830", "\u9832", "\u9834", "\u9837", "\u9838", "\u9839", "\u983B",
-    "\u9843", "\u9846", "\u984C", "\u984D", "\u984E", "\u984F", "\u9852",
-    "\u9853", "\u9858", "\u9859", "\u985B", "\u985E", "\u9862", "\u9865",
-    "\u9867", "\u986B", "\u986C", "\u986F", "\u9870", "\u9871", "\u9873",
-    "\u9874", "\u98A8", "\u98AD", "\u98AE", "\u98AF", "\u98B0", "\u98B1",
-    "\u98B3", "\u98B6", "\u98B7", "\u98B8", "\u98BA", "\u98BB", "\u98BC",
-    "\u98BE", "\u98C0", "\u98C4", "\u98C6", "\u98C8", "\u98DB", "\u98E0",
-    "\u98E2", "\u98E3", "\u98E5", "\u98E9", "\u98EA", "\u98EB", "\u98ED",
-    "\u98EF", "\u98F2", "\u98F4", "\u98FC", "\u98FD", "\u98FE", "\u98FF",
-    "\u9903", "\u9904", "\u9905", "\u9909", "\u990A", "\u990C", "\u990E",
-    "\u990F", "\u9911", "\u9912", "\u9913", "\u9914", "\u9915", "\u9916",
-    "\u9917", "\u9918", "\u991A", "\u991B", "\u991C", "\u991E", "\u9921",
-    "\u9926", "\u9928", "\u992D", "\u9931", "\u9933", "\u9936", "\u9937",
-    "\u9938", "\u993A", "\u993C", "\u993E", "\u993F", "\u9941", "\u9943",
-    "\u9945", "\u9948", "\u9949", "\u994A", "\u994B", "\u994C", "\u9952",
-    "\u9957", "\u9958", "\u995C", "\u995E", "\u9962", "\u99AC", "\u99AD",
-    "\u99AE", "\u99B1", "\u99B3", "\u99B4", "\u99B9", "\u99C1", "\u99C3",
-    "\u99CE", "\u99D0", "\u99D1", "\u99D2", "\u99D4", "\u99D5", "\u99D8",
-    "\u99D9", "\u99DA", "\u99DB", "\u99DD", "\u99DF", "\u99E2", "\u99E7",
-    "\u99E9", "\u99ED", "\u99F0", "\u99F1", "\u99F6", "\u99F8", "\u99FB",
-    "\u99FF", "\u9A01", "\u9A02", "\u9A03", "\u9A05", "\u9A0C", "\u9A0D",
-    "\u9A0E", "\u9A0F", "\u9A14", "\u9A16", "\u9A19", "\u9A1A", "\u9A1D",
-    "\u9A1F", "\u9A20", "\u9A24", "\u9A27", "\u9A2A", "\u9A2B", "\u9A2D",
-    "\u9A2E", "\u9A30", "\u9A36", "\u9A37", "\u9A38", "\u9A3E", "\u9A40",
-    "\u9A41", "\u9A42", "\u9A43", "\u9A44", "\u9A45", "\u9A4A", "\u9A4B",
-    "\u9A4C", "\u9A4D", "\u9A4F", "\u9A55", "\u9A57", "\u9A5A", "\u9A5B",
-    "\u9A5F", "\u9A62", "\u9A64", "\u9A65", "\u9A66", "\u9A6A", "\u9A6B",
-    "\u9AAF", "\u9ACF", "\u9AD2", "\u9AD4", "\u9AD5", "\u9AD6", "\u9AEE",
-    "\u9B06", "\u9B0D", "\u9B1A", "\u9B22", "\u9B25", "\u9B27", "\u9B29",
-    "\u9B2E", "\u9B31", "\u9B4E", "\u9B58", "\u9B5A", "\u9B5B", "\u9B5F",
-    "\u9B62", "\u9B65", "\u9B68", "\u9B6F", "\u9B74", "\u9B77", "\u9B7A",
-    "\u9B81", "\u9B83", "\u9B84", "\u9B8A", "\u9B8B", "\u9B8D", "\u9B90",
-    "\u9B91", "\u9B92", "\u9B93", "\u9B9A", "\u9B9C", "\u9B9E", "\u9B9F",
-    "\u9BA3", "\u9BA6", "\u9BAA", "\u9BAB", "\u9BAD", "\u9BAE", "\u9BB0",
-    "\u9BB3", "\u9BB6", "\u9BB8", "\u9BBA", "\u9BC0", "\u9BC1", "\u9BC4",
-    "\u9BC6", "\u9BC7", "\u9BC9", "\u9BCA", "\u9BD2", "\u9BD4", "\u9BD5",
-    "\u9BD6", "\u9BD7", "\u9BDB", "\u9BDD", "\u9BE1", "\u9BE2", "\u9BE4",
-    "\u9BE7", "\u9BE8", "\u9BEA", "\u9BEB", "\u9BF1", "\u9BF4", "\u9BF6",
-    "\u9BF7", "\u9BFD", "\u9BFF", "\u9C01", "\u9C02", "\u9C03", "\u9C06",
-    "\u9C08", "\u9C09", "\u9C0C", "\u9C0D", "\u9C0F", "\u9C12", "\u9C13",
-    "\u9C1C", "\u9C1F", "\u9C20", "\u9C23", "\u9C24", "\u9C25", "\u9C27",
-    "\u9C28", "\u9C29", "\u9C2D", "\u9C2E", "\u9C31", "\u9C32", "\u9C33",
-    "\u9C35", "\u9C37", "\u9C39", "\u9C3A", "\u9C3B", "\u9C3C", "\u9C3E",
-    "\u9C42", "\u9C45", "\u9C47", "\u9C48", "\u9C49", "\u9C52", "\u9C54",
-    "\u9C56", "\u9C57", "\u9C58", "\u9C5D", "\u9C5F", "\u9C60", "\u9C63",
-    "\u9C64", "\u9C67", "\u9C68", "\u9C6D", "\u9C6E", "\u9C6F", "\u9C77",
-    "\u9C78", "\u9C7A", "\u9CE5", "\u9CE7", "\u9CE9", "\u9CF2", "\u9CF3",
-    "\u9CF4", "\u9CF6", "\u9CF7", "\u9CFC", "\u9CFE", "\u9D03", "\u9D06",
-    "\u9D07", "\u9D09", "\u9D12", "\u9D15", "\u9D17", "\u9D1B", "\u9D1C",
-    "\u9D1D", "\u9D1E", "\u9D1F", "\u9D23", "\u9D26", "\u9D28", "\u9D2F",
-    "\u9D30", "\u9D32", "\u9D34", "\u9D37", "\u9D3B", "\u9D3F", "\u9D41",
-    "\u9D42", "\u9D43", "\u9D50", "\u9D51", "\u9D52", "\u9D53", "\u9D5A",
-    "\u9D5C", "\u9D5D", "\u9D60", "\u9D61", "\u9D6A", "\u9D6C", "\u9D6E",
-    "\u9D6F", "\u9D72", "\u9D77", "\u9D7E", "\u9D84", "\u9D87", "\u9D89",
-    "\u9D8A", "\u9D92", "\u9D93", "\u9D96", "\u9D97", "\u9D98", "\u9D9A",
-    "\u9DA1", "\u9DA5", "\u9DA9", "\u9DAA", "\u9DAC", "\u9DAF", "\u9DB2",
-    "\u9DB4", "\u9DB9", "\u9DBA", "\u9DBB", "\u9DBC", "\u9DBF", "\u9DC1",
-    "\u9DC2", "\u9DC8", "\u9DCA", "\u9DD3", "\u9DD4", "\u9DD6", "\u9DD7",
-    "\u9DD9", "\u9DDA", "\u9DE5", "\u9DE6", "\u9DE8", "\u9DEB", "\u9DEF",
-    "\u9DF2", "\u9DF3", "\u9DF8", "\u9DF9", "\u9DFA", "\u9DFD", "\u9DFF",
-    "\u9E02", "\u9E07", "\u9E0B", "\u9E0C", "\u9E0F", "\u9E15", "\u9E18",
-    "\u9E1A", "\u9E1B", "\u9E1D", "\u9E1E", "\u9E75", "\u9E79", "\u9E7A",
-    "\u9E7C", "\u9E7D", "\u9E97", "\u9EA5", "\u9EA8", "\u9EA9", "\u9EB2",
-    "\u9EB5", "\u9EBC", "\u9EBD", "\u9EC3", "\u9ECC", "\u9EDE", "\u9EE8",
-    "\u9EF2", "\u9EF6", "\u9EF7", "\u9EFD", "\u9EFF", "\u9F09", "\u9F34",
-    "\u9F4A", "\u9F4B", "\u9F4E", "\u9F4F", "\u9F52", "\u9F54", "\u9F55",
-    "\u9F57", "\u9F59", "\u9F5C", "\u9F5F", "\u9F60", "\u9F61", "\u9F66",
-    "\u9F6A", "\u9F6C", "\u9F72", "\u9F76", "\u9F77", "\u9F8D", "\u9F8E",
-    "\u9F90", "\u9F91", "\u9F94", "\u9F95", "\u9F9C", "\u9FAD", "\u9FAF",
+constexpr char16_t TRADITIONAL_CHINESE_CHARS[] = {
+    u'\u346F', u'\u3473', u'\u3493', u'\u34E8', u'\u35F2', u'\u361A', u'\u3704',
+    u'\u370F', u'\u3722', u'\u3737', u'\u379E', u'\u380F', u'\u389D', u'\u396E',
+    u'\u398E', u'\u3A5C', u'\u3A73', u'\u3DFF', u'\u3E8F', u'\u3FE7', u'\u4039',
+    u'\u406A', u'\u407B', u'\u4259', u'\u426C', u'\u4272', u'\u42AD', u'\u42B7',
+    u'\u42D9', u'\u42DA', u'\u42FB', u'\u42FF', u'\u4308', u'\u430B', u'\u4316',
+    u'\u431D', u'\u431F', u'\u4325', u'\u4330', u'\u4573', u'\u45FF', u'\u4661',
+    u'\u4700', u'\u477B', u'\u477C', u'\u4788', u'\u48A8', u'\u4947', u'\u4969',
+    u'\u4971', u'\u4998', u'\u499B', u'\u499F', u'\u49B3', u'\u49E2', u'\u4A8F',
+    u'\u4A97', u'\u4A98', u'\u4AF4', u'\u4B18', u'\u4B1D', u'\u4B1E', u'\u4B40',
+    u'\u4B43', u'\u4B7F', u'\u4B9D', u'\u4B9E', u'\u4BA0', u'\u4BAB', u'\u4BB3',
+    u'\u4BBE', u'\u4BC0', u'\u4C3E', u'\u4C59', u'\u4C6C', u'\u4C70', u'\u4C77',
+    u'\u4C7D', u'\u4C81', u'\u4C96', u'\u4CB0', u'\u4D09', u'\u4D2C', u'\u4D34',
+    u'\u4E1F', u'\u4E26', u'\u4E7E', u'\u4E82', u'\u4E9E', u'\u4F47', u'\u4F59',
+    u'\u4F75', u'\u4F86', u'\u4F96', u'\u4FB6', u'\u4FC1', u'\u4FC2', u'\u4FD4',
+    u'\u4FE0', u'\u4FE5', u'\u5000', u'\u5006', u'\u5008', u'\u5009', u'\u500B',
+    u'\u5011', u'\u502B', u'\u5032', u'\u5049', u'\u5051', u'\u5074', u'\u5075',
+    u'\u507D', u'\u5091', u'\u5096', u'\u5098', u'\u5099', u'\u50AD', u'\u50AF',
+    u'\u50B3', u'\u50B4', u'\u50B5', u'\u50B7', u'\u50BE', u'\u50C2', u'\u50C5',
+    u'\u50C9', u'\u50D1', u'\u50D5', u'\u50DE', u'\u50E5', u'\u50E8', u'\u50F9',
+    u'\u5100', u'\u5102', u'\u5104', u'\u5108', u'\u5109', u'\u5110', u'\u5114',
+    u'\u5115', u'\u5118', u'\u511F', u'\u5123', u'\u512A', u'\u5132', u'\u5137',
+    u'\u5138', u'\u513A', u'\u513B', u'\u513C', u'\u514C', u'\u5152', u'\u5157',
+    u'\u5167', u'\u5169', u'\u518A', u'\u51AA', u'\u51C8', u'\u51CD', u'\u51D9',
+    u'\u51DC', u'\u51F1', u'\u5225', u'\u522A', u'\u5244', u'\u5247', u'\u524B',
+    u'\u524E', u'\u5257', u'\u525B', u'\u525D', u'\u526E', u'\u5274', u'\u5275',
+    u'\u527E', u'\u5283', u'\u5287', u'\u5289', u'\u528A', u'\u528C', u'\u528D',
+    u'\u528F', u'\u5291', u'\u529A', u'\u52C1', u'\u52D5', u'\u52D9', u'\u52DB',
+    u'\u52DD', u'\u52DE', u'\u52E2', u'\u52E9', u'\u52F1', u'\u52F5', u'\u52F8',
+    u'\u52FB', u'\u532D', u'\u532F', u'\u5331', u'\u5340', u'\u5354', u'\u537B',
+    u'\u5399', u'\u53AD', u'\u53B2', u'\u53B4', u'\u53C3', u'\u53C4', u'\u53E2',
+    u'\u53F0', u'\u540E', u'\u5412', u'\u5433', u'\u5436', u'\u5442', u'\u54BC',
+    u'\u54E1', u'\u54EF', u'\u5504', u'\u551A', u'\u554F', u'\u555E', u'\u555F',
+    u'\u5562', u'\u558E', u'\u559A', u'\u55AA', u'\u55AC', u'\u55AE', u'\u55B2',
+    u'\u55C6', u'\u55C7', u'\u55CA', u'\u55CE', u'\u55DA', u'\u55E9', u'\u55F6',
+    u'\u55F9', u'\u5606', u'\u560D', u'\u5613', u'\u5614', u'\u5616', u'\u5617',
+    u'\u561C', u'\u5629', u'\u562E', u'\u562F', u'\u5630', u'\u5635', u'\u5638',
+    u'\u563D', u'\u5645', u'\u5653', u'\u565A', u'\u565D', u'\u5660', u'\u5665',
+    u'\u5666', u'\u566F', u'\u5672', u'\u5674', u'\u5678', u'\u5679', u'\u5680',
+    u'\u5687', u'\u568C', u'\u5695', u'\u5699', u'\u56A6', u'\u56A8', u'\u56B2',
+    u'\u56B3', u'\u56B4', u'\u56B6', u'\u56C0', u'\u56C1', u'\u56C2', u'\u56C5',
+    u'\u56C8', u'\u56C9', u'\u56D1', u'\u56EA', u'\u5707', u'\u570B', u'\u570D',
+    u'\u5712', u'\u5713', u'\u5716', u'\u5718', u'\u571E', u'\u57B5', u'\u57E1',
+    u'\u57F0', u'\u57F7', u'\u5805', u'\u580A', u'\u5816', u'\u581D', u'\u582F',
+    u'\u5831', u'\u5834', u'\u584A', u'\u584B', u'\u584F', u'\u5852', u'\u5857',
+    u'\u5862', u'\u5864', u'\u5875', u'\u5879', u'\u588A', u'\u589C', u'\u58AE',
+    u'\u58B3', u'\u58BE', u'\u58C7', u'\u58C8', u'\u58CB', u'\u58D3', u'\u58D8',
+    u'\u58D9', u'\u58DA', u'\u58DE', u'\u58DF', u'\u58E0', u'\u58E2', u'\u58E9',
+    u'\u58EF', u'\u58FA', u'\u58FC', u'\u58FD', u'\u5920', u'\u5922', u'\u593E',
+    u'\u5950', u'\u5967', u'\u5969', u'\u596A', u'\u596E', u'\u597C', u'\u599D',
+    u'\u59CD', u'\u59E6', u'\u5A1B', u'\u5A41', u'\u5A66', u'\u5A6D', u'\u5AA7',
+    u'\u5AAF', u'\u5AB0', u'\u5ABC', u'\u5ABD', u'\u5AD7', u'\u5AF5', u'\u5AFB',
+    u'\u5AFF', u'\u5B08', u'\u5B0B', u'\u5B0C', u'\u5B19', u'\u5B21', u'\u5B24',
+    u'\u5B2A', u'\u5B30', u'\u5B38', u'\u5B4B', u'\u5B4C', u'\u5B6B', u'\u5B78',
+    u'\u5B7F', u'\u5BAE', u'\u5BE2', u'\u5BE6', u'\u5BE7', u'\u5BE9', u'\u5BEB',
+    u'\u5BEC', u'\u5BF5', u'\u5BF6', u'\u5C07', u'\u5C08', u'\u5C0B', u'\u5C0D',
+    u'\u5C0E', u'\u5C37', u'\u5C46', u'\u5C4D', u'\u5C53', u'\u5C5C', u'\u5C62',
+    u'\u5C64', u'\u5C68', u'\u5C69', u'\u5C6C', u'\u5CA1', u'\u5CF4', u'\u5CF6',
+    u'\u5CFD', u'\u5D0D', u'\u5D17', u'\u5D22', u'\u5D2C', u'\u5D50', u'\u5D7C',
+    u'\u5D81', u'\u5D84', u'\u5D87', u'\u5D94', u'\u5D97', u'\u5DA0', u'\u5DA2',
+    u'\u5DA7', u'\u5DAE', u'\u5DB4', u'\u5DB8', u'\u5DBA', u'\u5DBC', u'\u5DCB',
+    u'\u5DD2', u'\u5DD4', u'\u5DF0', u'\u5E25', u'\u5E2B', u'\u5E33', u'\u5E36',
+    u'\u5E40', u'\u5E43', u'\u5E57', u'\u5E58', u'\u5E5F', u'\u5E63', u'\u5E6B',
+    u'\u5E6C', u'\u5E79', u'\u5E7A', u'\u5E7E', u'\u5EAB', u'\u5EC1', u'\u5EC2',
+    u'\u5EC4', u'\u5EC8', u'\u5EDA', u'\u5EDD', u'\u5EDF', u'\u5EE0', u'\u5EE1',
+    u'\u5EE2', u'\u5EE3', u'\u5EE9', u'\u5EEC', u'\u5EF3', u'\u5F12', u'\u5F33',
+    u'\u5F35', u'\u5F37', u'\u5F48', u'\u5F4C', u'\u5F4E', u'\u5F59', u'\u5F5E',
+    u'\u5F65', u'\u5F72', u'\u5F8C', u'\u5F91', u'\u5F9E', u'\u5FA0', u'\u5FA9',
+    u'\u5FB5', u'\u5FB9', u'\u5FD7', u'\u6046', u'\u6065', u'\u6085', u'\u609E',
+    u'\u60B5', u'\u60B6', u'\u60E1', u'\u60F1', u'\u60F2', u'\u60FB', u'\u611B',
+    u'\u611C', u'\u6128', u'\u6134', u'\u6137', u'\u613E', u'\u6144', u'\u614B',
+    u'\u614D', u'\u6158', u'\u615A', u'\u615F', u'\u6163', u'\u616A', u'\u616B',
+    u'\u616E', u'\u6173', u'\u6176', u'\u6182', u'\u618A', u'\u6190', u'\u6191',
+    u'\u6192', u'\u619A', u'\u61A4', u'\u61AB', u'\u61AE', u'\u61B2', u'\u61B6',
+    u'\u61C0', u'\u61C7', u'\u61C9', u'\u61CC', u'\u61CD', u'\u61DF', u'\u61E3',
+    u'\u61E8', u'\u61F2', u'\u61F6', u'\u61F7', u'\u61F8', u'\u61FA', u'\u61FC',
+    u'\u61FE', u'\u6200', u'\u6207', u'\u6214', u'\u6227', u'\u6229', u'\u6230',
+    u'\u6231', u'\u6232', u'\u6236', u'\u62CB', u'\u6329', u'\u633E', u'\u6368',
+    u'\u636B', u'\u6383', u'\u6384', u'\u6386', u'\u6397', u'\u6399', u'\u639B',
+    u'\u63A1', u'\u63C0', u'\u63DA', u'\u63DB', u'\u63EE', u'\u640D', u'\u6416',
+    u'\u6417', u'\u6435', u'\u6436', u'\u644B', u'\u6451', u'\u645C', u'\u645F',
+    u'\u646F', u'\u6473', u'\u6476', u'\u647B', u'\u6488', u'\u648F', u'\u6490',
+    u'\u6493', u'\u649D', u'\u649F', u'\u64A3', u'\u64A5', u'\u64AB', u'\u64B2',
+    u'\u64B3', u'\u64BB', u'\u64BE', u'\u64BF', u'\u64C1', u'\u64C4', u'\u64C7',
+    u'\u64CA', u'\u64CB', u'\u64D3', u'\u64D4', u'\u64DA', u'\u64E0', u'\u64E3',
+    u'\u64EC', u'\u64EF', u'\u64F0', u'\u64F1', u'\u64F2', u'\u64F4', u'\u64F7',
+    u'\u64FA', u'\u64FB', u'\u64FC', u'\u64FD', u'\u64FE', u'\u6504', u'\u6506',
+    u'\u650F', u'\u6514', u'\u6516', u'\u6519', u'\u651B', u'\u651C', u'\u651D',
+    u'\u6522', u'\u6523', u'\u6524', u'\u652A', u'\u652C', u'\u6557', u'\u6558',
+    u'\u6575', u'\u6578', u'\u6582', u'\u6583', u'\u6585', u'\u6586', u'\u6595',
+    u'\u65AC', u'\u65B7', u'\u65BC', u'\u6642', u'\u6649', u'\u665D', u'\u6688',
+    u'\u6689', u'\u6698', u'\u66A2', u'\u66AB', u'\u66C4', u'\u66C6', u'\u66C7',
+    u'\u66C9', u'\u66CF', u'\u66D6', u'\u66E0', u'\u66E5', u'\u66E8', u'\u66EC',
+    u'\u66F8', u'\u6703', u'\u6725', u'\u6727', u'\u6771', u'\u6774', u'\u6781',
+    u'\u67F5', u'\u687F', u'\u6894', u'\u6898', u'\u689D', u'\u689F', u'\u68B2',
+    u'\u68C4', u'\u68D6', u'\u68D7', u'\u68DF', u'\u68E1', u'\u68E7', u'\u68F2',
+    u'\u68F6', u'\u690F', u'\u6932', u'\u694A', u'\u6953', u'\u6968', u'\u696D',
+    u'\u6975', u'\u69AA', u'\u69AE', u'\u69B2', u'\u69BF', u'\u69CB', u'\u69CD',
+    u'\u69E4', u'\u69E7', u'\u69E8', u'\u69F3', u'\u69F6', u'\u6A01', u'\u6A02',
+    u'\u6A05', u'\u6A13', u'\u6A19', u'\u6A1E', u'\u6A22', u'\u6A23', u'\u6A2B',
+    u'\u6A38', u'\u6A39', u'\u6A3A', u'\u6A3F', u'\u6A48', u'\u6A4B', u'\u6A5F',
+    u'\u6A62', u'\u6A6B', u'\u6A81', u'\u6A89', u'\u6A94', u'\u6A9C', u'\u6A9F',
+    u'\u6AA2', u'\u6AA3', u'\u6AAD', u'\u6AAE', u'\u6AAF', u'\u6AB3', u'\u6AB8',
+    u'\u6ABB', u'\u6AC3', u'\u6AD3', u'\u6ADA', u'\u6ADB', u'\u6ADD', u'\u6ADE',
+    u'\u6ADF', u'\u6AE5', u'\u6AE7', u'\u6AE8', u'\u6AEA', u'\u6AEB', u'\u6AEC',
+    u'\u6AF1', u'\u6AF3', u'\u6AF8', u'\u6AFB', u'\u6B04', u'\u6B0A', u'\u6B0D',
+    u'\u6B0F', u'\u6B12', u'\u6B13', u'\u6B16', u'\u6B1E', u'\u6B3D', u'\u6B50',
+    u'\u6B5F', u'\u6B61', u'\u6B72', u'\u6B77', u'\u6B78', u'\u6B7F', u'\u6B98',
+    u'\u6B9E', u'\u6BA4', u'\u6BA8', u'\u6BAB', u'\u6BAE', u'\u6BAF', u'\u6BB0',
+    u'\u6BB2', u'\u6BBA', u'\u6BBC', u'\u6BC0', u'\u6BC6', u'\u6BFF', u'\u6C02',
+    u'\u6C08', u'\u6C0C', u'\u6C23', u'\u6C2B', u'\u6C2C', u'\u6C33', u'\u6C7A',
+    u'\u6C92', u'\u6C96', u'\u6CC1', u'\u6D36', u'\u6D79', u'\u6D87', u'\u6DBC',
+    u'\u6DDA', u'\u6DE5', u'\u6DEA', u'\u6DF5', u'\u6DF6', u'\u6DFA', u'\u6E19',
+    u'\u6E1B', u'\u6E22', u'\u6E26', u'\u6E2C', u'\u6E3E', u'\u6E4A', u'\u6E5E',
+    u'\u6E6F', u'\u6E88', u'\u6E96', u'\u6E9D', u'\u6EAB', u'\u6EB3', u'\u6EC4',
+    u'\u6EC5', u'\u6ECC', u'\u6ECE', u'\u6EEC', u'\u6EEF', u'\u6EF2', u'\u6EF8',
+    u'\u6EFB', u'\u6EFE', u'\u6EFF', u'\u6F01', u'\u6F0A', u'\u6F1A', u'\u6F22',
+    u'\u6F23', u'\u6F2C', u'\u6F32', u'\u6F35', u'\u6F38', u'\u6F3F', u'\u6F41',
+    u'\u6F51', u'\u6F54', u'\u6F5B', u'\u6F64', u'\u6F6F', u'\u6F70', u'\u6F77',
+    u'\u6F7F', u'\u6F80', u'\u6F85', u'\u6F86', u'\u6F87', u'\u6F97', u'\u6FA0',
+    u'\u6FA4', u'\u6FA6', u'\u6FA9', u'\u6FAE', u'\u6FB1', u'\u6FBE', u'\u6FC1',
+    u'\u6FC3', u'\u6FC4', u'\u6FC6', u'\u6FD5', u'\u6FD8', u'\u6FDC', u'\u6FDF',
+    u'\u6FE4', u'\u6FE7', u'\u6FEB', u'\u6FF0', u'\u6FF1', u'\u6FFA', u'\u6FFC',
+    u'\u6FFE', u'\u7002', u'\u7003', u'\u7005', u'\u7006', u'\u7007', u'\u7009',
+    u'\u700B', u'\u700F', u'\u7015', u'\u7018', u'\u701D', u'\u701F', u'\u7020',
+    u'\u7026', u'\u7027', u'\u7028', u'\u7030', u'\u7032', u'\u703E', u'\u7043',
+    u'\u7044', u'\u7051', u'\u7055', u'\u7058', u'\u7059', u'\u705D', u'\u7060',
+    u'\u7061', u'\u7063', u'\u7064', u'\u7067', u'\u707D', u'\u70BA', u'\u70CF',
+    u'\u70F4', u'\u7121', u'\u7149', u'\u7152', u'\u7159', u'\u7162', u'\u7165',
+    u'\u7169', u'\u716C', u'\u7171', u'\u7185', u'\u7189', u'\u718C', u'\u7192',
+    u'\u7193', u'\u7197', u'\u71A1', u'\u71B1', u'\u71B2', u'\u71BE', u'\u71C1',
+    u'\u71C8', u'\u71D2', u'\u71D9', u'\u71DC', u'\u71DF', u'\u71E6', u'\u71ED',
+    u'\u71F4', u'\u71F6', u'\u71FC', u'\u71FE', u'\u7204', u'\u720D', u'\u7210',
+    u'\u721B', u'\u722D', u'\u723A', u'\u723E', u'\u7246', u'\u7258', u'\u727D',
+    u'\u7296', u'\u72A2', u'\u72A7', u'\u72C0', u'\u72F9', u'\u72FD', u'\u7319',
+    u'\u7336', u'\u733B', u'\u7341', u'\u7344', u'\u7345', u'\u734E', u'\u7368',
+    u'\u736A', u'\u736B', u'\u736E', u'\u7370', u'\u7371', u'\u7372', u'\u7375',
+    u'\u7377', u'\u7378', u'\u737A', u'\u737B', u'\u737C', u'\u7380', u'\u7381',
+    u'\u73FE', u'\u743A', u'\u743F', u'\u744B', u'\u7452', u'\u7463', u'\u7464',
+    u'\u7469', u'\u746A', u'\u7472', u'\u747D', u'\u7489', u'\u74A3', u'\u74A6',
+    u'\u74AB', u'\u74AF', u'\u74B0', u'\u74BD', u'\u74CA', u'\u74CF', u'\u74D4',
+    u'\u74D5', u'\u74DA', u'\u750C', u'\u7522', u'\u755D', u'\u7562', u'\u756B',
+    u'\u7570', u'\u7576', u'\u7587', u'\u758A', u'\u75D9', u'\u75FE', u'\u7602',
+    u'\u760B', u'\u760D', u'\u7613', u'\u761E', u'\u7621', u'\u7627', u'\u762E',
+    u'\u7632', u'\u763A', u'\u7642', u'\u7646', u'\u7647', u'\u7649', u'\u7658',
+    u'\u765F', u'\u7662', u'\u7664', u'\u7665', u'\u7667', u'\u7669', u'\u766C',
+    u'\u766D', u'\u766E', u'\u7670', u'\u7671', u'\u7672', u'\u767C', u'\u769A',
+    u'\u769F', u'\u76B0', u'\u76B8', u'\u76BA', u'\u76DC', u'\u76DE', u'\u76E1',
+    u'\u76E3', u'\u76E4', u'\u76E7', u'\u76EA', u'\u7725', u'\u773E', u'\u774D',
+    u'\u774F', u'\u775C', u'\u775E', u'\u7798', u'\u779C', u'\u779E', u'\u77A4',
+    u'\u77B6', u'\u77BC', u'\u77D3', u'\u77DA', u'\u77EF', u'\u785C', u'\u7864',
+    u'\u7868', u'\u786F', u'\u7899', u'\u78A9', u'\u78AD', u'\u78B8', u'\u78BA',
+    u'\u78BC', u'\u78BD', u'\u78D1', u'\u78DA', u'\u78E0', u'\u78E3', u'\u78E7',
+    u'\u78EF', u'\u78FD', u'\u7904', u'\u7906', u'\u790E', u'\u7912', u'\u7919',
+    u'\u7926', u'\u792A', u'\u792B', u'\u792C', u'\u7931', u'\u797F', u'\u798D',
+    u'\u798E', u'\u7995', u'\u79A1', u'\u79A6', u'\u79AA', u'\u79AE', u'\u79B0',
+    u'\u79B1', u'\u79BF', u'\u79C8', u'\u7A05', u'\u7A08', u'\u7A0F', u'\u7A1F',
+    u'\u7A2E', u'\u7A31', u'\u7A40', u'\u7A4C', u'\u7A4D', u'\u7A4E', u'\u7A60',
+    u'\u7A61', u'\u7A62', u'\u7A69', u'\u7A6B', u'\u7A6D', u'\u7AA9', u'\u7AAA',
+    u'\u7AAE', u'\u7AAF', u'\u7AB5', u'\u7AB6', u'\u7ABA', u'\u7AC4', u'\u7AC5',
+    u'\u7AC7', u'\u7ACA', u'\u7AF6', u'\u7B46', u'\u7B4D', u'\u7B67', u'\u7B74',
+    u'\u7B8B', u'\u7B8F', u'\u7BC0', u'\u7BC4', u'\u7BC9', u'\u7BCB', u'\u7BD4',
+    u'\u7BD8', u'\u7BE4', u'\u7BE9', u'\u7BF3', u'\u7C00', u'\u7C0D', u'\u7C1E',
+    u'\u7C21', u'\u7C23', u'\u7C2B', u'\u7C39', u'\u7C3D', u'\u7C3E', u'\u7C43',
+    u'\u7C4B', u'\u7C4C', u'\u7C54', u'\u7C59', u'\u7C5B', u'\u7C5C', u'\u7C5F',
+    u'\u7C60', u'\u7C69', u'\u7C6A', u'\u7C6C', u'\u7C6E', u'\u7CB5', u'\u7CDD',
+    u'\u7CDE', u'\u7CE7', u'\u7CF2', u'\u7CF4', u'\u7CF6', u'\u7CF9', u'\u7CFE',
+    u'\u7D00', u'\u7D02', u'\u7D04', u'\u7D05', u'\u7D06', u'\u7D07', u'\u7D08',
+    u'\u7D09', u'\u7D0B', u'\u7D0D', u'\u7D10', u'\u7D13', u'\u7D14', u'\u7D15',
+    u'\u7D16', u'\u7D17', u'\u7D18', u'\u7D19', u'\u7D1A', u'\u7D1B', u'\u7D1C',
+    u'\u7D1D', u'\u7D21', u'\u7D2C', u'\u7D30', u'\u7D31', u'\u7D32', u'\u7D33',
+    u'\u7D35', u'\u7D39', u'\u7D3A', u'\u7D3C', u'\u7D3F', u'\u7D40', u'\u7D42',
+    u'\u7D44', u'\u7D45', u'\u7D46', u'\u7D4E', u'\u7D50', u'\u7D55', u'\u7D5B',
+    u'\u7D5D', u'\u7D5E', u'\u7D61', u'\u7D62', u'\u7D66', u'\u7D68', u'\u7D70',
+    u'\u7D71', u'\u7D72', u'\u7D73', u'\u7D79', u'\u7D7A', u'\u7D80', u'\u7D81',
+    u'\u7D83', u'\u7D86', u'\u7D87', u'\u7D88', u'\u7D8C', u'\u7D8F', u'\u7D90',
+    u'\u7D93', u'\u7D9C', u'\u7D9E', u'\u7DA0', u'\u7DA2', u'\u7DA3', u'\u7DAC',
+    u'\u7DAD', u'\u7DAF', u'\u7DB0', u'\u7DB1', u'\u7DB2', u'\u7DB4', u'\u7DB5',
+    u'\u7DB8', u'\u7DB9', u'\u7DBA', u'\u7DBB', u'\u7DBD', u'\u7DBE', u'\u7DBF',
+    u'\u7DC4', u'\u7DC7', u'\u7DCA', u'\u7DCB', u'\u7DCD', u'\u7DD2', u'\u7DD3',
+    u'\u7DD7', u'\u7DD8', u'\u7DD9', u'\u7DDA', u'\u7DDD', u'\u7DDE', u'\u7DE0',
+    u'\u7DE1', u'\u7DE3', u'\u7DE6', u'\u7DE8', u'\u7DE9', u'\u7DEC', u'\u7DEF',
+    u'\u7DF0', u'\u7DF1', u'\u7DF2', u'\u7DF4', u'\u7DF6', u'\u7DF7', u'\u7DF8',
+    u'\u7DF9', u'\u7DFB', u'\u7E08', u'\u7E09', u'\u7E0A', u'\u7E0B', u'\u7E0E',
+    u'\u7E10', u'\u7E11', u'\u7E15', u'\u7E17', u'\u7E1B', u'\u7E1D', u'\u7E1E',
+    u'\u7E1F', u'\u7E23', u'\u7E2B', u'\u7E2C', u'\u7E2D', u'\u7E2E', u'\u7E31',
+    u'\u7E32', u'\u7E33', u'\u7E35', u'\u7E36', u'\u7E37', u'\u7E39', u'\u7E3A',
+    u'\u7E3D', u'\u7E3E', u'\u7E43', u'\u7E45', u'\u7E46', u'\u7E4F', u'\u7E52',
+    u'\u7E53', u'\u7E54', u'\u7E55', u'\u7E5A', u'\u7E5E', u'\u7E5F', u'\u7E61',
+    u'\u7E62', u'\u7E69', u'\u7E6A', u'\u7E6B', u'\u7E6D', u'\u7E6F', u'\u7E70',
+    u'\u7E73', u'\u7E78', u'\u7E79', u'\u7E7B', u'\u7E7C', u'\u7E7D', u'\u7E7E',
+    u'\u7E7F', u'\u7E81', u'\u7E87', u'\u7E88', u'\u7E8A', u'\u7E8C', u'\u7E8D',
+    u'\u7E8F', u'\u7E93', u'\u7E96', u'\u7E98', u'\u7E9C', u'\u7F3D', u'\u7F48',
+    u'\u7F4C', u'\u7F70', u'\u7F75', u'\u7F77', u'\u7F85', u'\u7F86', u'\u7F88',
+    u'\u7F8B', u'\u7FA5', u'\u7FA9', u'\u7FD2', u'\u7FEC', u'\u7FF9', u'\u7FFD',
+    u'\u802C', u'\u802E', u'\u8056', u'\u805E', u'\u806F', u'\u8070', u'\u8072',
+    u'\u8073', u'\u8075', u'\u8076', u'\u8077', u'\u8079', u'\u807D', u'\u807E',
+    u'\u8085', u'\u8105', u'\u8108', u'\u811B', u'\u8125', u'\u812B', u'\u8139',
+    u'\u814E', u'\u8156', u'\u8161', u'\u8166', u'\u816A', u'\u816B', u'\u8173',
+    u'\u8178', u'\u8183', u'\u8195', u'\u819A', u'\u81A0', u'\u81A2', u'\u81A9',
+    u'\u81BD', u'\u81BE', u'\u81BF', u'\u81C9', u'\u81CD', u'\u81CF', u'\u81D7',
+    u'\u81D8', u'\u81DA', u'\u81DF', u'\u81E0', u'\u81E2', u'\u81E8', u'\u81FA',
+    u'\u8207', u'\u8208', u'\u8209', u'\u820A', u'\u8259', u'\u8264', u'\u8266',
+    u'\u826B', u'\u8271', u'\u8277', u'\u82BB', u'\u82E7', u'\u8332', u'\u834A',
+    u'\u838A', u'\u8396', u'\u83A2', u'\u83A7', u'\u83EF', u'\u8407', u'\u840A',
+    u'\u842C', u'\u8434', u'\u8435', u'\u8449', u'\u8452', u'\u8457', u'\u8464',
+    u'\u8466', u'\u8477', u'\u8494', u'\u849E', u'\u84BC', u'\u84C0', u'\u84CB',
+    u'\u84EE', u'\u84EF', u'\u84F4', u'\u84FD', u'\u851E', u'\u8523', u'\u8525',
+    u'\u8526', u'\u852D', u'\u8541', u'\u8546', u'\u854E', u'\u8552', u'\u8553',
+    u'\u8555', u'\u8558', u'\u8562', u'\u8569', u'\u856A', u'\u856D', u'\u8577',
+    u'\u8580', u'\u8588', u'\u858A', u'\u858C', u'\u8594', u'\u8598', u'\u859F',
+    u'\u85A6', u'\u85A9', u'\u85B3', u'\u85B4', u'\u85BA', u'\u85CD', u'\u85CE',
+    u'\u85DD', u'\u85E5', u'\u85EA', u'\u85F6', u'\u85F9', u'\u85FA', u'\u8604',
+    u'\u8606', u'\u8607', u'\u860A', u'\u860B', u'\u861A', u'\u861E', u'\u8622',
+    u'\u862D', u'\u863A', u'\u863F', u'\u8646', u'\u8655', u'\u865B', u'\u865C',
+    u'\u865F', u'\u8667', u'\u866F', u'\u86FA', u'\u86FB', u'\u8706', u'\u8721',
+    u'\u8755', u'\u875F', u'\u8766', u'\u8778', u'\u8784', u'\u879E', u'\u87A2',
+    u'\u87AE', u'\u87BB', u'\u87BF', u'\u87C4', u'\u87C8', u'\u87CE', u'\u87E3',
+    u'\u87EC', u'\u87EF', u'\u87F2', u'\u87F6', u'\u87FB', u'\u8801', u'\u8805',
+    u'\u8806', u'\u8810', u'\u8811', u'\u881F', u'\u8823', u'\u8828', u'\u8831',
+    u'\u8836', u'\u883B', u'\u8853', u'\u8855', u'\u885A', u'\u885B', u'\u885D',
+    u'\u889E', u'\u88CA', u'\u88DC', u'\u88DD', u'\u88E1', u'\u88FD', u'\u8907',
+    u'\u890C', u'\u8918', u'\u8932', u'\u8933', u'\u8938', u'\u893B', u'\u8940',
+    u'\u8949', u'\u894F', u'\u8956', u'\u895D', u'\u8960', u'\u8964', u'\u896A',
+    u'\u896C', u'\u896F', u'\u8972', u'\u8974', u'\u8986', u'\u898B', u'\u898E',
+    u'\u898F', u'\u8993', u'\u8996', u'\u8998', u'\u89A1', u'\u89A5', u'\u89A6',
+    u'\u89AA', u'\u89AC', u'\u89AF', u'\u89B2', u'\u89B7', u'\u89BA', u'\u89BC',
+    u'\u89BD', u'\u89BF', u'\u89C0', u'\u89F4', u'\u89F6', u'\u89F8', u'\u8A01',
+    u'\u8A02', u'\u8A03', u'\u8A08', u'\u8A0A', u'\u8A0C', u'\u8A0E', u'\u8A10',
+    u'\u8A11', u'\u8A12', u'\u8A13', u'\u8A15', u'\u8A16', u'\u8A17', u'\u8A18',
+    u'\u8A1B', u'\u8A1D', u'\u8A1F', u'\u8A22', u'\u8A23', u'\u8A25', u'\u8A29',
+    u'\u8A2A', u'\u8A2D', u'\u8A31', u'\u8A34', u'\u8A36', u'\u8A3A', u'\u8A3B',
+    u'\u8A40', u'\u8A41', u'\u8A46', u'\u8A4E', u'\u8A50', u'\u8A51', u'\u8A52',
+    u'\u8A54', u'\u8A55', u'\u8A56', u'\u8A57', u'\u8A58', u'\u8A5B', u'\u8A5E',
+    u'\u8A60', u'\u8A61', u'\u8A62', u'\u8A63', u'\u8A66', u'\u8A69', u'\u8A6B',
+    u'\u8A6C', u'\u8A6D', u'\u8A6E', u'\u8A70', u'\u8A71', u'\u8A72', u'\u8A73',
+    u'\u8A75', u'\u8A7C', u'\u8A7F', u'\u8A84', u'\u8A85', u'\u8A86', u'\u8A87',
+    u'\u8A8C', u'\u8A8D', u'\u8A91', u'\u8A92', u'\u8A95', u'\u8A98', u'\u8A9A',
+    u'\u8A9E', u'\u8AA0', u'\u8AA1', u'\u8AA3', u'\u8AA4', u'\u8AA5', u'\u8AA6',
+    u'\u8AA8', u'\u8AAA', u'\u8AB0', u'\u8AB2', u'\u8AB6', u'\u8AB9', u'\u8ABC',
+    u'\u8ABE', u'\u8ABF', u'\u8AC2', u'\u8AC4', u'\u8AC7', u'\u8AC9', u'\u8ACB',
+    u'\u8ACD', u'\u8ACF', u'\u8AD1', u'\u8AD2', u'\u8AD6', u'\u8AD7', u'\u8ADB',
+    u'\u8ADC', u'\u8ADD', u'\u8ADE', u'\u8AE2', u'\u8AE4', u'\u8AE6', u'\u8AE7',
+    u'\u8AEB', u'\u8AED', u'\u8AEE', u'\u8AF0', u'\u8AF1', u'\u8AF3', u'\u8AF6',
+    u'\u8AF7', u'\u8AF8', u'\u8AFA', u'\u8AFC', u'\u8AFE', u'\u8B00', u'\u8B01',
+    u'\u8B02', u'\u8B04', u'\u8B05', u'\u8B0A', u'\u8B0E', u'\u8B0F', u'\u8B10',
+    u'\u8B14', u'\u8B16', u'\u8B17', u'\u8B19', u'\u8B1A', u'\u8B1B', u'\u8B1D',
+    u'\u8B20', u'\u8B28', u'\u8B2B', u'\u8B2C', u'\u8B33', u'\u8B39', u'\u8B3E',
+    u'\u8B49', u'\u8B4A', u'\u8B4E', u'\u8B4F', u'\u8B56', u'\u8B58', u'\u8B59',
+    u'\u8B5A', u'\u8B5C', u'\u8B6B', u'\u8B6F', u'\u8B70', u'\u8B74', u'\u8B77',
+    u'\u8B78', u'\u8B7D', u'\u8B7E', u'\u8B80', u'\u8B8A', u'\u8B8B', u'\u8B8C',
+    u'\u8B8E', u'\u8B92', u'\u8B93', u'\u8B95', u'\u8B96', u'\u8B9C', u'\u8B9E',
+    u'\u8C48', u'\u8C4E', u'\u8C50', u'\u8C6C', u'\u8C76', u'\u8C93', u'\u8C99',
+    u'\u8C9D', u'\u8C9E', u'\u8C9F', u'\u8CA0', u'\u8CA1', u'\u8CA2', u'\u8CA7',
+    u'\u8CA8', u'\u8CA9', u'\u8CAA', u'\u8CAB', u'\u8CAC', u'\u8CAF', u'\u8CB0',
+    u'\u8CB2', u'\u8CB3', u'\u8CB4', u'\u8CB6', u'\u8CB7', u'\u8CB8', u'\u8CBA',
+    u'\u8CBB', u'\u8CBC', u'\u8CBD', u'\u8CBF', u'\u8CC0', u'\u8CC1', u'\u8CC2',
+    u'\u8CC3', u'\u8CC4', u'\u8CC5', u'\u8CC7', u'\u8CC8', u'\u8CCA', u'\u8CD1',
+    u'\u8CD2', u'\u8CD3', u'\u8CD5', u'\u8CD9', u'\u8CDA', u'\u8CDC', u'\u8CDE',
+    u'\u8CDF', u'\u8CE0', u'\u8CE1', u'\u8CE2', u'\u8CE3', u'\u8CE4', u'\u8CE6',
+    u'\u8CE7', u'\u8CEA', u'\u8CEC', u'\u8CED', u'\u8CF0', u'\u8CF4', u'\u8CF5',
+    u'\u8CFA', u'\u8CFB', u'\u8CFC', u'\u8CFD', u'\u8CFE', u'\u8D03', u'\u8D04',
+    u'\u8D05', u'\u8D07', u'\u8D08', u'\u8D0A', u'\u8D0D', u'\u8D0F', u'\u8D10',
+    u'\u8D13', u'\u8D14', u'\u8D16', u'\u8D17', u'\u8D1B', u'\u8D6C', u'\u8D95',
+    u'\u8D99', u'\u8DA8', u'\u8DB2', u'\u8DE1', u'\u8E10', u'\u8E34', u'\u8E4C',
+    u'\u8E55', u'\u8E63', u'\u8E64', u'\u8E7A', u'\u8E7B', u'\u8E82', u'\u8E89',
+    u'\u8E8A', u'\u8E8B', u'\u8E8D', u'\u8E8E', u'\u8E91', u'\u8E92', u'\u8E93',
+    u'\u8E95', u'\u8E9A', u'\u8E9D', u'\u8EA1', u'\u8EA5', u'\u8EA6', u'\u8EAA',
+    u'\u8EC0', u'\u8EC9', u'\u8ECA', u'\u8ECB', u'\u8ECC', u'\u8ECD', u'\u8ECF',
+    u'\u8ED1', u'\u8ED2', u'\u8ED4', u'\u8ED7', u'\u8EDB', u'\u8EDF', u'\u8EE4',
+    u'\u8EE8', u'\u8EEB', u'\u8EF2', u'\u8EF8', u'\u8EF9', u'\u8EFA', u'\u8EFB',
+    u'\u8EFC', u'\u8EFE', u'\u8F03', u'\u8F04', u'\u8F05', u'\u8F07', u'\u8F08',
+    u'\u8F09', u'\u8F0A', u'\u8F12', u'\u8F13', u'\u8F14', u'\u8F15', u'\u8F17',
+    u'\u8F1B', u'\u8F1C', u'\u8F1D', u'\u8F1E', u'\u8F1F', u'\u8F25', u'\u8F26',
+    u'\u8F29', u'\u8F2A', u'\u8F2C', u'\u8F2E', u'\u8F2F', u'\u8F33', u'\u8F38',
+    u'\u8F3B', u'\u8F3E', u'\u8F3F', u'\u8F40', u'\u8F42', u'\u8F44', u'\u8F45',
+    u'\u8F46', u'\u8F49', u'\u8F4D', u'\u8F4E', u'\u8F54', u'\u8F5F', u'\u8F61',
+    u'\u8F62', u'\u8F63', u'\u8F64', u'\u8FA6', u'\u8FAD', u'\u8FAE', u'\u8FAF',
+    u'\u8FB2', u'\u9015', u'\u9019', u'\u9023', u'\u9032', u'\u904B', u'\u904E',
+    u'\u9054', u'\u9055', u'\u9059', u'\u905C', u'\u905E', u'\u9060', u'\u9069',
+    u'\u9072', u'\u9077', u'\u9078', u'\u907A', u'\u907C', u'\u9081', u'\u9084',
+    u'\u9087', u'\u908A', u'\u908F', u'\u9090', u'\u90DF', u'\u90F5', u'\u9106',
+    u'\u9109', u'\u9112', u'\u9114', u'\u9116', u'\u9127', u'\u912D', u'\u9130',
+    u'\u9132', u'\u9134', u'\u9136', u'\u913A', u'\u9147', u'\u9148', u'\u919C',
+    u'\u919E', u'\u91AB', u'\u91AC', u'\u91B1', u'\u91C0', u'\u91C1', u'\u91C3',
+    u'\u91C5', u'\u91CB', u'\u91D0', u'\u91D2', u'\u91D3', u'\u91D4', u'\u91D5',
+    u'\u91D7', u'\u91D8', u'\u91D9', u'\u91DD', u'\u91E3', u'\u91E4', u'\u91E7',
+    u'\u91E9', u'\u91F3', u'\u91F5', u'\u91F7', u'\u91F9', u'\u91FA', u'\u91FE',
+    u'\u9200', u'\u9201', u'\u9203', u'\u9204', u'\u9207', u'\u9208', u'\u9209',
+    u'\u920B', u'\u920D', u'\u9210', u'\u9211', u'\u9212', u'\u9214', u'\u9215',
+    u'\u921E', u'\u9220', u'\u9223', u'\u9225', u'\u9226', u'\u9227', u'\u922E',
+    u'\u922F', u'\u9230', u'\u9232', u'\u9233', u'\u9234', u'\u9237', u'\u9238',
+    u'\u9239', u'\u923A', u'\u923D', u'\u923E', u'\u923F', u'\u9240', u'\u9241',
+    u'\u9245', u'\u9248', u'\u9249', u'\u924B', u'\u924D', u'\u9251', u'\u9255',
+    u'\u9257', u'\u925A', u'\u925B', u'\u925E', u'\u9264', u'\u9266', u'\u926C',
+    u'\u926D', u'\u9276', u'\u9278', u'\u927A', u'\u927B', u'\u927F', u'\u9280',
+    u'\u9283', u'\u9285', u'\u928D', u'\u9291', u'\u9293', u'\u9296', u'\u9298',
+    u'\u929A', u'\u929B', u'\u929C', u'\u92A0', u'\u92A3', u'\u92A5', u'\u92A6',
+    u'\u92A8', u'\u92A9', u'\u92AA', u'\u92AB', u'\u92AC', u'\u92B1', u'\u92B3',
+    u'\u92B6', u'\u92B7', u'\u92BB', u'\u92BC', u'\u92C1', u'\u92C3', u'\u92C5',
+    u'\u92C7', u'\u92C9', u'\u92CC', u'\u92CF', u'\u92D2', u'\u92D9', u'\u92DD',
+    u'\u92DF', u'\u92E3', u'\u92E4', u'\u92E5', u'\u92E6', u'\u92E8', u'\u92E9',
+    u'\u92EA', u'\u92EE', u'\u92EF', u'\u92F0', u'\u92F1', u'\u92F6', u'\u92F8',
+    u'\u92FC', u'\u9301', u'\u9302', u'\u9304', u'\u9306', u'\u9307', u'\u9308',
+    u'\u930F', u'\u9310', u'\u9312', u'\u9315', u'\u9318', u'\u9319', u'\u931A',
+    u'\u931B', u'\u931F', u'\u9320', u'\u9321', u'\u9322', u'\u9326', u'\u9328',
+    u'\u9329', u'\u932B', u'\u932E', u'\u932F', u'\u9333', u'\u9336', u'\u9338',
+    u'\u9340', u'\u9343', u'\u9344', u'\u9346', u'\u9347', u'\u9348', u'\u934B',
+    u'\u934D', u'\u9354', u'\u9358', u'\u935A', u'\u935B', u'\u9360', u'\u9364',
+    u'\u9365', u'\u9369', u'\u936C', u'\u936E', u'\u9370', u'\u9375', u'\u9376',
+    u'\u937A', u'\u937E', u'\u9382', u'\u9384', u'\u9387', u'\u938A', u'\u9394',
+    u'\u9396', u'\u9398', u'\u939B', u'\u939D', u'\u93A1', u'\u93A2', u'\u93A3',
+    u'\u93A6', u'\u93A7', u'\u93A9', u'\u93AA', u'\u93AC', u'\u93AE', u'\u93AF',
+    u'\u93B0', u'\u93B2', u'\u93B3', u'\u93B5', u'\u93B7', u'\u93BF', u'\u93C3',
+    u'\u93C6', u'\u93C7', u'\u93C8', u'\u93C9', u'\u93CC', u'\u93CD', u'\u93D0',
+    u'\u93D1', u'\u93D7', u'\u93D8', u'\u93DC', u'\u93DD', u'\u93DE', u'\u93DF',
+    u'\u93E1', u'\u93E2', u'\u93E4', u'\u93E6', u'\u93E8', u'\u93F0', u'\u93F5',
+    u'\u93F7', u'\u93F9', u'\u93FA', u'\u93FD', u'\u9403', u'\u9404', u'\u940B',
+    u'\u940D', u'\u940E', u'\u940F', u'\u9410', u'\u9412', u'\u9413', u'\u9414',
+    u'\u9418', u'\u9419', u'\u9420', u'\u9425', u'\u9426', u'\u9427', u'\u9428',
+    u'\u942B', u'\u942E', u'\u942F', u'\u9432', u'\u9433', u'\u9435', u'\u9436',
+    u'\u9438', u'\u943A', u'\u943F', u'\u9444', u'\u944A', u'\u944C', u'\u9452',
+    u'\u9454', u'\u9455', u'\u945E', u'\u9460', u'\u9463', u'\u9465', u'\u946D',
+    u'\u9470', u'\u9471', u'\u9472', u'\u9477', u'\u9479', u'\u947C', u'\u947D',
+    u'\u947E', u'\u947F', u'\u9481', u'\u9577', u'\u9580', u'\u9582', u'\u9583',
+    u'\u9586', u'\u9588', u'\u9589', u'\u958B', u'\u958C', u'\u958D', u'\u958E',
+    u'\u958F', u'\u9590', u'\u9591', u'\u9593', u'\u9594', u'\u9598', u'\u95A1',
+    u'\u95A3', u'\u95A5', u'\u95A8', u'\u95A9', u'\u95AB', u'\u95AC', u'\u95AD',
+    u'\u95B1', u'\u95B6', u'\u95B9', u'\u95BB', u'\u95BC', u'\u95BD', u'\u95BE',
+    u'\u95BF', u'\u95C3', u'\u95C6', u'\u95C8', u'\u95CA', u'\u95CB', u'\u95CC',
+    u'\u95CD', u'\u95D0', u'\u95D2', u'\u95D3', u'\u95D4', u'\u95D5', u'\u95D6',
+    u'\u95DC', u'\u95DE', u'\u95E0', u'\u95E1', u'\u95E4', u'\u95E5', u'\u962A',
+    u'\u9658', u'\u965D', u'\u9663', u'\u9670', u'\u9673', u'\u9678', u'\u967D',
+    u'\u9689', u'\u968A', u'\u968E', u'\u9695', u'\u969B', u'\u96A8', u'\u96AA',
+    u'\u96B1', u'\u96B4', u'\u96B8', u'\u96BB', u'\u96CB', u'\u96D6', u'\u96D9',
+    u'\u96DB', u'\u96DC', u'\u96DE', u'\u96E2', u'\u96E3', u'\u96F2', u'\u96FB',
+    u'\u9722', u'\u9727', u'\u973D', u'\u9742', u'\u9744', u'\u9748', u'\u975A',
+    u'\u975C', u'\u9766', u'\u9768', u'\u9780', u'\u978F', u'\u979D', u'\u97BD',
+    u'\u97C1', u'\u97C3', u'\u97C9', u'\u97CB', u'\u97CC', u'\u97CD', u'\u97D3',
+    u'\u97D9', u'\u97DC', u'\u97DE', u'\u97FB', u'\u97FF', u'\u9801', u'\u9802',
+    u'\u9803', u'\u9805', u'\u9806', u'\u9807', u'\u9808', u'\u980A', u'\u980C',
+    u'\u980E', u'\u980F', u'\u9810', u'\u9811', u'\u9812', u'\u9813', u'\u9817',
+    u'\u9818', u'\u981C', u'\u9821', u'\u9824', u'\u9826', u'\u982D', u'\u982E',
+    u'\u9830', u'\u9832', u'\u9834', u'\u9837', u'\u9838', u'\u9839', u'\u983B',
+    u'\u9843', u'\u9846', u'\u984C', u'\u984D', u'\u984E', u'\u984F', u'\u9852',
+    u'\u9853', u'\u9858', u'\u9859', u'\u985B', u'\u985E', u'\u9862', u'\u9865',
+    u'\u9867', u'\u986B', u'\u986C', u'\u986F', u'\u9870', u'\u9871', u'\u9873',
+    u'\u9874', u'\u98A8', u'\u98AD', u'\u98AE', u'\u98AF', u'\u98B0', u'\u98B1',
+    u'\u98B3', u'\u98B6', u'\u98B7', u'\u98B8', u'\u98BA', u'\u98BB', u'\u98BC',
+    u'\u98BE', u'\u98C0', u'\u98C4', u'\u98C6', u'\u98C8', u'\u98DB', u'\u98E0',
+    u'\u98E2', u'\u98E3', u'\u98E5', u'\u98E9', u'\u98EA', u'\u98EB', u'\u98ED',
+    u'\u98EF', u'\u98F2', u'\u98F4', u'\u98FC', u'\u98FD', u'\u98FE', u'\u98FF',
+    u'\u9903', u'\u9904', u'\u9905', u'\u9909', u'\u990A', u'\u990C', u'\u990E',
+    u'\u990F', u'\u9911', u'\u9912', u'\u9913', u'\u9914', u'\u9915', u'\u9916',
+    u'\u9917', u'\u9918', u'\u991A', u'\u991B', u'\u991C', u'\u991E', u'\u9921',
+    u'\u9926', u'\u9928', u'\u992D', u'\u9931', u'\u9933', u'\u9936', u'\u9937',
+    u'\u9938', u'\u993A', u'\u993C', u'\u993E', u'\u993F', u'\u9941', u'\u9943',
+    u'\u9945', u'\u9948', u'\u9949', u'\u994A', u'\u994B', u'\u994C', u'\u9952',
+    u'\u9957', u'\u9958', u'\u995C', u'\u995E', u'\u9962', u'\u99AC', u'\u99AD',
+    u'\u99AE', u'\u99B1', u'\u99B3', u'\u99B4', u'\u99B9', u'\u99C1', u'\u99C3',
+    u'\u99CE', u'\u99D0', u'\u99D1', u'\u99D2', u'\u99D4', u'\u99D5', u'\u99D8',
+    u'\u99D9', u'\u99DA', u'\u99DB', u'\u99DD', u'\u99DF', u'\u99E2', u'\u99E7',
+    u'\u99E9', u'\u99ED', u'\u99F0', u'\u99F1', u'\u99F6', u'\u99F8', u'\u99FB',
+    u'\u99FF', u'\u9A01', u'\u9A02', u'\u9A03', u'\u9A05', u'\u9A0C', u'\u9A0D',
+    u'\u9A0E', u'\u9A0F', u'\u9A14', u'\u9A16', u'\u9A19', u'\u9A1A', u'\u9A1D',
+    u'\u9A1F', u'\u9A20', u'\u9A24', u'\u9A27', u'\u9A2A', u'\u9A2B', u'\u9A2D',
+    u'\u9A2E', u'\u9A30', u'\u9A36', u'\u9A37', u'\u9A38', u'\u9A3E', u'\u9A40',
+    u'\u9A41', u'\u9A42', u'\u9A43', u'\u9A44', u'\u9A45', u'\u9A4A', u'\u9A4B',
+    u'\u9A4C', u'\u9A4D', u'\u9A4F', u'\u9A55', u'\u9A57', u'\u9A5A', u'\u9A5B',
+    u'\u9A5F', u'\u9A62', u'\u9A64', u'\u9A65', u'\u9A66', u'\u9A6A', u'\u9A6B',
+    u'\u9AAF', u'\u9ACF', u'\u9AD2', u'\u9AD4', u'\u9AD5', u'\u9AD6', u'\u9AEE',
+    u'\u9B06', u'\u9B0D', u'\u9B1A', u'\u9B22', u'\u9B25', u'\u9B27', u'\u9B29',
+    u'\u9B2E', u'\u9B31', u'\u9B4E', u'\u9B58', u'\u9B5A', u'\u9B5B', u'\u9B5F',
+    u'\u9B62', u'\u9B65', u'\u9B68', u'\u9B6F', u'\u9B74', u'\u9B77', u'\u9B7A',
+    u'\u9B81', u'\u9B83', u'\u9B84', u'\u9B8A', u'\u9B8B', u'\u9B8D', u'\u9B90',
+    u'\u9B91', u'\u9B92', u'\u9B93', u'\u9B9A', u'\u9B9C', u'\u9B9E', u'\u9B9F',
+    u'\u9BA3', u'\u9BA6', u'\u9BAA', u'\u9BAB', u'\u9BAD', u'\u9BAE', u'\u9BB0',
+    u'\u9BB3', u'\u9BB6', u'\u9BB8', u'\u9BBA', u'\u9BC0', u'\u9BC1', u'\u9BC4',
+    u'\u9BC6', u'\u9BC7', u'\u9BC9', u'\u9BCA', u'\u9BD2', u'\u9BD4', u'\u9BD5',
+    u'\u9BD6', u'\u9BD7', u'\u9BDB', u'\u9BDD', u'\u9BE1', u'\u9BE2', u'\u9BE4',
+    u'\u9BE7', u'\u9BE8', u'\u9BEA', u'\u9BEB', u'\u9BF1', u'\u9BF4', u'\u9BF6',
+    u'\u9BF7', u'\u9BFD', u'\u9BFF', u'\u9C01', u'\u9C02', u'\u9C03', u'\u9C06',
+    u'\u9C08', u'\u9C09', u'\u9C0C', u'\u9C0D', u'\u9C0F', u'\u9C12', u'\u9C13',
+    u'\u9C1C', u'\u9C1F', u'\u9C20', u'\u9C23', u'\u9C24', u'\u9C25', u'\u9C27',
+    u'\u9C28', u'\u9C29', u'\u9C2D', u'\u9C2E', u'\u9C31', u'\u9C32', u'\u9C33',
+    u'\u9C35', u'\u9C37', u'\u9C39', u'\u9C3A', u'\u9C3B', u'\u9C3C', u'\u9C3E',
+    u'\u9C42', u'\u9C45', u'\u9C47', u'\u9C48', u'\u9C49', u'\u9C52', u'\u9C54',
+    u'\u9C56', u'\u9C57', u'\u9C58', u'\u9C5D', u'\u9C5F', u'\u9C60', u'\u9C63',
+    u'\u9C64', u'\u9C67', u'\u9C68', u'\u9C6D', u'\u9C6E', u'\u9C6F', u'\u9C77',
+    u'\u9C78', u'\u9C7A', u'\u9CE5', u'\u9CE7', u'\u9CE9', u'\u9CF2', u'\u9CF3',
+    u'\u9CF4', u'\u9CF6', u'\u9CF7', u'\u9CFC', u'\u9CFE', u'\u9D03', u'\u9D06',
+    u'\u9D07', u'\u9D09', u'\u9D12', u'\u9D15', u'\u9D17', u'\u9D1B', u'\u9D1C',
+    u'\u9D1D', u'\u9D1E', u'\u9D1F', u'\u9D23', u'\u9D26', u'\u9D28', u'\u9D2F',
+    u'\u9D30', u'\u9D32', u'\u9D34', u'\u9D37', u'\u9D3B', u'\u9D3F', u'\u9D41',
+    u'\u9D42', u'\u9D43', u'\u9D50', u'\u9D51', u'\u9D52', u'\u9D53', u'\u9D5A',
+    u'\u9D5C', u'\u9D5D', u'\u9D60', u'\u9D61', u'\u9D6A', u'\u9D6C', u'\u9D6E',
+    u'\u9D6F', u'\u9D72', u'\u9D77', u'\u9D7E', u'\u9D84', u'\u9D87', u'\u9D89',
+    u'\u9D8A', u'\u9D92', u'\u9D93', u'\u9D96', u'\u9D97', u'\u9D98', u'\u9D9A',
+    u'\u9DA1', u'\u9DA5', u'\u9DA9', u'\u9DAA', u'\u9DAC', u'\u9DAF', u'\u9DB2',
+    u'\u9DB4', u'\u9DB9', u'\u9DBA', u'\u9DBB', u'\u9DBC', u'\u9DBF', u'\u9DC1',
+    u'\u9DC2', u'\u9DC8', u'\u9DCA', u'\u9DD3', u'\u9DD4', u'\u9DD6', u'\u9DD7',
+    u'\u9DD9', u'\u9DDA', u'\u9DE5', u'\u9DE6', u'\u9DE8', u'\u9DEB', u'\u9DEF',
+    u'\u9DF2', u'\u9DF3', u'\u9DF8', u'\u9DF9', u'\u9DFA', u'\u9DFD', u'\u9DFF',
+    u'\u9E02', u'\u9E07', u'\u9E0B', u'\u9E0C', u'\u9E0F', u'\u9E15', u'\u9E18',
+    u'\u9E1A', u'\u9E1B', u'\u9E1D', u'\u9E1E', u'\u9E75', u'\u9E79', u'\u9E7A',
+    u'\u9E7C', u'\u9E7D', u'\u9E97', u'\u9EA5', u'\u9EA8', u'\u9EA9', u'\u9EB2',
+    u'\u9EB5', u'\u9EBC', u'\u9EBD', u'\u9EC3', u'\u9ECC', u'\u9EDE', u'\u9EE8',
+    u'\u9EF2', u'\u9EF6', u'\u9EF7', u'\u9EFD', u'\u9EFF', u'\u9F09', u'\u9F34',
+    u'\u9F4A', u'\u9F4B', u'\u9F4E', u'\u9F4F', u'\u9F52', u'\u9F54', u'\u9F55',
+    u'\u9F57', u'\u9F59', u'\u9F5C', u'\u9F5F', u'\u9F60', u'\u9F61', u'\u9F66',
+    u'\u9F6A', u'\u9F6C', u'\u9F72', u'\u9F76', u'\u9F77', u'\u9F8D', u'\u9F8E',
+    u'\u9F90', u'\u9F91', u'\u9F94', u'\u9F95', u'\u9F9C', u'\u9FAD', u'\u9FAF',
 };
 
-Q_GLOBAL_STATIC_WITH_ARGS(QRegularExpression, hanExpression, {".*(\\p{Han}).*"});
-Q_GLOBAL_STATIC_WITH_ARGS(
-    QRegularExpression,
-    traditionalExpression,
-    {".*(" + QStringList{TRADITIONAL_CHINESE_CHARS}.join("|") + ").*"});
-Q_GLOBAL_STATIC_WITH_ARGS(
-    QRegularExpression,
-    simplifiedExpression,
-    {".*(" + QStringList{SIMPLIFIED_CHINESE_CHARS}.join("|") + ").*"});
-Q_GLOBAL_STATIC_WITH_ARGS(
-    QRegularExpression,
-    mostlySimplifiedExpression,
-    {".*(" + QStringList{MOSTLY_SIMPLIFIED_CHINESE_CHARS}.join("|") + ").*"});
+namespace {
 
-ScriptDetector::ScriptDetector(const QString &string)
+// A CodeUnitSet is a bitset with one bit for every UTF-16 code unit. All of
+// the characters in the lists above are in the BMP, so checking whether a
+// character is in one of them is a single bit test.
+class CodeUnitSet
 {
-    QRegularExpressionMatch traditionalMatch = traditionalExpression->match(
-        string);
-    if (traditionalMatch.hasMatch()) {
-        _containsTraditionalChinese = true;
+public:
+    template<std::size_t N>
+    constexpr void insert(const char16_t (&codeUnits)[N])
+    {
+        for (char16_t codeUnit : codeUnits) {
+            _bits[codeUnit / 64] |= std::uint64_t{1} << (codeUnit % 64);
+        }
     }
 
-    QRegularExpressionMatch simplifiedMatch = simplifiedExpression->match(
-        string);
-    QRegularExpressionMatch mostlySimplifiedMatch
-        = mostlySimplifiedExpression->match(string);
-    if (simplifiedMatch.hasMatch() || mostlySimplifiedMatch.hasMatch()) {
-        _containsSimplifiedChinese = true;
+    constexpr bool contains(char16_t codeUnit) const
+    {
+        return (_bits[codeUnit / 64] >> (codeUnit % 64)) & 1;
     }
 
-    QRegularExpressionMatch match = hanExpression->match(string);
-    if (match.hasMatch()) {
-        _containsChinese = true;
-    }
+private:
+    std::array<std::uint64_t, 65536 / 64> _bits{};
+};
+
+// Both sets are built at compile time
+constexpr CodeUnitSet traditionalCharacters = [] {
+    CodeUnitSet set;
+    set.insert(TRADITIONAL_CHINESE_CHARS);
+    return set;
+}();
+
+constexpr CodeUnitSet simplifiedCharacters = [] {
+    CodeUnitSet set;
+    set.insert(SIMPLIFIED_CHINESE_CHARS);
+    set.insert(MOSTLY_SIMPLIFIED_CHINESE_CHARS);
+    return set;
+}();
+
+} // namespace
+
+ScriptDetector::ScriptDetector(const QString &string)
+    : _string{string}
+{}
 
-    std::vector<std::string> dummyVec;
-    _isValidJyutping = CantoneseUtils::segmentJyutping(string, dummyVec);
-    QString out;
-    CantoneseUtils::jyutpingAutocorrect(string, out);
-    _isValidJyutpingAfterAutocorrect = CantoneseUtils::segmentJyutping(out,
-                                                                     dummyVec);
-    QString processedPinyin = string;
-    _isValidPinyin = MandarinUtils::segmentPinyin(processedPinyin
-                                                      .replace("v", "u:")
-                                                      .replace("ü", "u:"),
-                                                  dummyVec);
+bool ScriptDetector::isAscii()
+{
+    if (!_isAscii) {
+        _isAscii = std::all_of(_string.cbegin(),
+                               _string.cend(),
+                               [](QChar character) {
+                                   return character.unicode() < 0x80;
+                               });
+    }
+    return *_isAscii;
 }
 
 bool ScriptDetector::containsChinese()
 {
-    return _containsChinese;
+    if (!_containsChinese) {
+        _containsChinese = false;
+        if (isAscii()) {
+            return *_containsChinese;
+        }
+
+        for (qsizetype i = 0; i < _string.size(); ++i) {
+            // Han characters outside the BMP (e.g. CJK Extension B) are
+            // encoded as surrogate pairs
+            char32_t codePoint = _string.at(i).unicode();
+            if (_string.at(i).isHighSurrogate() && i + 1 < _string.size()
+                && _string.at(i + 1).isLowSurrogate()) {
+                codePoint = QChar::surrogateToUcs4(_string.at(i),
+                                                   _string.at(i + 1));
+                ++i;
+            }
+            if (QChar::script(codePoint) == QChar::Script_Han) {
+                _containsChinese = true;
+                break;
+            }
+        }
+    }
+    return *_containsChinese;
 }
 
 bool ScriptDetector::containsSimplifiedChinese()
 {
-    return _containsSimplifiedChinese;
+    if (!_containsSimplifiedChinese) {
+        _containsSimplifiedChinese
+            = !isAscii()
+              && std::any_of(_string.cbegin(),
+                             _string.cend(),
+                             [](QChar character) {
+                                 return simplifiedCharacters.contains(
+                                     character.unicode());
+                             });
+    }
+    return *_containsSimplifiedChinese;
 }
 
 bool ScriptDetector::containsTraditionalChinese()
 {
-    return _containsTraditionalChinese;
+    if (!_containsTraditionalChinese) {
+        _containsTraditionalChinese
+            = !isAscii()
+              && std::any_of(_string.cbegin(),
+                             _string.cend(),
+                             [](QChar character) {
+                                 return traditionalCharacters.contains(
+                                     character.unicode());
+                             });
+    }
+    return *_containsTraditionalChinese;
 }
 
 bool ScriptDetector::isValidJyutping()
 {
-    return _isValidJyutping;
+    if (!_isValidJyutping) {
+        _isValidJyutping = CantoneseUtils::segmentJyutping(_string,
+                                                           _syllables);
+    }
+    return *_isValidJyutping;
 }
 
 bool ScriptDetector::isValidJyutpingAfterAutocorrect()
 {
-    return _isValidJyutpingAfterAutocorrect;
+    if (!_isValidJyutpingAfterAutocorrect) {
+        QString corrected;
+        CantoneseUtils::jyutpingAutocorrect(_string, corrected);
+        _isValidJyutpingAfterAutocorrect
+            = CantoneseUtils::segmentJyutping(corrected, _syllables);
+    }
+    return *_isValidJyutpingAfterAutocorrect;
 }
 
 bool ScriptDetector::isValidPinyin()
 {
-    return _isValidPinyin;
+    if (!_isValidPinyin) {
+        QString processedPinyin = _string;
+        processedPinyin.replace("v", "u:").replace("ü", "u:");
+        _isValidPinyin = MandarinUtils::segmentPinyin(processedPinyin,
+                                                      _syllables);
+    }
+    return *_isValidPinyin;
 }
@@ -1,8 +1,20 @@
 #ifndef SCRIPTDETECTOR_H
 #define SCRIPTDETECTOR_H
 
+#include "logic/utils/chineseutils.h"
+
 #include <QString>
 
+#include <optional>
+#include <vector>
+
+// The ScriptDetector guesses what kind of text a search term is.
+//
+// Each property is only computed the first time it is asked for, and then
+// remembered, so callers should check the properties they care about most
+// first: a Chinese search term never needs to be segmented as Jyutping or
+// Pinyin, and an ASCII search term never needs to be checked for Chinese.
+
 class ScriptDetector
 {
 public:
@@ -17,13 +29,20 @@ public:
     bool isValidPinyin();
 
 private:
-    bool _containsSimplifiedChinese = false;
-    bool _containsTraditionalChinese = false;
-    bool _containsChinese = false;
+    bool isAscii();
+
+    QString _string;
+    std::vector<SyllableSpan> _syllables;
+
+    std::optional<bool> _isAscii;
+
+    std::optional<bool> _containsSimplifiedChinese;
+    std::optional<bool> _containsTraditionalChinese;
+    std::optional<bool> _containsChinese;
 
-    bool _isValidJyutping = false;
-    bool _isValidJyutpingAfterAutocorrect = false;
-    bool _isValidPinyin = false;
+    std::optional<bool> _isValidJyutping;
+    std::optional<bool> _isValidJyutpingAfterAutocorrect;
+    std::optional<bool> _isValidPinyin;
 };
 
 #endif // SCRIPTDETECTOR_H
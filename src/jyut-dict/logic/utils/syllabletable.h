@@ -0,0 +1,80 @@
+#ifndef SYLLABLETABLE_H
+#define SYLLABLETABLE_H
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// A SyllableTable maps a single romanized syllable to its converted form.
+//
+// Syllable inventories are small and closed (a few thousand toned syllables
+// for both Jyutping and Pinyin), so every syllable in the inventory is
+// converted once when the table is built. Tables are function-local statics,
+// built the first time they are used, so that startup does not pay for tables
+// that are never looked up. A table never changes after it is built, so
+// looking up a syllable is a single hash lookup without a lock.
+//
+// Syllables outside of the inventory (misspellings, rare erhua forms, etc.)
+// are converted every time they are looked up.
+
+template<typename Value>
+class SyllableTable
+{
+public:
+    template<typename Convert>
+    SyllableTable(const std::vector<std::string> &syllables, Convert &&convert)
+    {
+        _table.reserve(syllables.size());
+        for (const auto &syllable : syllables) {
+            _table.emplace(syllable, convert(syllable));
+        }
+    }
+
+    template<typename Convert>
+    Value lookup(const std::string &syllable, Convert &&convert) const
+    {
+        auto result = _table.find(syllable);
+        if (result != _table.end()) {
+            return result->second;
+        }
+        return convert(syllable);
+    }
+
+private:
+    std::unordered_map<std::string, Value> _table;
+};
+
+// Spells out every combination of an initial (or no initial), a final, and
+// a tone. Not every combination is a real syllable; the extra ones only cost
+// a little memory.
+template<typename Initials, typename Finals>
+std::vector<std::string> spellSyllables(
+    const Initials &initials,
+    const Finals &finals,
+    std::initializer_list<std::string_view> tones)
+{
+    std::vector<std::string> syllables;
+    syllables.reserve((initials.size() + 1) * finals.size() * tones.size());
+
+    auto spell = [&](std::string_view initial) {
+        for (const auto &final : finals) {
+            for (const auto &tone : tones) {
+                std::string syllable{initial};
+                syllable += final;
+                syllable += tone;
+                syllables.emplace_back(std::move(syllable));
+            }
+        }
+    };
+    spell("");
+    for (const auto &initial : initials) {
+        spell(initial);
+    }
+
+    return syllables;
+}
+
+#endif // SYLLABLETABLE_H
@@ -0,0 +1,574 @@
+#ifndef REFERENCEAUTOCORRECT_H
+#define REFERENCEAUTOCORRECT_H
+
+#include <QString>
+#include <QStringView>
+
+#include <string>
+#include <unordered_set>
+
+// This is the implementation of CantoneseUtils::jyutpingAutocorrect from
+// before it was rewritten to use single-pass rewrites. It applies each
+// substitution with a separate call to QString::replace(), which makes it
+// slow, but easy to check by reading.
+//
+// TestCantoneseUtils compares the current implementation against this one
+// over a generated corpus, so that the two can't drift apart.
+
+namespace {
+
+const std::unordered_set<std::string> referenceInitials
+    = {"b", "p", "m", "f", "d", "t", "n", "l", "g", "k",
+       "ng", "h", "gw", "kw", "w", "z", "c", "s", "j", "m"};
+
+bool referenceJyutpingAutocorrect(const QString &in,
+                                  QString &out,
+                                  bool unsafeSubstitutions)
+{
+    out = in;
+
+    // This is for some romanizations like "shui" for 水
+    // And needs to happen before the "sh" -> "s" conversion
+    out.replace("hui", "heoi");
+
+    // The initial + nucleus "cu-" never appears in Jyutping, so the user
+    // probably intended to make the IPA [kʰɐ] sound
+    // Surround the k with capturing group to prevent replacement with (g|k)
+    // if sound changes are enabled
+    out.replace("cu", "(k)u");
+
+    // "x" never appears in Jyutping, the user might be more familiar
+    // with Pinyin and assume that it's an "s" sound
+    out.replace("x", "s");
+
+    out.replace("ch", "c").replace("sh", "s").replace("zh", "z");
+
+    // Change "eung", "erng", "eong" -> "oeng"
+    out.replace("eung", "oeng").replace("erng", "oeng");
+
+    out.replace("eui", "eoi");
+    out.replace("euk", "oek");
+    out.replace("eun", "(eo|yu)n");
+    out.replace("eut", "(eo|yu)t");
+    out.replace("eu", "(e|y)u");
+    out.replace("ern", "eon");
+
+    // Change "-oen" -> "-eon"
+    int idx = out.indexOf("oen");
+    while (idx != -1) {
+        if (QStringView{out.constBegin() + idx, 4} == QString{"oeng"}) {
+            idx = out.indexOf("oen", idx + 1);
+            continue;
+        }
+        out.replace(idx, 3, "eon");
+        idx = out.indexOf("oen", idx + 1);
+    }
+    out.replace("oei", "eoi");
+    out.replace("oet", "eot");
+
+    out.replace("eong ", "oeng ");
+    out.replace("eong'", "oeng'");
+    if (out.endsWith("eong")) {
+        idx = out.lastIndexOf(("eong"));
+        out.replace(idx, 4, "oeng");
+    }
+    if (unsafeSubstitutions) {
+        out.replace("eong", "oeng"); // unsafe because of zeon6 gun2
+    }
+    out.replace("eok", "oek");
+
+    out.replace("ao ", "au ");
+    out.replace("ao'", "au'");
+    if (out.endsWith("ao")) {
+        idx = out.lastIndexOf(("ao"));
+        out.replace(idx, 2, "au");
+    }
+    if (unsafeSubstitutions) {
+        out.replace("ao", "au"); // unsafe because of maa5 on1
+    }
+
+    out.replace("ar", "aa");      // like in "char siu"
+    out.replace("ee", "i");       // like in "lai see"
+    out.replace("ay", "ei");      // like in "gong hay fat choy"
+    out.replace("oy", "oi");      // like in "choy sum"
+    out.replace("oo", "(y!u)");   // like in "soot goh"
+    out.replace("ong", "(o|u)ng");
+    out.replace("young", "jung"); // like in "foo young"
+
+    out.replace("yue", "(j)yu"); // like "yuet yue" (粵語)
+    out.replace("ue", "(yu)"); // like "tsuen wan" (轉彎)
+    out.replace("tsz", "zi");  // like "tsat tsz mui" (七姊妹)
+    out.replace("ck", "k");    // like "back" (白)
+
+    // The following changes may be unsafe because it is ambiguous whether
+    // they are final + initial or a "misspelling" of a final
+    // However, it is unambiguous if there is a separator at the end of the
+    // syllable, or it is the end of the string
+
+    // Check if the user intends to write an [-ɔː h-] or [-ou̯] cluster
+    {
+        out.replace("oh ", "ou ").replace("oh'", "ou'");
+        if (out.endsWith("oh")) {
+            out.replace(out.length() - 2, 2, "ou");
+        }
+
+        // Initials for which <initial> + "-ou" exist in Jyutping
+        std::unordered_set<QChar> closeBackVowelCluster = {'n', 'j'};
+        // Initials for which both "-ou" and "-o h-" exist in Jyutping
+        std::unordered_set<QChar> ambiguousVowelCluster
+            = {'b', 'p', 'm', 'f', 'd', 't', 'l', 'g', 'h', 'w', 'z', 'c', 's'};
+
+        int replacementIdx = out.indexOf("oh");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 2, "ou");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeBackVowelCluster.find(out.at(initialIdx))
+                    != closeBackVowelCluster.end()) {
+                    out.replace(replacementIdx, 2, "ou");
+                } else if (ambiguousVowelCluster.find(out.at(initialIdx))
+                           != ambiguousVowelCluster.end()) {
+                    // The [h-] cluster can only occur if what follows is not an initial
+                    bool initialFound = false;
+                    for (int initial_len = 2; initial_len > 0; initial_len--) {
+                        QString s{out.constBegin() + replacementIdx + 2,
+                                  initial_len};
+                        if (referenceInitials.contains(s.toStdString())
+                            || s.toStdString() == "y") {
+                            initialFound = true;
+                        }
+                    }
+                    if (initialFound) {
+                        out.replace(replacementIdx, 2, "ou");
+                    } else {
+                        out.replace(replacementIdx, 2, "o h");
+                    }
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("oh", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-ɔː w-] or [-auː] cluster
+    {
+        out.replace("ow ", "au ").replace("ow'", "au'");
+        if (out.endsWith("ow")) {
+            out.replace(out.length() - 2, 2, "au");
+        }
+
+        // Initials for which <initial> + "-(a)au" exist in Jyutping
+        std::unordered_set<QChar> closeBackVowelCluster = {'b', 'm', 'k', 's'};
+        // Initials for which both exist in Jyutping
+        std::unordered_set<QChar> ambiguousVowelCluster
+            = {'p', 'm', 'f', 'd', 't', 'n', 'l', 'g', 'h', 'z', 'c', 's'};
+        int replacementIdx = out.indexOf("ow");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 2, "au");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeBackVowelCluster.find(out.at(initialIdx))
+                    != closeBackVowelCluster.end()) {
+                    out.replace(replacementIdx, 2, "au");
+                } else if (ambiguousVowelCluster.find(out.at(initialIdx))
+                           != ambiguousVowelCluster.end()) {
+                    // The [w-] cluster can only occur if what follows is not an initial
+                    bool initialFound = false;
+                    for (int initial_len = 2; initial_len > 0; initial_len--) {
+                        QString s{out.constBegin() + replacementIdx + 2,
+                                  initial_len};
+                        if (referenceInitials.contains(s.toStdString())
+                            || s.toStdString() == "y") {
+                            initialFound = true;
+                        }
+                    }
+                    if (initialFound) {
+                        out.replace(replacementIdx, 2, "au");
+                    } else {
+                        out.replace(replacementIdx, 2, "o w");
+                    }
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("ow", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [ɐm] or [-uː  m-] cluster
+    {
+        out.replace("um ", "am ").replace("um'", "am'");
+        if (out.endsWith("um")) {
+            out.replace(out.length() - 2, 2, "am");
+        }
+
+        // Initials for which <initial> + "am" exist in Jyutping
+        std::unordered_set<QChar> openMidCentralVowelCluster
+            = {'b', 'p', 'm', 'd', 't', 'n', 'l', 'k', 'h', 'z', 'c', 's', 'j'};
+        // Initials for which <initial> + "-u m-" exist in Jyutping
+        std::unordered_set<QChar> closeBackVowelCluster
+            = {'f', 'w', 'a', 'e', 'i', 'o'};
+
+        int replacementIdx = out.indexOf("um");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 2, "am");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (openMidCentralVowelCluster.find(out.at(initialIdx))
+                    != openMidCentralVowelCluster.end()) {
+                    out.replace(replacementIdx, 2, "am");
+                } else if (closeBackVowelCluster.find(out.at(initialIdx))
+                           != closeBackVowelCluster.end()) {
+                    (void) 0; // Do nothing
+                } else if (out.at(initialIdx) == "g") {
+                    // The [m-] cluster can only occur if what follows is not an initial
+                    bool initialFound = false;
+                    for (int initial_len = 2; initial_len > 0; initial_len--) {
+                        QString s{out.constBegin() + replacementIdx + 2,
+                                  initial_len};
+                        if (referenceInitials.contains(s.toStdString())
+                            || s.toStdString() == "y") {
+                            initialFound = true;
+                        }
+                    }
+                    if (initialFound) {
+                        out.replace(replacementIdx, 2, "am");
+                    } else {
+                        out.replace(replacementIdx, 2, "u m");
+                    }
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("um", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-ɛː j-] or [-ei̯] cluster
+    {
+        out.replace("ey ", "ei ").replace("ey'", "ei'");
+        if (out.endsWith("ey")) {
+            out.replace(out.length() - 2, 2, "ei");
+        }
+
+        // Initials for which <initial> + "-ei" exist in Jyutping
+        std::unordered_set<QChar> closeFrontVowelCluster
+            = {'p', 'f', 'd', 'n', 'l', 'h', 'w'};
+        // Initials for which <initial> + "-e j-" exist in Jyutping
+        std::unordered_set<QChar> openMidFrontVowelCluster = {'c', 'j', 'y'};
+        // Initials for which both exist in Jyutping
+        std::unordered_set<QChar> ambiguousVowelCluster
+            = {'b', 'm', 'g', 'k', 'z', 's'};
+
+        int replacementIdx = out.indexOf("ey");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 2, "ei");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeFrontVowelCluster.find(out.at(initialIdx))
+                    != closeFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 2, "ei");
+                } else if (openMidFrontVowelCluster.find(out.at(initialIdx))
+                           != openMidFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 2, "e (j)");
+                } else if (ambiguousVowelCluster.find(out.at(initialIdx))
+                           != ambiguousVowelCluster.end()) {
+                    // The [j-] cluster can only occur if what follows is not an initial
+                    bool initialFound = false;
+                    for (int initial_len = 2; initial_len > 0; initial_len--) {
+                        QString s{out.constBegin() + replacementIdx + 2,
+                                  initial_len};
+                        if (referenceInitials.contains(s.toStdString())
+                            || s.toStdString() == "y") {
+                            initialFound = true;
+                        }
+                    }
+                    if (initialFound) {
+                        out.replace(replacementIdx, 2, "ei");
+                    } else {
+                        out.replace(replacementIdx, 2, "e (j)");
+                    }
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("ey", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-yː j-] or [-ɐm] cluster
+    {
+        // Initials for which <initial> + "-yu m-" exist in Jyutping
+        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 'c', 's', 'j'};
+        int replacementIdx = out.indexOf("yum");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 3, "(j)am");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeFrontVowelCluster.find(out.at(initialIdx))
+                    != closeFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 3, "yu m");
+                } else {
+                    out.replace(replacementIdx, 3, "(j)am");
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("yum", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-yː p-] or [-ɐp] cluster
+    {
+        // Initials for which <initial> + "-yu p-" exist in Jyutping
+        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'j'};
+
+        int replacementIdx = out.indexOf("yup");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 3, "(j)ap");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeFrontVowelCluster.find(out.at(initialIdx))
+                    != closeFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 3, "yu p");
+                } else {
+                    out.replace(replacementIdx, 3, "(j)ap");
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("yup", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-yː k-] or [jʊk] cluster
+    {
+        // Initials for which <initial> + "-yu k-" exist in Jyutping
+        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
+
+        int replacementIdx = out.indexOf("yuk");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 3, "(j)uk");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeFrontVowelCluster.find(out.at(initialIdx))
+                    != closeFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 3, "yu k");
+                } else {
+                    out.replace(replacementIdx, 3, "(j)uk");
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("yuk", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-yn g-] or [jʊŋ] cluster
+    {
+        // Initials for which <initial> + "-yun g-" exist in Jyutping
+        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
+
+        int replacementIdx = out.indexOf("yung");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 4, "(j)ung");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeFrontVowelCluster.find(out.at(initialIdx))
+                    != closeFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 4, "(yu)n g");
+                } else {
+                    out.replace(replacementIdx, 4, "(j)ung");
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("yung", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-yn] or [jɐn], [jyn], [yn] cluster
+    {
+        // Initials for which <initial> + "-yu n-" exist in Jyutping
+        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
+
+        int replacementIdx = out.indexOf("yun");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 3, "(j)(a|yu)n");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeFrontVowelCluster.find(out.at(initialIdx))
+                    != closeFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 3, "yun");
+                } else {
+                    out.replace(replacementIdx, 3, "(ja|jyu|yu)n");
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("yun", replacementIdx + 1);
+        }
+    }
+
+    // Check if the user intends to write an [-yt] or [jɐt], [jyt], [yt] cluster
+    {
+        // Initials for which <initial> + "-yu t-" exist in Jyutping
+        std::unordered_set<QChar> closeFrontVowelCluster = {'z', 's', 'c', 'j'};
+
+        int replacementIdx = out.indexOf("yut");
+        while (replacementIdx != -1) {
+            switch (replacementIdx) {
+            case 0: {
+                out.replace(replacementIdx, 3, "(j)(a|yu)t");
+                break;
+            }
+            default: {
+                int initialIdx = replacementIdx - 1;
+                if (replacementIdx >= 2 && out.at(initialIdx) == ")") {
+                    initialIdx = replacementIdx - 2;
+                }
+
+                if (closeFrontVowelCluster.find(out.at(initialIdx))
+                    != closeFrontVowelCluster.end()) {
+                    out.replace(replacementIdx, 3, "(yu)t");
+                } else {
+                    out.replace(replacementIdx, 3, "(ja|jyu|yu)t");
+                }
+                break;
+            }
+            }
+            replacementIdx = out.indexOf("yut", replacementIdx + 1);
+        }
+    }
+
+    // Unsafe because it is ambiguous whether these are final + initial
+    // or a "misspelling" of an initial
+    // But unambiguous if they are at the start of a syllable
+    if (out.startsWith("ts")) {
+        out.replace(0, 2, "c");
+    }
+    out.replace(" ts", " c");
+    if (out.startsWith("kwu")) {
+        out.replace(0, 3, "(g|k)w!u");
+    }
+    out.replace(" kwu", " (g|k)w!u");
+    if (unsafeSubstitutions) {
+        out.replace("ts", "c");         // unsafe because of kat1 sau3
+        out.replace("kwu", "(g|k)w!u"); // unsafe because of baak6 wun2
+    }
+
+    // Change any "y" that is not followed by a "u" to "j"
+    // This needs to happen before the final replacements
+    idx = out.indexOf("y");
+    while (idx != -1) {
+        if (QStringView{out.constBegin() + idx, 2} == QString{"yu"}
+            || QStringView{out.constBegin() + idx, 3} == QString{"y!u"}
+            || QStringView{out.constBegin() + idx, 3} == QString{"y)u"}) {
+            idx = out.indexOf("y", idx + 1);
+            continue;
+        }
+        out.replace(idx, 1, "(j)");
+        idx = out.indexOf("y", idx + 1);
+    }
+
+    out.replace("ui", "(eo|u)i");
+    out.replace("un", "(y!u|a|eo)n");
+    out.replace("ut", "(a|y!u)t");
+
+    out.replace("o ", "(ou!) ");
+    out.replace("o'", "(ou!)'");
+    if (out.endsWith("o")) {
+        out.replace(out.size() - 1, 1, "(ou!)");
+    }
+    idx = out.indexOf("o");
+    while (idx != -1) {
+        if (out.at(idx + 1) != 'k' && out.at(idx + 1) != 't'
+            && out.at(idx + 1) != 'e' && out.at(idx + 1) != 'i'
+            && out.at(idx + 1) != 'u' && out.at(idx + 1) != 'n'
+            && out.at(idx + 1) != ')' && out.at(idx + 1) != '|') {
+            out.replace(idx, 1, "(ou!)");
+            idx = out.indexOf("o", idx + 1);
+            continue;
+        }
+        idx = out.indexOf("o", idx + 1);
+    }
+
+    return 0;
+}
+
+} // namespace
+
+#endif // REFERENCEAUTOCORRECT_H
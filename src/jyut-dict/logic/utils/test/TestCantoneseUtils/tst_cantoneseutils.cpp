@@ -1,6 +1,9 @@
 #include <QtTest>
 
 #include "logic/utils/cantoneseutils.h"
+#include "referenceautocorrect.h"
+
+#include <random>
 
 class TestCantoneseUtils : public QObject
 {
@@ -36,6 +39,12 @@ private slots:
     void jyutpingToIPASpecialFinal();
     void jyutpingToIPATones();
     void jyutpingToIPANoTone();
+    void jyutpingSyllableTable();
+
+    void benchmarkJyutpingToYale();
+    void benchmarkJyutpingToYaleWithoutTable();
+    void benchmarkJyutpingToIPA();
+    void benchmarkJyutpingToIPAWithoutTable();
 
     void segmentJyutpingSimple();
     void segmentJyutpingNoDigits();
@@ -59,6 +68,11 @@ private slots:
     void segmentJyutpingMultipleFinals();
     void segmentJyutpingInvalidTone();
     void segmentJyutpingGarbage();
+    void segmentJyutpingSpans();
+    void segmentJyutpingSpansKeepGlobCharacters();
+    void segmentJyutpingSpansTrailing();
+    void benchmarkSegmentJyutping();
+    void benchmarkSegmentJyutpingSpans();
 
     void autocorrectJyutpingHui();
     void autocorrectJyutpingCu();
@@ -101,6 +115,8 @@ private slots:
     void autocorrectJyutpingUi();
     void autocorrectJyutpingUn();
     void autocorrectJyutpingUt();
+    void autocorrectJyutpingMatchesReference();
+    void benchmarkAutocorrectJyutping();
 
     void soundChangeNg();
     void soundChangeM();
@@ -320,6 +336,79 @@ void TestCantoneseUtils::jyutpingToIPANoTone()
     QCOMPARE(result, "mok");
 }
 
+void TestCantoneseUtils::jyutpingSyllableTable()
+{
+    // Syllables are looked up in tables built at startup; looking them up
+    // should give the same result as converting them directly
+    for (const std::string syllable : {"ng5", "hou2", "zoeng1", "gwaang6"}) {
+        QCOMPARE(CantoneseUtils::convertJyutpingToYale(syllable, true),
+                 CantoneseUtils::convertJyutpingSyllableToYale(syllable));
+        QCOMPARE(CantoneseUtils::convertJyutpingToIPA(syllable, true),
+                 CantoneseUtils::convertJyutpingSyllableToIPA(syllable));
+    }
+
+    // hm is not in the tables, so it is converted on every lookup
+    QCOMPARE(CantoneseUtils::convertJyutpingToIPA("hm4", true),
+             CantoneseUtils::convertJyutpingSyllableToIPA("hm4"));
+
+    QCOMPARE(CantoneseUtils::convertJyutpingToYale("ng5 hou2 hau2"),
+             "ńgh hóu háu");
+}
+
+void TestCantoneseUtils::benchmarkJyutpingToYale()
+{
+    QBENCHMARK {
+        CantoneseUtils::convertJyutpingToYale(
+            "ngo5 dei6 heoi3 jam2 caa4 sik6 dim2 sam1 aa3");
+    }
+}
+
+void TestCantoneseUtils::benchmarkJyutpingToYaleWithoutTable()
+{
+    // What convertJyutpingToYale did before the syllable tables, except that
+    // the regexes used to be compiled again for every syllable too
+    std::vector<std::string> syllables;
+    QBENCHMARK {
+        CantoneseUtils::segmentJyutping(
+            "ngo5 dei6 heoi3 jam2 caa4 sik6 dim2 sam1 aa3",
+            syllables,
+            /* removeSpecialCharacters */ false,
+            /* removeGlobCharacters */ false);
+        std::string result;
+        for (const auto &syllable : syllables) {
+            result += CantoneseUtils::convertJyutpingSyllableToYale(syllable)
+                      + " ";
+        }
+    }
+}
+
+void TestCantoneseUtils::benchmarkJyutpingToIPA()
+{
+    QBENCHMARK {
+        CantoneseUtils::convertJyutpingToIPA(
+            "ngo5 dei6 heoi3 jam2 caa4 sik6 dim2 sam1 aa3");
+    }
+}
+
+void TestCantoneseUtils::benchmarkJyutpingToIPAWithoutTable()
+{
+    // What convertJyutpingToIPA did before the syllable tables, except that
+    // the regexes used to be compiled again for every syllable too
+    std::vector<std::string> syllables;
+    QBENCHMARK {
+        CantoneseUtils::segmentJyutping(
+            "ngo5 dei6 heoi3 jam2 caa4 sik6 dim2 sam1 aa3",
+            syllables,
+            /* removeSpecialCharacters */ false,
+            /* removeGlobCharacters */ false);
+        std::string result;
+        for (const auto &syllable : syllables) {
+            result += CantoneseUtils::convertJyutpingSyllableToIPA(syllable)
+                      + " ";
+        }
+    }
+}
+
 void TestCantoneseUtils::segmentJyutpingSimple()
 {
     std::vector<std::string> result;
@@ -568,6 +657,61 @@ void TestCantoneseUtils::segmentJyutpingGarbage()
     QCOMPARE(valid, false);
 }
 
+void TestCantoneseUtils::segmentJyutpingSpans()
+{
+    std::vector<SyllableSpan> result;
+    bool valid = CantoneseUtils::segmentJyutping(u"m4 goi1", result);
+    QCOMPARE(valid, true);
+    QCOMPARE(result.size(), 2);
+    QCOMPARE(result[0].start, 0);
+    QCOMPARE(result[0].length, 2);
+    QCOMPARE(result[1].start, 3);
+    QCOMPARE(result[1].length, 4);
+    QCOMPARE(result[1].trailing, false);
+}
+
+void TestCantoneseUtils::segmentJyutpingSpansKeepGlobCharacters()
+{
+    std::vector<SyllableSpan> result;
+    CantoneseUtils::segmentJyutping(u"m* goi",
+                                    result,
+                                    /* removeSpecialCharacters = */ true,
+                                    /* removeGlobCharacters = */ false);
+    QCOMPARE(result.size(), 3);
+    QCOMPARE(result[1].start, 1);
+    QCOMPARE(result[1].length, 2);
+}
+
+void TestCantoneseUtils::segmentJyutpingSpansTrailing()
+{
+    std::vector<SyllableSpan> result;
+    bool valid = CantoneseUtils::segmentJyutping(u"nei5 xyz", result);
+    QCOMPARE(valid, false);
+    QCOMPARE(result.size(), 2);
+    QCOMPARE(result[1].start, 5);
+    QCOMPARE(result[1].length, 3);
+    QCOMPARE(result[1].trailing, true);
+}
+
+void TestCantoneseUtils::benchmarkSegmentJyutping()
+{
+    std::vector<std::string> result;
+    QBENCHMARK {
+        CantoneseUtils::segmentJyutping(
+            "ngo5 dei6 heoi3 jam2 caa4 sik6 dim2 sam1 aa3",
+            result);
+    }
+}
+
+void TestCantoneseUtils::benchmarkSegmentJyutpingSpans()
+{
+    QString string{"ngo5 dei6 heoi3 jam2 caa4 sik6 dim2 sam1 aa3"};
+    std::vector<SyllableSpan> result;
+    QBENCHMARK {
+        CantoneseUtils::segmentJyutping(string, result);
+    }
+}
+
 void TestCantoneseUtils::autocorrectJyutpingHui()
 {
     QString result;
@@ -2458,6 +2602,56 @@ void TestCantoneseUtils::autocorrectJyutpingUt()
     QCOMPARE(err, false);
 }
 
+void TestCantoneseUtils::autocorrectJyutpingMatchesReference()
+{
+    // Inputs are built mostly from the clusters that the autocorrect rules
+    // look for, so that rules run into each other as often as possible
+    const std::vector<QString> clusters
+        = {"oh",  "ow",    "um",  "ey",   "yum",  "yup",  "yuk",  "yung",
+           "yun", "yut",   "ts",  "kwu",  "oen",  "oeng", "eong", "ao",
+           "oo",  "young", "yue", "ue",   "tsz",  "ck",   "hui",  "cu",
+           "sh",  "ch",    "zh",  "eung", "erng", "eui",  "euk",  "eun",
+           "eut", "eu",    "ern", "oei",  "oet",  "eok",  "ar",   "ee",
+           "ay",  "oy",    "ong", "ui",   "un",   "ut",   "y!u",  "y)u"};
+    const QString characters{"aeiouynmgkwzhscjlptxrbdf '136()!|G"};
+
+    std::mt19937 generator{/* seed */ 7};
+    for (int i = 0; i < 20000; i++) {
+        QString input;
+        int length = static_cast<int>(generator() % 9);
+        for (int j = 0; j < length; j++) {
+            if (generator() % 3) {
+                input += clusters[generator() % clusters.size()];
+            } else {
+                input += characters.at(generator() % characters.size());
+            }
+        }
+
+        for (bool unsafeSubstitutions : {false, true}) {
+            QString result;
+            QString expected;
+            CantoneseUtils::jyutpingAutocorrect(input,
+                                                result,
+                                                unsafeSubstitutions);
+            referenceJyutpingAutocorrect(input, expected, unsafeSubstitutions);
+            if (result != expected) {
+                qWarning() << "Input:" << input
+                           << "unsafe:" << unsafeSubstitutions;
+            }
+            QCOMPARE(result, expected);
+        }
+    }
+}
+
+void TestCantoneseUtils::benchmarkAutocorrectJyutping()
+{
+    QString result;
+    QBENCHMARK {
+        CantoneseUtils::jyutpingAutocorrect("ngo dei heui yum cha sik dim sum",
+                                            result);
+    }
+}
+
 void TestCantoneseUtils::soundChangeNg()
 {
     std::vector<std::string> result{"ng"};
@@ -16,12 +16,17 @@ public:
 private slots:
     void applyColoursJyutping();
     void applyColoursPinyin();
+    void applyColoursMixedCharacters();
+    void applyColoursCompatibilityVariantNormalization();
+    void benchmarkApplyColours();
 
     void compareStringsSimple();
     void compareStringsSingleMultibyteGrapheme();
     void compareStringsMultipleMultibyteGraphemes();
     void compareStringsMultibyteGraphemesWithAlpha();
     void compareStringsCompatibilityVariantNormalization();
+    void compareStringsDifferentLengths();
+    void benchmarkCompareStrings();
 
     void constructRomanisationQuerySingleSyllable();
     void constructRomanisationQueryMultiSyllable();
@@ -68,6 +73,59 @@ void TestChineseUtils::applyColoursPinyin()
     QCOMPARE(result, expected);
 }
 
+void TestChineseUtils::applyColoursMixedCharacters()
+{
+    // Special characters and Latin characters take up no tone, but the
+    // same character string does
+    std::string text = "A，"
+                       + std::string{Utils::SAME_CHARACTER_STRING}
+                       + "𠝹 係";
+    std::vector<uint8_t> tones = {1, 2, 6};
+    std::string result
+        = ChineseUtils::applyColours(text,
+                                     tones,
+                                     Settings::defaultJyutpingToneColours,
+                                     {},
+                                     EntryColourPhoneticType::CANTONESE);
+    std::string expected = "A，" + std::string{Utils::SAME_CHARACTER_STRING}
+                           + "<font color=""
+                           + Settings::defaultJyutpingToneColours[2]
+                           + "">𠝹</font> " + "<font color=""
+                           + Settings::defaultJyutpingToneColours[6]
+                           + "">係</font>";
+    QCOMPARE(result, expected);
+}
+
+void TestChineseUtils::applyColoursCompatibilityVariantNormalization()
+{
+    // U+FA69 is a compatibility variant of 響, and is coloured as one
+    std::string text = "\uFA69";
+    std::vector<uint8_t> tones = {2};
+    std::string result
+        = ChineseUtils::applyColours(text,
+                                     tones,
+                                     Settings::defaultJyutpingToneColours,
+                                     {},
+                                     EntryColourPhoneticType::CANTONESE);
+    std::string expected = "<font color=""
+                           + Settings::defaultJyutpingToneColours[2]
+                           + "">響</font>";
+    QCOMPARE(result, expected);
+}
+
+void TestChineseUtils::benchmarkApplyColours()
+{
+    std::string text = "我哋今日去飲茶，食咗好多點心。";
+    std::vector<uint8_t> tones = {5, 6, 1, 6, 3, 2, 4, 6, 2, 2, 1, 2, 1};
+    QBENCHMARK {
+        ChineseUtils::applyColours(text,
+                                   tones,
+                                   Settings::defaultJyutpingToneColours,
+                                   {},
+                                   EntryColourPhoneticType::CANTONESE);
+    }
+}
+
 void TestChineseUtils::compareStringsSimple()
 {
     std::string result = ChineseUtils::compareStrings("語言藝術", "语言艺术");
@@ -101,6 +159,19 @@ void TestChineseUtils::compareStringsCompatibilityVariantNormalization()
     QCOMPARE(result, Utils::SAME_CHARACTER_STRING);
 }
 
+void TestChineseUtils::compareStringsDifferentLengths()
+{
+    std::string result = ChineseUtils::compareStrings("語言", "语言艺术");
+    QCOMPARE(result, "");
+}
+
+void TestChineseUtils::benchmarkCompareStrings()
+{
+    QBENCHMARK {
+        ChineseUtils::compareStrings("語言藝術，一齊學習", "语言艺术，一齐学习");
+    }
+}
+
 void TestChineseUtils::constructRomanisationQuerySingleSyllable()
 {
     std::string result = ChineseUtils::constructRomanisationQuery(
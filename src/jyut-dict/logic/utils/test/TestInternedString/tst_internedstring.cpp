@@ -0,0 +1,153 @@
+#include <QtTest>
+
+#include "logic/utils/internedstring.h"
+
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class TestInternedString : public QObject
+{
+    Q_OBJECT
+
+public:
+    TestInternedString();
+    ~TestInternedString();
+
+private slots:
+    void emptyString();
+    void sameStringSameHandle();
+    void differentStringDifferentHandle();
+    void roundTrip();
+    void hashable();
+    void concurrentIntern();
+    void readWhileInterning();
+};
+
+TestInternedString::TestInternedString() {}
+
+TestInternedString::~TestInternedString() {}
+
+void TestInternedString::emptyString()
+{
+    InternedString defaultConstructed;
+    InternedString fromLiteral{""};
+    InternedString fromString{std::string{}};
+
+    QCOMPARE(defaultConstructed.empty(), true);
+    QCOMPARE(defaultConstructed.getId(), static_cast<InternedString::Id>(0));
+    QVERIFY(defaultConstructed == fromLiteral);
+    QVERIFY(defaultConstructed == fromString);
+    QCOMPARE(QString::fromStdString(defaultConstructed.str()), QString{});
+}
+
+void TestInternedString::sameStringSameHandle()
+{
+    InternedString first{"CC-CANTO"};
+    InternedString second{std::string{"CC-CANTO"}};
+    InternedString third{std::string_view{"CC-CANTO"}};
+
+    QCOMPARE(first.empty(), false);
+    QCOMPARE(first.getId(), second.getId());
+    QCOMPARE(first.getId(), third.getId());
+    QVERIFY(first == second);
+}
+
+void TestInternedString::differentStringDifferentHandle()
+{
+    InternedString eng{"eng"};
+    InternedString yue{"yue"};
+
+    QVERIFY(!(eng == yue));
+    QVERIFY(eng.getId() != yue.getId());
+}
+
+void TestInternedString::roundTrip()
+{
+    std::string source = "粵典—words.hk";
+    InternedString interned{source};
+
+    QCOMPARE(QString::fromStdString(interned.str()),
+             QString::fromStdString(source));
+    QCOMPARE(QString{interned.c_str()}, QString::fromStdString(source));
+    // References stay valid as more strings are added to the pool
+    const std::string &reference = interned.str();
+    for (int i = 0; i < 1000; ++i) {
+        InternedString{"roundTrip" + std::to_string(i)};
+    }
+    QCOMPARE(QString::fromStdString(reference),
+             QString::fromStdString(source));
+}
+
+void TestInternedString::hashable()
+{
+    std::unordered_map<InternedString, int> counts;
+    counts[InternedString{"CEDICT"}]++;
+    counts[InternedString{"CEDICT"}]++;
+    counts[InternedString{"CFDICT"}]++;
+
+    QCOMPARE(counts.size(), static_cast<std::size_t>(2));
+    QCOMPARE(counts[InternedString{"CEDICT"}], 2);
+}
+
+void TestInternedString::concurrentIntern()
+{
+    std::vector<std::thread> threads;
+    std::vector<InternedString::Id> ids(8);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        threads.emplace_back([&ids, i]() {
+            for (int j = 0; j < 100; ++j) {
+                InternedString{"concurrent" + std::to_string(j)};
+            }
+            ids[i] = InternedString{"concurrent"}.getId();
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (const auto id : ids) {
+        QCOMPARE(id, ids.front());
+    }
+}
+
+void TestInternedString::readWhileInterning()
+{
+    // Spans several storage chunks, so readers see chunks being added
+    std::vector<InternedString> existing;
+    for (int i = 0; i < 600; ++i) {
+        existing.emplace_back("existing" + std::to_string(i));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&existing, &done, &mismatches]() {
+            while (!done.load()) {
+                for (std::size_t j = 0; j < existing.size(); ++j) {
+                    if (existing[j].str() != "existing" + std::to_string(j)) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 2000; ++i) {
+        InternedString interned{"readWhileInterning" + std::to_string(i)};
+        if (interned.str() != "readWhileInterning" + std::to_string(i)) {
+            mismatches++;
+        }
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    QCOMPARE(mismatches.load(), 0);
+}
+
+QTEST_APPLESS_MAIN(TestInternedString)
+
+#include "tst_internedstring.moc"
@@ -49,6 +49,14 @@ private slots:
     void pinyinToIPAToneFour();
     void pinyinToIPAOtherTone();
     void pinyinToIPAErhua();
+    void pinyinSyllableTable();
+
+    void benchmarkPrettyPinyin();
+    void benchmarkPrettyPinyinWithoutTable();
+    void benchmarkPinyinToZhuyin();
+    void benchmarkPinyinToZhuyinWithoutTable();
+    void benchmarkPinyinToIPA();
+    void benchmarkPinyinToIPAWithoutTable();
 
     void segmentPinyinSimple();
     void segmentPinyinNoDigits();
@@ -71,6 +79,10 @@ private slots:
     void segmentPinyinMultipleFinals();
     void segmentPinyinInvalidTone();
     void segmentPinyinGarbage();
+    void segmentPinyinSpans();
+    void segmentPinyinSpansErhua();
+    void benchmarkSegmentPinyin();
+    void benchmarkSegmentPinyinSpans();
 
     void soundChangeZ();
     void soundChangeC();
@@ -729,6 +741,101 @@ void TestMandarinUtils::soundChangeIng()
     QCOMPARE(err, false);
 }
 
+void TestMandarinUtils::pinyinSyllableTable()
+{
+    // Syllables are looked up in tables built at startup; looking them up
+    // should give the same result as converting them directly
+    for (const std::string syllable : {"nu:3", "er2", "lu:e4", "wo3"}) {
+        QCOMPARE(MandarinUtils::createPrettyPinyin(syllable),
+                 MandarinUtils::createPrettySyllable(syllable));
+        QCOMPARE(MandarinUtils::convertPinyinToZhuyin(syllable, true),
+                 MandarinUtils::convertPinyinSyllableToZhuyin(syllable));
+    }
+
+    // Erhua syllables are not in the tables, so they are converted on every
+    // lookup
+    QCOMPARE(MandarinUtils::convertPinyinToZhuyin("huar1", true),
+             MandarinUtils::convertPinyinSyllableToZhuyin("huar1"));
+
+    QCOMPARE(MandarinUtils::createPrettyPinyin("nu:3 er2 lu:e4"), "nǚ ér lüè");
+}
+
+void TestMandarinUtils::benchmarkPrettyPinyin()
+{
+    QBENCHMARK {
+        MandarinUtils::createPrettyPinyin(
+            "wo3 men5 qu4 yin3 cha2 chi1 dian3 xin1 ba5");
+    }
+}
+
+void TestMandarinUtils::benchmarkPrettyPinyinWithoutTable()
+{
+    // What createPrettyPinyin did before the syllable tables
+    std::vector<std::string> syllables;
+    QBENCHMARK {
+        MandarinUtils::segmentPinyin(
+            "wo3 men5 qu4 yin3 cha2 chi1 dian3 xin1 ba5",
+            syllables);
+        std::string result;
+        for (const auto &syllable : syllables) {
+            result += MandarinUtils::createPrettySyllable(syllable) + " ";
+        }
+    }
+}
+
+void TestMandarinUtils::benchmarkPinyinToZhuyin()
+{
+    QBENCHMARK {
+        MandarinUtils::convertPinyinToZhuyin(
+            "wo3 men5 qu4 yin3 cha2 chi1 dian3 xin1 ba5");
+    }
+}
+
+void TestMandarinUtils::benchmarkPinyinToZhuyinWithoutTable()
+{
+    // What convertPinyinToZhuyin did before the syllable tables, except that
+    // the regexes used to be compiled again for every syllable too
+    std::vector<std::string> syllables;
+    QBENCHMARK {
+        MandarinUtils::segmentPinyin(
+            "wo3 men5 qu4 yin3 cha2 chi1 dian3 xin1 ba5",
+            syllables,
+            /* removeSpecialCharacters */ false,
+            /* removeGlobCharacters */ false);
+        std::string result;
+        for (const auto &syllable : syllables) {
+            result += MandarinUtils::convertPinyinSyllableToZhuyin(syllable)
+                      + " ";
+        }
+    }
+}
+
+void TestMandarinUtils::benchmarkPinyinToIPA()
+{
+    QBENCHMARK {
+        MandarinUtils::convertPinyinToIPA(
+            "wo3 men5 qu4 yin3 cha2 chi1 dian3 xin1 ba5");
+    }
+}
+
+void TestMandarinUtils::benchmarkPinyinToIPAWithoutTable()
+{
+    // Only the part of convertPinyinToIPA that the syllable table replaces:
+    // converting each syllable without its tone. Tone sandhi is left out.
+    std::vector<std::string> syllables;
+    QBENCHMARK {
+        MandarinUtils::segmentPinyin(
+            "wo3 men5 qu4 yin3 cha2 chi1 dian3 xin1 ba5",
+            syllables,
+            /* removeSpecialCharacters */ false,
+            /* removeGlobCharacters */ false);
+        for (const auto &syllable : syllables) {
+            MandarinUtils::convertPinyinSyllableToIPA(
+                syllable.substr(0, syllable.size() - 1));
+        }
+    }
+}
+
 void TestMandarinUtils::segmentPinyinSimple()
 {
     std::vector<std::string> result;
@@ -965,6 +1072,46 @@ void TestMandarinUtils::segmentPinyinGarbage()
     QCOMPARE(valid, false);
 }
 
+void TestMandarinUtils::segmentPinyinSpans()
+{
+    std::vector<SyllableSpan> result;
+    bool valid = MandarinUtils::segmentPinyin(u"ni3 hao3", result);
+    QCOMPARE(valid, true);
+    QCOMPARE(result.size(), 2);
+    QCOMPARE(result[0].start, 0);
+    QCOMPARE(result[0].length, 3);
+    QCOMPARE(result[1].start, 4);
+    QCOMPARE(result[1].length, 4);
+}
+
+void TestMandarinUtils::segmentPinyinSpansErhua()
+{
+    std::vector<SyllableSpan> result;
+    bool valid = MandarinUtils::segmentPinyin(u"huar4", result);
+    QCOMPARE(valid, true);
+    QCOMPARE(result.size(), 1);
+    QCOMPARE(result[0].start, 0);
+    QCOMPARE(result[0].length, 5);
+}
+
+void TestMandarinUtils::benchmarkSegmentPinyin()
+{
+    std::vector<std::string> result;
+    QBENCHMARK {
+        MandarinUtils::segmentPinyin("wo3 men5 qu4 he1 cha2 chi1 dian3 xin1",
+                                     result);
+    }
+}
+
+void TestMandarinUtils::benchmarkSegmentPinyinSpans()
+{
+    QString string{"wo3 men5 qu4 he1 cha2 chi1 dian3 xin1"};
+    std::vector<SyllableSpan> result;
+    QBENCHMARK {
+        MandarinUtils::segmentPinyin(string, result);
+    }
+}
+
 QTEST_APPLESS_MAIN(TestMandarinUtils)
 
 #include "tst_mandarinutils.moc"
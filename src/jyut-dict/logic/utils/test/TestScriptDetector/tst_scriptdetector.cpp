@@ -19,12 +19,19 @@ private slots:
 
     void chinese();
     void noChinese();
+    void chineseOutsideBMP();
+    void mixedScripts();
 
     void validJyutping();
     void noValidJyutping();
 
     void validPinyin();
     void noValidPinyin();
+
+    void propertiesInAnyOrder();
+
+    void benchmarkScriptDetector();
+    void benchmarkScriptDetectorAutoDetect();
 };
 
 TestScriptDetector::TestScriptDetector() {}
@@ -168,6 +175,26 @@ void TestScriptDetector::noChinese()
     QCOMPARE(detector.isValidPinyin(), false);
 }
 
+void TestScriptDetector::chineseOutsideBMP()
+{
+    // U+20779 (CJK Unified Ideographs Extension B), as a surrogate pair
+    ScriptDetector detector{"𠝹"};
+    QCOMPARE(detector.containsSimplifiedChinese(), false);
+    QCOMPARE(detector.containsTraditionalChinese(), false);
+    QCOMPARE(detector.containsChinese(), true);
+
+    detector = {"ng4 𠝹"};
+    QCOMPARE(detector.containsChinese(), true);
+}
+
+void TestScriptDetector::mixedScripts()
+{
+    ScriptDetector detector{"jyut6 語言 语"};
+    QCOMPARE(detector.containsSimplifiedChinese(), true);
+    QCOMPARE(detector.containsTraditionalChinese(), true);
+    QCOMPARE(detector.containsChinese(), true);
+}
+
 void TestScriptDetector::validJyutping()
 {
     ScriptDetector detector{"oet4 hei3"};
@@ -278,6 +305,58 @@ void TestScriptDetector::noValidPinyin()
     QCOMPARE(detector.isValidPinyin(), false);
 }
 
+void TestScriptDetector::propertiesInAnyOrder()
+{
+    // Properties are computed on first use, so the order in which they are
+    // asked for must not change their values
+    for (const QString &string : {"語言", "语言", "nei5 hou2", "ni3 hao3"}) {
+        ScriptDetector forwards{string};
+        bool simplified = forwards.containsSimplifiedChinese();
+        bool traditional = forwards.containsTraditionalChinese();
+        bool chinese = forwards.containsChinese();
+        bool jyutping = forwards.isValidJyutping();
+        bool jyutpingAfterAutocorrect
+            = forwards.isValidJyutpingAfterAutocorrect();
+        bool pinyin = forwards.isValidPinyin();
+
+        ScriptDetector backwards{string};
+        QCOMPARE(backwards.isValidPinyin(), pinyin);
+        QCOMPARE(backwards.isValidJyutpingAfterAutocorrect(),
+                 jyutpingAfterAutocorrect);
+        QCOMPARE(backwards.isValidJyutping(), jyutping);
+        QCOMPARE(backwards.containsChinese(), chinese);
+        QCOMPARE(backwards.containsTraditionalChinese(), traditional);
+        QCOMPARE(backwards.containsSimplifiedChinese(), simplified);
+    }
+}
+
+void TestScriptDetector::benchmarkScriptDetector()
+{
+    QString string{"我哋去飲茶食點心 ngo5 dei6 heoi3 jam2 caa4"};
+    QBENCHMARK {
+        ScriptDetector detector{string};
+        detector.containsSimplifiedChinese();
+        detector.containsTraditionalChinese();
+        detector.containsChinese();
+        detector.isValidJyutping();
+        detector.isValidJyutpingAfterAutocorrect();
+        detector.isValidPinyin();
+    }
+}
+
+void TestScriptDetector::benchmarkScriptDetectorAutoDetect()
+{
+    // This is the order in which SQLSearch::searchAutoDetectThread asks
+    QString string{"the quick brown fox jumps over the lazy dog"};
+    QBENCHMARK {
+        ScriptDetector detector{string};
+        if (!detector.containsSimplifiedChinese()) {
+            (void) (detector.containsTraditionalChinese()
+                    || detector.containsChinese());
+        }
+    }
+}
+
 QTEST_APPLESS_MAIN(TestScriptDetector)
 
 #include "tst_scriptdetector.moc"
@@ -26,21 +26,26 @@ constexpr auto NUM_COLUMNS = 2;
 constexpr auto NUM_RESULTS_PER_COLUMN = NUM_RESULTS / NUM_COLUMNS;
 } // namespace
 
-HandwritingWindow::HandwritingWindow(QWidget *parent)
+HandwritingWindow::HandwritingWindow(
+    std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils, QWidget *parent)
     : QWidget{parent, Qt::Window}
 {
     setObjectName("HandwritingWindow");
     _settings = Settings::getSettings();
     _handwritingWrapper = std::make_unique<HandwritingWrapper>(
-        Handwriting::Script::TRADITIONAL);
+        Handwriting::Script::TRADITIONAL,
+        sqlHandwritingUtils);
 
     connect(_handwritingWrapper.get(),
             &HandwritingWrapper::recognizedResults,
             this,
             [&](std::vector<std::string> results) {
-                for (int i = 0; i < results.size(); ++i) {
+                // There can be fewer words than buttons
+                for (int i = 0; i < _buttons.size(); ++i) {
                     _buttons.at(i)->setText(
-                        QString::fromStdString(results.at(i)));
+                        i < results.size()
+                            ? QString::fromStdString(results.at(i))
+                            : QString{"　"});
                 }
             });
     connect(_handwritingWrapper.get(),
@@ -73,6 +78,16 @@ HandwritingWindow::HandwritingWindow(QWidget *parent)
             break;
         }
     }
+
+    if (_settings->value("Handwriting/multiCharacter", QVariant{false})
+            .toBool()) {
+        _multiCharacterButton->click();
+    }
+
+    if (_settings->value("Handwriting/liveRecognition", QVariant{false})
+            .toBool()) {
+        _liveRecognitionButton->click();
+    }
 }
 
 void HandwritingWindow::changeEvent(QEvent *event)
@@ -158,6 +173,14 @@ void HandwritingWindow::keyPressEvent(QKeyEvent *event)
         _simplifiedButton->click();
         break;
     }
+    case Qt::Key_M: {
+        _multiCharacterButton->click();
+        break;
+    }
+    case Qt::Key_L: {
+        _liveRecognitionButton->click();
+        break;
+    }
     };
 }
 
@@ -194,6 +217,22 @@ void HandwritingWindow::setupUI()
             this,
             &HandwritingWindow::setScript);
 
+    _multiCharacterButton = new QPushButton{this};
+    _multiCharacterButton->setCheckable(true);
+    _multiCharacterButton->setObjectName("multiCharacter");
+    connect(_multiCharacterButton,
+            &QPushButton::toggled,
+            this,
+            &HandwritingWindow::setMultiCharacter);
+
+    _liveRecognitionButton = new QPushButton{this};
+    _liveRecognitionButton->setCheckable(true);
+    _liveRecognitionButton->setObjectName("liveRecognition");
+    connect(_liveRecognitionButton,
+            &QPushButton::toggled,
+            this,
+            &HandwritingWindow::setLiveRecognition);
+
     QWidget *scriptSelectorWidget = new QWidget();
     QHBoxLayout *selectorLayout = new QHBoxLayout{scriptSelectorWidget};
 
@@ -205,6 +244,8 @@ void HandwritingWindow::setupUI()
     scriptSelectorWidget->setLayout(selectorLayout);
     selectorLayout->addWidget(_traditionalButton);
     selectorLayout->addWidget(_simplifiedButton);
+    selectorLayout->addWidget(_multiCharacterButton);
+    selectorLayout->addWidget(_liveRecognitionButton);
 
     _panel = new HandwritingPanel{this};
     _panel->setObjectName("HandwritingPanel");
@@ -344,6 +385,8 @@ void HandwritingWindow::translateUI()
 
     _traditionalButton->setText(tr("Traditional Chinese"));
     _simplifiedButton->setText(tr("Simplified Chinese"));
+    _multiCharacterButton->setText(tr("Multiple Characters"));
+    _liveRecognitionButton->setText(tr("Recognize While Writing"));
 
     _clearButton->setText(tr("Clear"));
     _backspaceButton->setText(tr("Backspace"));
@@ -534,6 +577,16 @@ void HandwritingWindow::setStyle(bool use_dark)
                                button->fontMetrics().boundingRect("潑").width()
                                    + 2 * padding);
 #endif
+            if (_multiCharacterButton->isChecked()) {
+                // Choices are whole words, so make room for the rest of
+                // their characters
+                button->setFixedWidth(
+                    button->minimumWidth()
+                    + button->fontMetrics()
+                          .boundingRect(QString{"潑"}.repeated(
+                              Handwriting::MULTI_CHARACTER_CELLS - 1))
+                          .width());
+            }
             button->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
             button->ensurePolished();
         } else {
@@ -585,7 +638,9 @@ void HandwritingWindow::setScript()
     QPushButton *sender = static_cast<QPushButton *>(QObject::sender());
     QList<QPushButton *> buttons = this->findChildren<QPushButton *>();
     foreach (const auto &button, buttons) {
-        button->setChecked(button == sender);
+        if (button->property("scriptSelector").toBool()) {
+            button->setChecked(button == sender);
+        }
     }
 
     Settings::getSettings()->setValue("Handwriting/lastSelected",
@@ -596,6 +651,32 @@ void HandwritingWindow::setScript()
     emit scriptSelected(script);
 }
 
+void HandwritingWindow::setMultiCharacter(bool enabled)
+{
+    Settings::getSettings()->setValue("Handwriting/multiCharacter", enabled);
+    _handwritingWrapper->setMultiCharacter(enabled);
+
+    _panel->clearPanel();
+    if (enabled) {
+        _panel->setGrid(Handwriting::MULTI_CHARACTER_ROWS,
+                        Handwriting::MULTI_CHARACTER_COLUMNS);
+    } else {
+        _panel->setGrid(1, 1);
+    }
+    for (const auto button : _buttons) {
+        button->setText("　");
+    }
+
+    // Resize the choices to fit words or characters
+    setStyle(Utils::isDarkMode());
+}
+
+void HandwritingWindow::setLiveRecognition(bool enabled)
+{
+    Settings::getSettings()->setValue("Handwriting/liveRecognition", enabled);
+    _handwritingWrapper->setLiveRecognition(enabled);
+}
+
 void HandwritingWindow::showErrorDialog(int err, std::string description)
 {
     if (!isVisible()) {
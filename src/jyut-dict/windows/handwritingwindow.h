@@ -22,7 +22,9 @@ class HandwritingWindow : public QWidget
     Q_OBJECT
 
 public:
-    explicit HandwritingWindow(QWidget *parent = nullptr);
+    explicit HandwritingWindow(
+        std::shared_ptr<SQLHandwritingUtils> sqlHandwritingUtils,
+        QWidget *parent = nullptr);
 
     void changeEvent(QEvent *event) override;
     void keyPressEvent(QKeyEvent *event) override;
@@ -33,6 +35,8 @@ private:
     void setStyle(bool use_dark);
 
     void setScript(void);
+    void setMultiCharacter(bool enabled);
+    void setLiveRecognition(bool enabled);
 
 #ifdef Q_OS_WIN
     // On Windows, the window widget's background colour
@@ -46,6 +50,8 @@ private:
     HandwritingPanel *_panel;
     QPushButton *_traditionalButton;
     QPushButton *_simplifiedButton;
+    QPushButton *_multiCharacterButton;
+    QPushButton *_liveRecognitionButton;
 
     std::vector<QPushButton *> _buttons;
     QPushButton *_clearButton;
@@ -2,6 +2,7 @@
 
 #include "dialogs/noupdatedialog.h"
 #include "logic/dictionary/dictionarysource.h"
+#include "logic/search/searchconfig.h"
 #include "logic/settings/settings.h"
 #include "logic/settings/settingsutils.h"
 #include "logic/strings/strings.h"
@@ -49,6 +50,7 @@ MainWindow::MainWindow(QWidget *parent) :
     _sqlSearch = std::make_shared<SQLSearch>(_manager);
     _sqlUserUtils = std::make_shared<SQLUserDataUtils>(_manager);
     _sqlHistoryUtils = std::make_shared<SQLUserHistoryUtils>(_manager);
+    _sqlHandwritingUtils = std::make_shared<SQLHandwritingUtils>(_manager);
 
     // Get colours from QSettings
     _settings = Settings::getSettings();
@@ -79,6 +81,7 @@ MainWindow::MainWindow(QWidget *parent) :
         Settings::pinyinToneColours[i] = color.name().toStdString();
     }
     _settings->endArray();
+    Settings::toneColoursVersion++;
 
     // Connect signals to tell the user that database migration has occurred
     _utils = std::make_unique<SQLDatabaseUtils>(_manager);
@@ -108,7 +111,10 @@ MainWindow::MainWindow(QWidget *parent) :
     setStyle(Utils::isDarkMode());
 
     // Create UI elements
-    _mainToolBar = new MainToolBar{_sqlSearch, _sqlHistoryUtils, this};
+    _mainToolBar = new MainToolBar{_sqlSearch,
+                                   _sqlHistoryUtils,
+                                   _sqlHandwritingUtils,
+                                   this};
     addToolBar(_mainToolBar);
     setUnifiedTitleAndToolBarOnMac(true);
 #ifdef APPIMAGE
@@ -1298,6 +1304,7 @@ void MainWindow::autoDetectLanguage(void) const
 {
     if (_settings->value("Search/autoDetectLanguage", QVariant{true}).toBool()) {
         _settings->setValue("Search/autoDetectLanguage", false);
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         _autoDetectLanguageAction->setText(
             tr("Enable Automatic Search Language Switching"));
         SearchParameters lastSelected
@@ -1308,6 +1315,7 @@ void MainWindow::autoDetectLanguage(void) const
         _mainToolBar->changeSearchParameters(lastSelected);
     } else {
         _settings->setValue("Search/autoDetectLanguage", true);
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         _autoDetectLanguageAction->setText(
             tr("Disable Automatic Search Language Switching"));
         _mainToolBar->searchRequested();
@@ -1323,6 +1331,7 @@ void MainWindow::fuzzyJyutping(void) const
         _settings->setValue("Search/fuzzyJyutping", true);
         _fuzzyJyutpingAction->setText(tr("Disable Fuzzy Jyutping"));
     }
+    SearchConfigUtils::refreshSearchConfig(*_settings);
     _mainToolBar->searchRequested();
 }
 
@@ -1335,6 +1344,7 @@ void MainWindow::fuzzyPinyin(void) const
         _settings->setValue("Search/fuzzyPinyin", true);
         _fuzzyPinyinAction->setText(tr("Disable Fuzzy Pinyin"));
     }
+    SearchConfigUtils::refreshSearchConfig(*_settings);
     _mainToolBar->searchRequested();
 }
 
@@ -6,6 +6,7 @@
 #include "components/mainwindow/maintoolbar.h"
 #include "logic/database/sqldatabasemanager.h"
 #include "logic/database/sqldatabaseutils.h"
+#include "logic/database/sqlhandwritingutils.h"
 #include "logic/database/sqluserdatautils.h"
 #include "logic/database/sqluserhistoryutils.h"
 #include "logic/search/sqlsearch.h"
@@ -105,6 +106,7 @@ private:
     std::shared_ptr<SQLSearch> _sqlSearch;
     std::shared_ptr<SQLUserDataUtils> _sqlUserUtils;
     std::shared_ptr<SQLUserHistoryUtils> _sqlHistoryUtils;
+    std::shared_ptr<SQLHandwritingUtils> _sqlHandwritingUtils;
     std::unique_ptr<SQLDatabaseUtils> _utils;
     std::unique_ptr<QSettings> _settings;
 
@@ -1,5 +1,6 @@
 #include "welcomewindow.h"
 
+#include "logic/search/searchconfig.h"
 #include "logic/settings/settings.h"
 #include "logic/settings/settingsutils.h"
 #include "logic/strings/strings.h"
@@ -262,10 +263,12 @@ void WelcomeWindow::noAction(void)
 {
     if (_fuzzyJyutpingDone) {
         _settings->setValue("Search/fuzzyPinyin", false);
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         emit welcomeCompleted();
         close();
     } else {
         _settings->setValue("Search/fuzzyJyutping", false);
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         _messageLabel->setText(
             tr("New Feature: Easier Search In Mandarin")
             + QCoreApplication::translate(Strings::STRINGS_CONTEXT,
@@ -279,10 +282,12 @@ void WelcomeWindow::OKAction(void)
 {
     if (_fuzzyJyutpingDone) {
         _settings->setValue("Search/fuzzyPinyin", true);
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         emit welcomeCompleted();
         close();
     } else {
         _settings->setValue("Search/fuzzyJyutping", true);
+        SearchConfigUtils::refreshSearchConfig(*_settings);
         _messageLabel->setText(
             tr("New Feature: Easier Search In Mandarin")
             + QCoreApplication::translate(Strings::STRINGS_CONTEXT,